@@ -4,10 +4,23 @@
 
 #include <boost/hash2/fnv1a.hpp>
 #include <boost/hash2/siphash.hpp>
+#include <boost/hash2/highwayhash.hpp>
 #include <boost/hash2/xxhash.hpp>
+#include <boost/hash2/wyhash.hpp>
+#include <boost/hash2/polymur.hpp>
+#include <boost/hash2/tabulation.hpp>
+#include <boost/hash2/multiply_shift.hpp>
+#include <boost/hash2/xxh3.hpp>
+#include <boost/hash2/aeshash.hpp>
 #include <boost/hash2/spooky2.hpp>
 #include <boost/hash2/md5.hpp>
 #include <boost/hash2/sha1.hpp>
+#include <boost/hash2/sha2.hpp>
+#include <boost/hash2/sha3.hpp>
+#include <boost/hash2/blake2.hpp>
+#include <boost/hash2/blake3.hpp>
+#include <boost/hash2/poly1305.hpp>
+#include <boost/hash2/polyval.hpp>
 #include <boost/hash2/murmur3.hpp>
 #include <boost/hash2/hash_append.hpp>
 #include <boost/hash2/get_integral_result.hpp>
@@ -61,13 +74,52 @@ template<class R> void test( int N )
     test_<R, boost::hash2::murmur3_128>( N );
     test_<R, boost::hash2::xxhash_32>( N );
     test_<R, boost::hash2::xxhash_64>( N );
+    test_<R, boost::hash2::wyhash_64>( N );
+    test_<R, boost::hash2::polymur_64>( N );
+    test_<R, boost::hash2::tabulation_64>( N );
+    test_<R, boost::hash2::twisted_tabulation_64>( N );
+    test_<R, boost::hash2::multiply_shift_64>( N );
+    test_<R, boost::hash2::multiply_add_shift_64>( N );
+    test_<R, boost::hash2::xxh3_64>( N );
+    test_<R, boost::hash2::xxh3_128>( N );
+    test_<R, boost::hash2::aeshash_64>( N );
+    test_<R, boost::hash2::aeshash_128>( N );
     test_<R, boost::hash2::spooky2_128>( N );
     test_<R, boost::hash2::siphash_32>( N );
+    test_<R, boost::hash2::siphash13_32>( N );
     test_<R, boost::hash2::siphash_64>( N );
+    test_<R, boost::hash2::siphash13_64>( N );
+    test_<R, boost::hash2::highwayhash_64>( N );
+    test_<R, boost::hash2::highwayhash_128>( N );
+    test_<R, boost::hash2::highwayhash_256>( N );
     test_<R, boost::hash2::md5_128>( N );
     test_<R, boost::hash2::sha1_160>( N );
+    test_<R, boost::hash2::sha2_256>( N );
+    test_<R, boost::hash2::sha2_224>( N );
+    test_<R, boost::hash2::sha2_512>( N );
+    test_<R, boost::hash2::sha2_384>( N );
+    test_<R, boost::hash2::sha2_512_256>( N );
+    test_<R, boost::hash2::sha3_256>( N );
+    test_<R, boost::hash2::sha3_512>( N );
+    test_<R, boost::hash2::shake_128>( N );
+    test_<R, boost::hash2::shake_256>( N );
+    test_<R, boost::hash2::blake2b_512>( N );
+    test_<R, boost::hash2::blake2b_256>( N );
+    test_<R, boost::hash2::blake2s_256>( N );
+    test_<R, boost::hash2::blake2s_128>( N );
+    test_<R, boost::hash2::blake2bp_512>( N );
+    test_<R, boost::hash2::blake2sp_256>( N );
+    test_<R, boost::hash2::blake3>( N );
     test_<R, boost::hash2::hmac_md5_128>( N );
     test_<R, boost::hash2::hmac_sha1_160>( N );
+    test_<R, boost::hash2::hmac_sha2_256>( N );
+    test_<R, boost::hash2::hmac_sha2_224>( N );
+    test_<R, boost::hash2::hmac_sha2_512>( N );
+    test_<R, boost::hash2::hmac_sha2_384>( N );
+    test_<R, boost::hash2::hmac_sha2_512_256>( N );
+    test_<R, boost::hash2::poly1305>( N );
+    test_<R, boost::hash2::polyval>( N );
+    test_<R, boost::hash2::ghash>( N );
 
     puts( "" );
 }
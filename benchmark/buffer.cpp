@@ -3,12 +3,28 @@
 // https://www.boost.org/LICENSE_1_0.txt
 
 #include <boost/hash2/fnv1a.hpp>
+#include <boost/hash2/crc.hpp>
+#include <boost/hash2/adler32.hpp>
+#include <boost/hash2/fletcher.hpp>
 #include <boost/hash2/siphash.hpp>
+#include <boost/hash2/highwayhash.hpp>
 #include <boost/hash2/xxhash.hpp>
+#include <boost/hash2/wyhash.hpp>
+#include <boost/hash2/polymur.hpp>
+#include <boost/hash2/tabulation.hpp>
+#include <boost/hash2/multiply_shift.hpp>
+#include <boost/hash2/xxh3.hpp>
+#include <boost/hash2/aeshash.hpp>
 #include <boost/hash2/spooky2.hpp>
 #include <boost/hash2/murmur3.hpp>
 #include <boost/hash2/md5.hpp>
 #include <boost/hash2/sha1.hpp>
+#include <boost/hash2/sha2.hpp>
+#include <boost/hash2/sha3.hpp>
+#include <boost/hash2/blake2.hpp>
+#include <boost/hash2/blake3.hpp>
+#include <boost/hash2/poly1305.hpp>
+#include <boost/hash2/polyval.hpp>
 #include <boost/hash2/hash_append.hpp>
 #include <boost/hash2/get_integral_result.hpp>
 #include <boost/core/type_name.hpp>
@@ -46,17 +62,62 @@ void test( int N, int M )
 {
     test_<boost::hash2::fnv1a_32>( data, N, M );
     test_<boost::hash2::fnv1a_64>( data, N, M );
+    test_<boost::hash2::crc32c>( data, N, M );
+    test_<boost::hash2::crc32_ieee>( data, N, M );
+    test_<boost::hash2::crc64_xz>( data, N, M );
+    test_<boost::hash2::crc64_nvme>( data, N, M );
+    test_<boost::hash2::adler32>( data, N, M );
+    test_<boost::hash2::fletcher64>( data, N, M );
     test_<boost::hash2::murmur3_32>( data, N, M );
     test_<boost::hash2::murmur3_128>( data, N, M );
     test_<boost::hash2::xxhash_32>( data, N, M );
     test_<boost::hash2::xxhash_64>( data, N, M );
+    test_<boost::hash2::wyhash_64>( data, N, M );
+    test_<boost::hash2::polymur_64>( data, N, M );
+    test_<boost::hash2::tabulation_64>( data, N, M );
+    test_<boost::hash2::twisted_tabulation_64>( data, N, M );
+    test_<boost::hash2::multiply_shift_64>( data, N, M );
+    test_<boost::hash2::multiply_add_shift_64>( data, N, M );
+    test_<boost::hash2::xxh3_64>( data, N, M );
+    test_<boost::hash2::xxh3_128>( data, N, M );
+    test_<boost::hash2::aeshash_64>( data, N, M );
+    test_<boost::hash2::aeshash_128>( data, N, M );
     test_<boost::hash2::spooky2_128>( data, N, M );
     test_<boost::hash2::siphash_32>( data, N, M );
+    test_<boost::hash2::siphash13_32>( data, N, M );
     test_<boost::hash2::siphash_64>( data, N, M );
+    test_<boost::hash2::siphash13_64>( data, N, M );
+    test_<boost::hash2::highwayhash_64>( data, N, M );
+    test_<boost::hash2::highwayhash_128>( data, N, M );
+    test_<boost::hash2::highwayhash_256>( data, N, M );
     test_<boost::hash2::md5_128>( data, N, M );
     test_<boost::hash2::sha1_160>( data, N, M );
+    test_<boost::hash2::sha2_256>( data, N, M );
+    test_<boost::hash2::sha2_224>( data, N, M );
+    test_<boost::hash2::sha2_512>( data, N, M );
+    test_<boost::hash2::sha2_384>( data, N, M );
+    test_<boost::hash2::sha2_512_256>( data, N, M );
+    test_<boost::hash2::sha3_256>( data, N, M );
+    test_<boost::hash2::sha3_512>( data, N, M );
+    test_<boost::hash2::shake_128>( data, N, M );
+    test_<boost::hash2::shake_256>( data, N, M );
+    test_<boost::hash2::blake2b_512>( data, N, M );
+    test_<boost::hash2::blake2b_256>( data, N, M );
+    test_<boost::hash2::blake2s_256>( data, N, M );
+    test_<boost::hash2::blake2s_128>( data, N, M );
+    test_<boost::hash2::blake2bp_512>( data, N, M );
+    test_<boost::hash2::blake2sp_256>( data, N, M );
+    test_<boost::hash2::blake3>( data, N, M );
     test_<boost::hash2::hmac_md5_128>( data, N, M );
     test_<boost::hash2::hmac_sha1_160>( data, N, M );
+    test_<boost::hash2::hmac_sha2_256>( data, N, M );
+    test_<boost::hash2::hmac_sha2_224>( data, N, M );
+    test_<boost::hash2::hmac_sha2_512>( data, N, M );
+    test_<boost::hash2::hmac_sha2_384>( data, N, M );
+    test_<boost::hash2::hmac_sha2_512_256>( data, N, M );
+    test_<boost::hash2::poly1305>( data, N, M );
+    test_<boost::hash2::polyval>( data, N, M );
+    test_<boost::hash2::ghash>( data, N, M );
 
     puts( "--" );
 }
@@ -64,6 +125,11 @@ void test( int N, int M )
 unsigned const N1 = 65536;
 unsigned const M1 = 65535;
 
+// a buffer larger than the caches, for the sustained throughput
+
+unsigned const N0 = 16 * 1048576;
+unsigned const M0 = M1 * N1 / N0;
+
 unsigned const N2 = 15;
 unsigned const M2 = M1 * N1 / N2;
 
@@ -72,9 +138,10 @@ unsigned const M3 = M1 * N1 / N3;
 
 int main()
 {
+    test( N0, M0 );
     test( N1, M1 );
     test( N2, M2 );
     test( N3, M3 );
 }
 
-unsigned char data[ N1 ];
+unsigned char data[ N0 ];
@@ -0,0 +1,114 @@
+// Copyright 2024 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/tabulation.hpp>
+#include <boost/hash2/multiply_shift.hpp>
+#include <boost/hash2/fnv1a.hpp>
+#include <boost/hash2/murmur3.hpp>
+#include <boost/hash2/xxhash.hpp>
+#include <boost/hash2/siphash.hpp>
+#include <boost/hash2/wyhash.hpp>
+#include <boost/hash2/polymur.hpp>
+#include <boost/hash2/xxh3.hpp>
+#include <boost/hash2/hash_append.hpp>
+#include <boost/hash2/get_integral_result.hpp>
+#include <boost/core/type_name.hpp>
+#include <cstdint>
+#include <random>
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <vector>
+
+// hashes 64 bit keys through hash_append and result(),
+// from a copy of a seeded object, as a hash table would
+
+template<class H> void test_append( std::vector<std::uint64_t> const & v )
+{
+    typedef std::chrono::steady_clock clock_type;
+
+    H const h0( 0x9e3779b97f4a7c15ull );
+
+    clock_type::time_point t1 = clock_type::now();
+
+    std::uint64_t q = 0;
+
+    for( std::size_t i = 0; i < v.size(); ++i )
+    {
+        H h( h0 );
+
+        boost::hash2::hash_append( h, v[ i ] );
+
+        q += boost::hash2::get_integral_result<std::uint64_t>( h.result() );
+    }
+
+    clock_type::time_point t2 = clock_type::now();
+
+    long long ns = std::chrono::duration_cast<std::chrono::nanoseconds>( t2 - t1 ).count();
+
+    std::printf( "%s, hash_append: q=%llu, %.2f ns/key\n", boost::core::type_name<H>().c_str(), static_cast<unsigned long long>( q ), static_cast<double>( ns ) / v.size() );
+}
+
+// hashes 64 bit keys with operator()
+
+template<class H> void test_call( std::vector<std::uint64_t> const & v )
+{
+    typedef std::chrono::steady_clock clock_type;
+
+    H const h( 0x9e3779b97f4a7c15ull );
+
+    clock_type::time_point t1 = clock_type::now();
+
+    std::uint64_t q = 0;
+
+    for( std::size_t i = 0; i < v.size(); ++i )
+    {
+        q += h( v[ i ] );
+    }
+
+    clock_type::time_point t2 = clock_type::now();
+
+    long long ns = std::chrono::duration_cast<std::chrono::nanoseconds>( t2 - t1 ).count();
+
+    std::printf( "%s, operator(): q=%llu, %.2f ns/key\n", boost::core::type_name<H>().c_str(), static_cast<unsigned long long>( q ), static_cast<double>( ns ) / v.size() );
+}
+
+int main()
+{
+    int const N = 16 * 1024 * 1024;
+
+    std::vector<std::uint64_t> v;
+
+    {
+        v.reserve( N );
+
+        std::mt19937_64 rnd;
+
+        for( int i = 0; i < N; ++i )
+        {
+            v.push_back( rnd() );
+        }
+    }
+
+    test_append<boost::hash2::fnv1a_64>( v );
+    test_append<boost::hash2::murmur3_32>( v );
+    test_append<boost::hash2::murmur3_128>( v );
+    test_append<boost::hash2::xxhash_64>( v );
+    test_append<boost::hash2::siphash_64>( v );
+    test_append<boost::hash2::siphash13_64>( v );
+    test_append<boost::hash2::wyhash_64>( v );
+    test_append<boost::hash2::polymur_64>( v );
+    test_append<boost::hash2::xxh3_64>( v );
+    test_append<boost::hash2::multiply_shift_64>( v );
+    test_append<boost::hash2::multiply_add_shift_64>( v );
+
+    std::puts( "" );
+
+    test_call<boost::hash2::tabulation_64>( v );
+    test_call<boost::hash2::twisted_tabulation_64>( v );
+    test_call<boost::hash2::multiply_shift_64>( v );
+    test_call<boost::hash2::multiply_add_shift_64>( v );
+
+    std::puts( "" );
+}
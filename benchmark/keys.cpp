@@ -6,11 +6,17 @@
 
 #include <boost/hash2/fnv1a.hpp>
 #include <boost/hash2/siphash.hpp>
+#include <boost/hash2/highwayhash.hpp>
 #include <boost/hash2/xxhash.hpp>
+#include <boost/hash2/wyhash.hpp>
+#include <boost/hash2/polymur.hpp>
+#include <boost/hash2/xxh3.hpp>
 #include <boost/hash2/spooky2.hpp>
 #include <boost/hash2/md5.hpp>
 #include <boost/hash2/sha1.hpp>
 #include <boost/hash2/murmur3.hpp>
+#include <boost/hash2/hash_batch.hpp>
+#include <boost/hash2/buffered.hpp>
 #include <boost/hash2/hash_append.hpp>
 #include <boost/hash2/get_integral_result.hpp>
 #include <boost/core/type_name.hpp>
@@ -222,6 +228,149 @@ template<class H, class V> void test2( int N, V const& v )
     test3<H>( N, v, 0x9e3779b9 );
 }
 
+// hashes the characters of the keys, through update() and result() on
+// a copy of a seeded object, and through the one-shot H::hash()
+
+template<class H> typename H::result_type hash_one_shot( H const&, std::string const& s, std::uint64_t seed )
+{
+    return H::hash( s.data(), s.size(), seed );
+}
+
+boost::hash2::polymur_64::result_type hash_one_shot( boost::hash2::polymur_64 const& h, std::string const& s, std::uint64_t )
+{
+    return h.hash( s.data(), s.size() );
+}
+
+template<class H, class V> void test_one_shot( int N, V const& v )
+{
+    typedef std::chrono::steady_clock clock_type;
+
+    std::uint64_t const seed = 0x9e3779b9;
+
+    H const h0( seed );
+
+    std::size_t q1 = 0, q2 = 0;
+
+    clock_type::time_point t1 = clock_type::now();
+
+    for( int i = 0; i < N; ++i )
+    {
+        H h( h0 );
+        h.update( v[i].data(), v[i].size() );
+
+        q1 += boost::hash2::get_integral_result<std::size_t>( h.result() );
+    }
+
+    clock_type::time_point t2 = clock_type::now();
+
+    for( int i = 0; i < N; ++i )
+    {
+        q2 += boost::hash2::get_integral_result<std::size_t>( hash_one_shot( h0, v[i], seed ) );
+    }
+
+    clock_type::time_point t3 = clock_type::now();
+
+    long long ms1 = std::chrono::duration_cast<std::chrono::milliseconds>( t2 - t1 ).count();
+    long long ms2 = std::chrono::duration_cast<std::chrono::milliseconds>( t3 - t2 ).count();
+
+    std::string hash = boost::core::type_name<H>();
+
+    std::printf( "%s: q=%zu, %lld ms; one-shot: q=%zu, %lld ms\n", hash.c_str(), q1, ms1, q2, ms2 );
+}
+
+// hashes the characters of the keys one at a time through H::hash(),
+// and several at a time through hash_batch<H>. These keys are shorter
+// than the 128 bytes from which hash_batch uses SIMD lanes, so this
+// measures its overhead
+
+template<class H, class V> void test_batch( int N, V const& v )
+{
+    typedef std::chrono::steady_clock clock_type;
+
+    std::uint64_t const seed = 0x9e3779b9;
+
+    std::vector<typename H::result_type> r( N );
+
+    clock_type::time_point t1 = clock_type::now();
+
+    for( int i = 0; i < N; ++i )
+    {
+        r[i] = H::hash( v[i].data(), v[i].size(), seed );
+    }
+
+    std::size_t q1 = 0;
+
+    for( int i = 0; i < N; ++i )
+    {
+        q1 += boost::hash2::get_integral_result<std::size_t>( r[i] );
+    }
+
+    clock_type::time_point t2 = clock_type::now();
+
+    boost::hash2::hash_batch<H>( v.begin(), v.end(), seed, r.begin() );
+
+    std::size_t q2 = 0;
+
+    for( int i = 0; i < N; ++i )
+    {
+        q2 += boost::hash2::get_integral_result<std::size_t>( r[i] );
+    }
+
+    clock_type::time_point t3 = clock_type::now();
+
+    long long ms1 = std::chrono::duration_cast<std::chrono::milliseconds>( t2 - t1 ).count();
+    long long ms2 = std::chrono::duration_cast<std::chrono::milliseconds>( t3 - t2 ).count();
+
+    std::string hash = boost::core::type_name<H>();
+
+    std::printf( "%s: one-shot: q=%zu, %lld ms; batch: q=%zu, %lld ms\n", hash.c_str(), q1, ms1, q2, ms2 );
+}
+
+// hashes groups of eight keys through hash_append, which calls update()
+// twice per key, once for the characters and once for the size, directly
+// and through buffered<H>
+
+template<class H, class V> void test_buffered( int N, V const& v )
+{
+    typedef std::chrono::steady_clock clock_type;
+
+    std::uint64_t const seed = 0x9e3779b9;
+
+    H const h1( seed );
+    boost::hash2::buffered<H> const h2( seed );
+
+    std::size_t q1 = 0, q2 = 0;
+
+    clock_type::time_point t1 = clock_type::now();
+
+    for( int i = 0; i + 8 <= N; i += 8 )
+    {
+        H h( h1 );
+        boost::hash2::hash_append_range( h, v.begin() + i, v.begin() + i + 8 );
+
+        q1 += boost::hash2::get_integral_result<std::size_t>( h.result() );
+    }
+
+    clock_type::time_point t2 = clock_type::now();
+
+    for( int i = 0; i + 8 <= N; i += 8 )
+    {
+        boost::hash2::buffered<H> h( h2 );
+        boost::hash2::hash_append_range( h, v.begin() + i, v.begin() + i + 8 );
+
+        q2 += boost::hash2::get_integral_result<std::size_t>( h.result() );
+    }
+
+    clock_type::time_point t3 = clock_type::now();
+
+    long long ms1 = std::chrono::duration_cast<std::chrono::milliseconds>( t2 - t1 ).count();
+    long long ms2 = std::chrono::duration_cast<std::chrono::milliseconds>( t3 - t2 ).count();
+
+    std::string hash = boost::core::type_name<H>();
+
+    std::printf( "%s: q=%zu, %lld ms; buffered: q=%zu, %lld ms\n", hash.c_str(), q1, ms1, q2, ms2 );
+}
+
 int main()
 {
     int const N = 16 * 1048576;
@@ -260,9 +409,49 @@ int main()
     test2<boost::hash2::murmur3_128>( N, v );
     test2<boost::hash2::xxhash_32>( N, v );
     test2<boost::hash2::xxhash_64>( N, v );
+    test2<boost::hash2::wyhash_64>( N, v );
+    test2<boost::hash2::polymur_64>( N, v );
+    test2<boost::hash2::xxh3_64>( N, v );
+    test2<boost::hash2::xxh3_128>( N, v );
     test2<boost::hash2::spooky2_128>( N, v );
     test2<boost::hash2::siphash_32>( N, v );
+    test2<boost::hash2::siphash13_32>( N, v );
     test2<boost::hash2::siphash_64>( N, v );
+    test2<boost::hash2::siphash13_64>( N, v );
+    test2<boost::hash2::highwayhash_64>( N, v );
+
+    std::puts( "" );
+
+    test_one_shot<boost::hash2::fnv1a_64>( N, v );
+    test_one_shot<boost::hash2::murmur3_32>( N, v );
+    test_one_shot<boost::hash2::murmur3_128>( N, v );
+    test_one_shot<boost::hash2::xxhash_32>( N, v );
+    test_one_shot<boost::hash2::xxhash_64>( N, v );
+    test_one_shot<boost::hash2::wyhash_64>( N, v );
+    test_one_shot<boost::hash2::polymur_64>( N, v );
+    test_one_shot<boost::hash2::xxh3_64>( N, v );
+    test_one_shot<boost::hash2::xxh3_128>( N, v );
+    test_one_shot<boost::hash2::spooky2_128>( N, v );
+    test_one_shot<boost::hash2::siphash_32>( N, v );
+    test_one_shot<boost::hash2::siphash_64>( N, v );
+    test_one_shot<boost::hash2::siphash13_64>( N, v );
+
+    std::puts( "" );
+
+    test_batch<boost::hash2::murmur3_32>( N, v );
+    test_batch<boost::hash2::xxhash_32>( N, v );
+    test_batch<boost::hash2::xxhash_64>( N, v );
+    test_batch<boost::hash2::siphash_64>( N, v );
+    test_batch<boost::hash2::siphash13_64>( N, v );
+
+    std::puts( "" );
+
+    test_buffered<boost::hash2::fnv1a_64>( N, v );
+    test_buffered<boost::hash2::murmur3_32>( N, v );
+    test_buffered<boost::hash2::xxhash_64>( N, v );
+    test_buffered<boost::hash2::siphash_64>( N, v );
+    test_buffered<boost::hash2::md5_128>( N, v );
+    test_buffered<boost::hash2::sha1_160>( N, v );
 
     std::puts( "" );
 }
@@ -0,0 +1,265 @@
+#ifndef BOOST_HASH2_ADLER32_HPP_INCLUDED
+#define BOOST_HASH2_ADLER32_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// Adler-32, https://www.rfc-editor.org/rfc/rfc1950#section-8.2
+
+#include <boost/hash2/detail/config.hpp>
+#include <boost/hash2/detail/intrin.hpp>
+#include <boost/hash2/detail/write.hpp>
+#include <boost/assert.hpp>
+#include <cstdint>
+#include <cstddef>
+
+namespace boost
+{
+namespace hash2
+{
+
+class adler32
+{
+private:
+
+    static const std::uint32_t BASE = 65521;
+
+    // the largest n such that 255 n (n + 1) / 2 + (n + 1) (BASE - 1)
+    // fits in 32 bits; the sums are reduced once every NMAX bytes
+    static const std::size_t NMAX = 5552;
+
+    std::uint32_t s1_, s2_;
+
+private:
+
+    static void update_( std::uint32_t & s1, std::uint32_t & s2, unsigned char const * p, std::size_t n )
+    {
+        BOOST_ASSERT( n <= NMAX );
+
+        for( ; n >= 4; n -= 4, p += 4 )
+        {
+            s1 += p[ 0 ]; s2 += s1;
+            s1 += p[ 1 ]; s2 += s1;
+            s1 += p[ 2 ]; s2 += s1;
+            s1 += p[ 3 ]; s2 += s1;
+        }
+
+        for( ; n > 0; --n, ++p )
+        {
+            s1 += p[ 0 ]; s2 += s1;
+        }
+
+        s1 %= BASE;
+        s2 %= BASE;
+    }
+
+#if defined(BOOST_HASH2_HAS_AVX2)
+
+    // k blocks of 32 bytes, with the sums of s1 deferred in ps, and the
+    // bytes weighted by their distance from the end of the block in s2
+
+    static void update_32( std::uint32_t & s1, std::uint32_t & s2, unsigned char const * p, std::size_t k )
+    {
+        BOOST_ASSERT( k * 32 <= NMAX );
+
+        __m256i const taps = _mm256_set_epi8(
+            1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16,
+            17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 );
+
+        __m256i const ones = _mm256_set1_epi16( 1 );
+        __m256i const zero = _mm256_setzero_si256();
+
+        __m256i v_ps = _mm256_setzero_si256();
+        __m256i v_s1 = _mm256_setzero_si256();
+        __m256i v_s2 = _mm256_setzero_si256();
+
+        for( std::size_t i = 0; i < k; ++i, p += 32 )
+        {
+            __m256i const b = _mm256_loadu_si256( reinterpret_cast<__m256i const*>( p ) );
+
+            v_ps = _mm256_add_epi32( v_ps, v_s1 );
+            v_s1 = _mm256_add_epi32( v_s1, _mm256_sad_epu8( b, zero ) );
+            v_s2 = _mm256_add_epi32( v_s2, _mm256_madd_epi16( _mm256_maddubs_epi16( b, taps ), ones ) );
+        }
+
+        v_s2 = _mm256_add_epi32( v_s2, _mm256_slli_epi32( v_ps, 5 ) );
+
+        __m128i w1 = _mm_add_epi32( _mm256_castsi256_si128( v_s1 ), _mm256_extracti128_si256( v_s1, 1 ) );
+        __m128i w2 = _mm_add_epi32( _mm256_castsi256_si128( v_s2 ), _mm256_extracti128_si256( v_s2, 1 ) );
+
+        w1 = _mm_add_epi32( w1, _mm_shuffle_epi32( w1, _MM_SHUFFLE( 1, 0, 3, 2 ) ) );
+
+        w2 = _mm_add_epi32( w2, _mm_shuffle_epi32( w2, _MM_SHUFFLE( 1, 0, 3, 2 ) ) );
+        w2 = _mm_add_epi32( w2, _mm_shuffle_epi32( w2, _MM_SHUFFLE( 2, 3, 0, 1 ) ) );
+
+        s2 += static_cast<std::uint32_t>( k * 32 ) * s1 + static_cast<std::uint32_t>( _mm_cvtsi128_si32( w2 ) );
+        s1 += static_cast<std::uint32_t>( _mm_cvtsi128_si32( w1 ) );
+
+        s1 %= BASE;
+        s2 %= BASE;
+    }
+
+#elif defined(BOOST_HASH2_HAS_SSSE3)
+
+    static void update_32( std::uint32_t & s1, std::uint32_t & s2, unsigned char const * p, std::size_t k )
+    {
+        BOOST_ASSERT( k * 32 <= NMAX );
+
+        __m128i const taps1 = _mm_set_epi8( 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32 );
+        __m128i const taps2 = _mm_set_epi8( 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16 );
+
+        __m128i const ones = _mm_set1_epi16( 1 );
+        __m128i const zero = _mm_setzero_si128();
+
+        __m128i v_ps = _mm_setzero_si128();
+        __m128i v_s1 = _mm_setzero_si128();
+        __m128i v_s2 = _mm_setzero_si128();
+
+        for( std::size_t i = 0; i < k; ++i, p += 32 )
+        {
+            __m128i const b1 = _mm_loadu_si128( reinterpret_cast<__m128i const*>( p ) );
+            __m128i const b2 = _mm_loadu_si128( reinterpret_cast<__m128i const*>( p + 16 ) );
+
+            v_ps = _mm_add_epi32( v_ps, v_s1 );
+
+            v_s1 = _mm_add_epi32( v_s1, _mm_sad_epu8( b1, zero ) );
+            v_s1 = _mm_add_epi32( v_s1, _mm_sad_epu8( b2, zero ) );
+
+            v_s2 = _mm_add_epi32( v_s2, _mm_madd_epi16( _mm_maddubs_epi16( b1, taps1 ), ones ) );
+            v_s2 = _mm_add_epi32( v_s2, _mm_madd_epi16( _mm_maddubs_epi16( b2, taps2 ), ones ) );
+        }
+
+        v_s2 = _mm_add_epi32( v_s2, _mm_slli_epi32( v_ps, 5 ) );
+
+        __m128i w1 = v_s1;
+        __m128i w2 = v_s2;
+
+        w1 = _mm_add_epi32( w1, _mm_shuffle_epi32( w1, _MM_SHUFFLE( 1, 0, 3, 2 ) ) );
+
+        w2 = _mm_add_epi32( w2, _mm_shuffle_epi32( w2, _MM_SHUFFLE( 1, 0, 3, 2 ) ) );
+        w2 = _mm_add_epi32( w2, _mm_shuffle_epi32( w2, _MM_SHUFFLE( 2, 3, 0, 1 ) ) );
+
+        s2 += static_cast<std::uint32_t>( k * 32 ) * s1 + static_cast<std::uint32_t>( _mm_cvtsi128_si32( w2 ) );
+        s1 += static_cast<std::uint32_t>( _mm_cvtsi128_si32( w1 ) );
+
+        s1 %= BASE;
+        s2 %= BASE;
+    }
+
+#endif
+
+public:
+
+    typedef std::uint32_t result_type;
+    typedef std::uint32_t size_type;
+
+    adler32(): s1_( 1 ), s2_( 0 )
+    {
+    }
+
+    // as with the CRCs, a seed is hashed as if by update()
+
+    explicit adler32( std::uint64_t seed ): s1_( 1 ), s2_( 0 )
+    {
+        if( seed )
+        {
+            unsigned char tmp[ 8 ];
+            detail::write64le( tmp, seed );
+
+            update( tmp, ( seed >> 32 )? 8: 4 );
+        }
+    }
+
+    adler32( unsigned char const * p, std::size_t n ): s1_( 1 ), s2_( 0 )
+    {
+        if( n != 0 )
+        {
+            update( p, n );
+        }
+    }
+
+    void update( void const * pv, std::size_t n )
+    {
+        unsigned char const* p = static_cast<unsigned char const*>( pv );
+
+        std::uint32_t s1 = s1_;
+        std::uint32_t s2 = s2_;
+
+#if defined(BOOST_HASH2_HAS_SSSE3)
+
+        while( n >= 32 )
+        {
+            std::size_t k = n;
+            if( k > NMAX ) k = NMAX;
+
+            k /= 32;
+
+            update_32( s1, s2, p, k );
+
+            p += k * 32;
+            n -= k * 32;
+        }
+
+#endif
+
+        while( n > 0 )
+        {
+            std::size_t k = n;
+            if( k > NMAX ) k = NMAX;
+
+            update_( s1, s2, p, k );
+
+            p += k;
+            n -= k;
+        }
+
+        s1_ = s1;
+        s2_ = s2;
+    }
+
+    std::uint32_t result()
+    {
+        std::uint32_t r = ( s2_ << 16 ) | s1_;
+
+        // advance as if by update( "\xFF", 1 ), to allow
+        // multiple result() calls to generate a sequence
+        // of distinct values
+
+        unsigned char const tmp = 0xFF;
+        update( &tmp, 1 );
+
+        return r;
+    }
+};
+
+// Given adler_a, the Adler-32 of A, and adler_b, the Adler-32 of B,
+// returns the Adler-32 of A followed by B; len_b is the size of B in
+// bytes. Both sums of B start from 1, which is subtracted from s1,
+// and the len_b (s1 of A - 1) contributions added to s2
+
+inline std::uint32_t adler32_combine( std::uint32_t adler_a, std::uint32_t adler_b, std::uint64_t len_b )
+{
+    std::uint32_t const BASE = 65521;
+
+    std::uint32_t const rem = static_cast<std::uint32_t>( len_b % BASE );
+
+    std::uint32_t s1 = adler_a & 0xFFFF;
+    std::uint32_t s2 = rem * s1 % BASE;
+
+    s1 += ( adler_b & 0xFFFF ) + BASE - 1;
+    s2 += ( adler_a >> 16 ) + ( adler_b >> 16 ) + BASE - rem;
+
+    if( s1 >= BASE ) s1 -= BASE;
+    if( s1 >= BASE ) s1 -= BASE;
+
+    if( s2 >= 2 * BASE ) s2 -= 2 * BASE;
+    if( s2 >= BASE ) s2 -= BASE;
+
+    return ( s2 << 16 ) | s1;
+}
+
+} // namespace hash2
+} // namespace boost
+
+#endif // #ifndef BOOST_HASH2_ADLER32_HPP_INCLUDED
@@ -0,0 +1,534 @@
+#ifndef BOOST_HASH2_AESHASH_HPP_INCLUDED
+#define BOOST_HASH2_AESHASH_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// A fast non-cryptographic hash built on the AES round function
+//
+// The input is absorbed by eight independent 128 bit lanes, one AES
+// round (AESENC, with the input as the round key) per 16 bytes. The
+// lanes are then folded together, and the length is mixed in by three
+// more rounds. The state is initialized from the 128 bit key (the seed)
+// by two rounds per lane.
+//
+// AES-NI and VAES are used when enabled; the portable implementation
+// uses the usual lookup table formulation of the round and produces
+// identical results.
+
+#include <boost/hash2/detail/config.hpp>
+#include <boost/hash2/detail/intrin.hpp>
+#include <boost/hash2/detail/read.hpp>
+#include <boost/hash2/detail/write.hpp>
+#include <boost/hash2/detail/rot.hpp>
+#include <boost/mp11/integer_sequence.hpp>
+#include <boost/assert.hpp>
+#include <boost/config.hpp>
+#include <cstdint>
+#include <array>
+#include <cstring>
+#include <cstddef>
+
+namespace boost
+{
+namespace hash2
+{
+
+namespace detail
+{
+
+// GF(2^8) arithmetic, for computing the round tables
+
+constexpr unsigned aes_xtime( unsigned a )
+{
+    return ( ( a << 1 ) ^ ( ( a & 0x80 )? 0x1B: 0 ) ) & 0xFF;
+}
+
+constexpr unsigned aes_mul( unsigned a, unsigned b )
+{
+    return b == 0? 0: ( ( b & 1 )? a: 0 ) ^ aes_mul( aes_xtime( a ), b >> 1 );
+}
+
+constexpr unsigned aes_pow( unsigned a, unsigned e )
+{
+    return e == 0? 1: aes_mul( ( e & 1 )? a: 1, aes_pow( aes_mul( a, a ), e >> 1 ) );
+}
+
+constexpr unsigned aes_rotl8( unsigned a, int k )
+{
+    return ( ( a << k ) | ( a >> ( 8 - k ) ) ) & 0xFF;
+}
+
+constexpr unsigned aes_affine( unsigned a )
+{
+    return a ^ aes_rotl8( a, 1 ) ^ aes_rotl8( a, 2 ) ^ aes_rotl8( a, 3 ) ^ aes_rotl8( a, 4 ) ^ 0x63;
+}
+
+// the S-box is the affine transform of the multiplicative inverse (a^254)
+
+constexpr unsigned aes_sbox( unsigned a )
+{
+    return aes_affine( aes_pow( a, 254 ) );
+}
+
+// SubBytes followed by MixColumns, for a byte in row 0; the
+// other rows are obtained by rotating left by 8, 16, 24
+
+constexpr std::uint32_t aes_te_( unsigned s )
+{
+    return static_cast<std::uint32_t>( aes_xtime( s ) | ( s << 8 ) | ( s << 16 ) | ( ( aes_xtime( s ) ^ s ) << 24 ) );
+}
+
+constexpr std::uint32_t aes_te( unsigned a )
+{
+    return aes_te_( aes_sbox( a ) );
+}
+
+template<class S = mp11::make_index_sequence<256>> struct aes_tables;
+
+template<std::size_t... I> struct aes_tables<mp11::index_sequence<I...>>
+{
+    static const std::uint32_t te[ 256 ];
+};
+
+template<std::size_t... I> const std::uint32_t aes_tables<mp11::index_sequence<I...>>::te[ 256 ] =
+{
+    aes_te( I )...
+};
+
+// one AES encryption round (AESENC), on little endian 32 bit columns;
+// r may alias x or k
+
+inline void aes_round( std::uint32_t const * x, std::uint32_t const * k, std::uint32_t * r )
+{
+    std::uint32_t const * t = aes_tables<>::te;
+
+    std::uint32_t x0 = x[ 0 ];
+    std::uint32_t x1 = x[ 1 ];
+    std::uint32_t x2 = x[ 2 ];
+    std::uint32_t x3 = x[ 3 ];
+
+    std::uint32_t r0 = t[ x0 & 0xFF ] ^ detail::rotl( t[ ( x1 >> 8 ) & 0xFF ], 8 ) ^ detail::rotl( t[ ( x2 >> 16 ) & 0xFF ], 16 ) ^ detail::rotl( t[ x3 >> 24 ], 24 ) ^ k[ 0 ];
+    std::uint32_t r1 = t[ x1 & 0xFF ] ^ detail::rotl( t[ ( x2 >> 8 ) & 0xFF ], 8 ) ^ detail::rotl( t[ ( x3 >> 16 ) & 0xFF ], 16 ) ^ detail::rotl( t[ x0 >> 24 ], 24 ) ^ k[ 1 ];
+    std::uint32_t r2 = t[ x2 & 0xFF ] ^ detail::rotl( t[ ( x3 >> 8 ) & 0xFF ], 8 ) ^ detail::rotl( t[ ( x0 >> 16 ) & 0xFF ], 16 ) ^ detail::rotl( t[ x1 >> 24 ], 24 ) ^ k[ 2 ];
+    std::uint32_t r3 = t[ x3 & 0xFF ] ^ detail::rotl( t[ ( x0 >> 8 ) & 0xFF ], 8 ) ^ detail::rotl( t[ ( x1 >> 16 ) & 0xFF ], 16 ) ^ detail::rotl( t[ x2 >> 24 ], 24 ) ^ k[ 3 ];
+
+    r[ 0 ] = r0;
+    r[ 1 ] = r1;
+    r[ 2 ] = r2;
+    r[ 3 ] = r3;
+}
+
+template<class = void> struct aeshash_constants
+{
+    // the fractional part of pi; 8 initial lanes and 3 finalization keys
+    static const std::uint32_t K[ 44 ];
+};
+
+template<class T> const std::uint32_t aeshash_constants<T>::K[ 44 ] =
+{
+    0x243F6A88, 0x85A308D3, 0x13198A2E, 0x03707344, 0xA4093822, 0x299F31D0, 0x082EFA98, 0xEC4E6C89,
+    0x452821E6, 0x38D01377, 0xBE5466CF, 0x34E90C6C, 0xC0AC29B7, 0xC97C50DD, 0x3F84D5B5, 0xB5470917,
+    0x9216D5D9, 0x8979FB1B, 0xD1310BA6, 0x98DFB5AC, 0x2FFD72DB, 0xD01ADFB7, 0xB8E1AFED, 0x6A267E96,
+    0xBA7C9045, 0xF12C7F99, 0x24A19947, 0xB3916CF7, 0x0801F2E2, 0x858EFC16, 0x636920D8, 0x71574E69,
+    0xA458FEA3, 0xF4933D7E, 0x0D95748F, 0x728EB658, 0x718BCD58, 0x82154AEE, 0x7B54A41D, 0xC25A59B5,
+    0x9C30D539, 0x2AF26013, 0xC5D1B023, 0x286085F0,
+};
+
+class aeshash_base
+{
+private:
+
+    static const std::size_t N = 128;
+
+    // eight lanes of four little endian words
+    std::uint32_t st_[ 32 ];
+
+    unsigned char buffer_[ N ];
+    std::size_t m_;
+
+    std::uint64_t n_;
+
+private:
+
+#if defined(BOOST_HASH2_HAS_VAES) && defined(BOOST_HASH2_HAS_AVX512)
+
+    static void process( std::uint32_t * st, unsigned char const * p, std::size_t k )
+    {
+        __m512i s0 = _mm512_loadu_si512( st +  0 );
+        __m512i s1 = _mm512_loadu_si512( st + 16 );
+
+        for( std::size_t i = 0; i < k; ++i, p += N )
+        {
+            s0 = _mm512_aesenc_epi128( s0, _mm512_loadu_si512( p +  0 ) );
+            s1 = _mm512_aesenc_epi128( s1, _mm512_loadu_si512( p + 64 ) );
+        }
+
+        _mm512_storeu_si512( st +  0, s0 );
+        _mm512_storeu_si512( st + 16, s1 );
+    }
+
+#elif defined(BOOST_HASH2_HAS_VAES)
+
+    static void process( std::uint32_t * st, unsigned char const * p, std::size_t k )
+    {
+        __m256i s0 = _mm256_loadu_si256( reinterpret_cast<__m256i const*>( st +  0 ) );
+        __m256i s1 = _mm256_loadu_si256( reinterpret_cast<__m256i const*>( st +  8 ) );
+        __m256i s2 = _mm256_loadu_si256( reinterpret_cast<__m256i const*>( st + 16 ) );
+        __m256i s3 = _mm256_loadu_si256( reinterpret_cast<__m256i const*>( st + 24 ) );
+
+        for( std::size_t i = 0; i < k; ++i, p += N )
+        {
+            s0 = _mm256_aesenc_epi128( s0, _mm256_loadu_si256( reinterpret_cast<__m256i const*>( p +  0 ) ) );
+            s1 = _mm256_aesenc_epi128( s1, _mm256_loadu_si256( reinterpret_cast<__m256i const*>( p + 32 ) ) );
+            s2 = _mm256_aesenc_epi128( s2, _mm256_loadu_si256( reinterpret_cast<__m256i const*>( p + 64 ) ) );
+            s3 = _mm256_aesenc_epi128( s3, _mm256_loadu_si256( reinterpret_cast<__m256i const*>( p + 96 ) ) );
+        }
+
+        _mm256_storeu_si256( reinterpret_cast<__m256i*>( st +  0 ), s0 );
+        _mm256_storeu_si256( reinterpret_cast<__m256i*>( st +  8 ), s1 );
+        _mm256_storeu_si256( reinterpret_cast<__m256i*>( st + 16 ), s2 );
+        _mm256_storeu_si256( reinterpret_cast<__m256i*>( st + 24 ), s3 );
+    }
+
+#elif defined(BOOST_HASH2_HAS_AES)
+
+    static void process( std::uint32_t * st, unsigned char const * p, std::size_t k )
+    {
+        // the lanes are kept in separate variables, as the compiler
+        // does not always keep an array in registers
+
+        __m128i s0 = _mm_loadu_si128( reinterpret_cast<__m128i const*>( st +  0 ) );
+        __m128i s1 = _mm_loadu_si128( reinterpret_cast<__m128i const*>( st +  4 ) );
+        __m128i s2 = _mm_loadu_si128( reinterpret_cast<__m128i const*>( st +  8 ) );
+        __m128i s3 = _mm_loadu_si128( reinterpret_cast<__m128i const*>( st + 12 ) );
+        __m128i s4 = _mm_loadu_si128( reinterpret_cast<__m128i const*>( st + 16 ) );
+        __m128i s5 = _mm_loadu_si128( reinterpret_cast<__m128i const*>( st + 20 ) );
+        __m128i s6 = _mm_loadu_si128( reinterpret_cast<__m128i const*>( st + 24 ) );
+        __m128i s7 = _mm_loadu_si128( reinterpret_cast<__m128i const*>( st + 28 ) );
+
+        for( std::size_t i = 0; i < k; ++i, p += N )
+        {
+            s0 = _mm_aesenc_si128( s0, _mm_loadu_si128( reinterpret_cast<__m128i const*>( p +   0 ) ) );
+            s1 = _mm_aesenc_si128( s1, _mm_loadu_si128( reinterpret_cast<__m128i const*>( p +  16 ) ) );
+            s2 = _mm_aesenc_si128( s2, _mm_loadu_si128( reinterpret_cast<__m128i const*>( p +  32 ) ) );
+            s3 = _mm_aesenc_si128( s3, _mm_loadu_si128( reinterpret_cast<__m128i const*>( p +  48 ) ) );
+            s4 = _mm_aesenc_si128( s4, _mm_loadu_si128( reinterpret_cast<__m128i const*>( p +  64 ) ) );
+            s5 = _mm_aesenc_si128( s5, _mm_loadu_si128( reinterpret_cast<__m128i const*>( p +  80 ) ) );
+            s6 = _mm_aesenc_si128( s6, _mm_loadu_si128( reinterpret_cast<__m128i const*>( p +  96 ) ) );
+            s7 = _mm_aesenc_si128( s7, _mm_loadu_si128( reinterpret_cast<__m128i const*>( p + 112 ) ) );
+        }
+
+        _mm_storeu_si128( reinterpret_cast<__m128i*>( st +  0 ), s0 );
+        _mm_storeu_si128( reinterpret_cast<__m128i*>( st +  4 ), s1 );
+        _mm_storeu_si128( reinterpret_cast<__m128i*>( st +  8 ), s2 );
+        _mm_storeu_si128( reinterpret_cast<__m128i*>( st + 12 ), s3 );
+        _mm_storeu_si128( reinterpret_cast<__m128i*>( st + 16 ), s4 );
+        _mm_storeu_si128( reinterpret_cast<__m128i*>( st + 20 ), s5 );
+        _mm_storeu_si128( reinterpret_cast<__m128i*>( st + 24 ), s6 );
+        _mm_storeu_si128( reinterpret_cast<__m128i*>( st + 28 ), s7 );
+    }
+
+#else
+
+    static void process( std::uint32_t * st, unsigned char const * p, std::size_t k )
+    {
+        for( std::size_t i = 0; i < k; ++i, p += N )
+        {
+            for( int j = 0; j < 8; ++j )
+            {
+                std::uint32_t w[ 4 ];
+
+                for( int l = 0; l < 4; ++l )
+                {
+                    w[ l ] = detail::read32le( p + 16 * j + 4 * l );
+                }
+
+                aes_round( st + 4 * j, w, st + 4 * j );
+            }
+        }
+    }
+
+#endif
+
+#if defined(BOOST_HASH2_HAS_AES)
+
+    void init( std::uint32_t const * key )
+    {
+        __m128i k = _mm_loadu_si128( reinterpret_cast<__m128i const*>( key ) );
+
+        for( int j = 0; j < 8; ++j )
+        {
+            __m128i s = _mm_loadu_si128( reinterpret_cast<__m128i const*>( aeshash_constants<>::K + 4 * j ) );
+
+            s = _mm_aesenc_si128( s, k );
+            s = _mm_aesenc_si128( s, k );
+
+            _mm_storeu_si128( reinterpret_cast<__m128i*>( st_ + 4 * j ), s );
+        }
+
+        std::memset( buffer_, 0, N );
+        m_ = 0;
+
+        n_ = 0;
+    }
+
+    void digest( std::uint32_t * h )
+    {
+        if( m_ > 0 )
+        {
+            std::memset( buffer_ + m_, 0, N - m_ );
+            process( st_, buffer_, 1 );
+        }
+
+        __m128i s[ 8 ];
+
+        for( int j = 0; j < 8; ++j )
+        {
+            s[ j ] = _mm_loadu_si128( reinterpret_cast<__m128i const*>( st_ + 4 * j ) );
+        }
+
+        for( int j = 0; j < 4; ++j )
+        {
+            s[ j ] = _mm_aesenc_si128( s[ j ], s[ j + 4 ] );
+        }
+
+        s[ 0 ] = _mm_aesenc_si128( s[ 0 ], s[ 2 ] );
+        s[ 1 ] = _mm_aesenc_si128( s[ 1 ], s[ 3 ] );
+
+        __m128i r = _mm_aesenc_si128( s[ 0 ], s[ 1 ] );
+
+        r = _mm_xor_si128( r, _mm_set_epi64x( 0, static_cast<long long>( n_ ) ) );
+
+        for( int j = 0; j < 3; ++j )
+        {
+            r = _mm_aesenc_si128( r, _mm_loadu_si128( reinterpret_cast<__m128i const*>( aeshash_constants<>::K + 32 + 4 * j ) ) );
+        }
+
+        _mm_storeu_si128( reinterpret_cast<__m128i*>( h ), r );
+    }
+
+#else
+
+    void init( std::uint32_t const * key )
+    {
+        for( int j = 0; j < 8; ++j )
+        {
+            aes_round( aeshash_constants<>::K + 4 * j, key, st_ + 4 * j );
+            aes_round( st_ + 4 * j, key, st_ + 4 * j );
+        }
+
+        std::memset( buffer_, 0, N );
+        m_ = 0;
+
+        n_ = 0;
+    }
+
+    void digest( std::uint32_t * h )
+    {
+        if( m_ > 0 )
+        {
+            std::memset( buffer_ + m_, 0, N - m_ );
+            process( st_, buffer_, 1 );
+        }
+
+        std::uint32_t s[ 32 ];
+        std::memcpy( s, st_, sizeof( s ) );
+
+        for( int j = 0; j < 4; ++j )
+        {
+            aes_round( s + 4 * j, s + 4 * j + 16, s + 4 * j );
+        }
+
+        aes_round( s + 0, s +  8, s + 0 );
+        aes_round( s + 4, s + 12, s + 4 );
+
+        aes_round( s + 0, s + 4, h );
+
+        h[ 0 ] ^= static_cast<std::uint32_t>( n_ );
+        h[ 1 ] ^= static_cast<std::uint32_t>( n_ >> 32 );
+
+        for( int j = 0; j < 3; ++j )
+        {
+            aes_round( h, aeshash_constants<>::K + 32 + 4 * j, h );
+        }
+    }
+
+#endif
+
+protected:
+
+    void init( std::uint64_t seed )
+    {
+        std::uint32_t const key[ 4 ] = { static_cast<std::uint32_t>( seed ), static_cast<std::uint32_t>( seed >> 32 ), 0, 0 };
+        init( key );
+    }
+
+    // a byte seed of up to 16 bytes is the key, zero padded;
+    // longer seeds are hashed to obtain it
+    void init( unsigned char const * p, std::size_t n )
+    {
+        std::uint32_t key[ 4 ];
+
+        if( n == 0 )
+        {
+            init( std::uint64_t() );
+            return;
+        }
+        else if( n <= 16 )
+        {
+            unsigned char q[ 16 ] = {};
+            std::memcpy( q, p, n );
+
+            for( int i = 0; i < 4; ++i )
+            {
+                key[ i ] = detail::read32le( q + 4 * i );
+            }
+        }
+        else
+        {
+            init( std::uint64_t() );
+            update( p, n );
+            digest( key );
+        }
+
+        init( key );
+    }
+
+    // called from result(); clears the buffered plaintext and rekeys
+    // the state with the result, so that subsequent results differ
+    void digest_and_reset( std::uint32_t * h )
+    {
+        digest( h );
+        init( h );
+    }
+
+public:
+
+    typedef std::uint64_t size_type;
+
+    void update( void const * pv, std::size_t n )
+    {
+        unsigned char const* p = static_cast<unsigned char const*>( pv );
+
+        n_ += n;
+
+        if( m_ > 0 )
+        {
+            std::size_t k = N - m_;
+
+            if( n < k )
+            {
+                k = n;
+            }
+
+            std::memcpy( buffer_ + m_, p, k );
+
+            p += k;
+            n -= k;
+            m_ += k;
+
+            if( m_ < N ) return;
+
+            BOOST_ASSERT( m_ == N );
+
+            process( st_, buffer_, 1 );
+            m_ = 0;
+        }
+
+        BOOST_ASSERT( m_ == 0 );
+
+        if( n >= N )
+        {
+            std::size_t k = n / N;
+
+            process( st_, p, k );
+
+            p += k * N;
+            n -= k * N;
+        }
+
+        BOOST_ASSERT( n < N );
+
+        if( n > 0 )
+        {
+            std::memcpy( buffer_, p, n );
+            m_ = n;
+        }
+    }
+};
+
+} // namespace detail
+
+class aeshash_64: public detail::aeshash_base
+{
+public:
+
+    typedef std::uint64_t result_type;
+
+    aeshash_64()
+    {
+        init( std::uint64_t() );
+    }
+
+    explicit aeshash_64( std::uint64_t seed )
+    {
+        init( seed );
+    }
+
+    aeshash_64( unsigned char const * p, std::size_t n )
+    {
+        init( p, n );
+    }
+
+    result_type result()
+    {
+        std::uint32_t h[ 4 ];
+        digest_and_reset( h );
+
+        return ( static_cast<std::uint64_t>( h[ 1 ] ) << 32 ) | h[ 0 ];
+    }
+};
+
+class aeshash_128: public detail::aeshash_base
+{
+public:
+
+    typedef std::array<unsigned char, 16> result_type;
+
+    aeshash_128()
+    {
+        init( std::uint64_t() );
+    }
+
+    explicit aeshash_128( std::uint64_t seed )
+    {
+        init( seed );
+    }
+
+    aeshash_128( unsigned char const * p, std::size_t n )
+    {
+        init( p, n );
+    }
+
+    result_type result()
+    {
+        std::uint32_t h[ 4 ];
+        digest_and_reset( h );
+
+        result_type r;
+
+        for( int i = 0; i < 4; ++i )
+        {
+            detail::write32le( &r[ 4 * i ], h[ i ] );
+        }
+
+        return r;
+    }
+};
+
+} // namespace hash2
+} // namespace boost
+
+#endif // #ifndef BOOST_HASH2_AESHASH_HPP_INCLUDED
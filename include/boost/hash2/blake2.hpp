@@ -0,0 +1,1223 @@
+#ifndef BOOST_HASH2_BLAKE2_HPP_INCLUDED
+#define BOOST_HASH2_BLAKE2_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// BLAKE2b, BLAKE2s, BLAKE2bp, BLAKE2sp, https://www.blake2.net/blake2.pdf
+// and https://tools.ietf.org/html/rfc7693
+
+#include <boost/hash2/detail/u32x8.hpp>
+#include <boost/hash2/detail/intrin.hpp>
+#include <boost/hash2/detail/read.hpp>
+#include <boost/hash2/detail/write.hpp>
+#include <boost/hash2/detail/rot.hpp>
+#include <boost/hash2/detail/config.hpp>
+#include <boost/assert.hpp>
+#include <boost/config.hpp>
+#include <cstdint>
+#include <array>
+#include <cstring>
+#include <cstddef>
+
+namespace boost
+{
+namespace hash2
+{
+namespace detail
+{
+
+template<class = void> struct blake2_constants
+{
+    static const std::uint64_t IV64[ 8 ];
+    static const std::uint32_t IV32[ 8 ];
+
+    static const unsigned char sigma[ 12 ][ 16 ];
+};
+
+template<class T> const std::uint64_t blake2_constants<T>::IV64[ 8 ] =
+{
+    0x6a09e667f3bcc908ull, 0xbb67ae8584caa73bull, 0x3c6ef372fe94f82bull, 0xa54ff53a5f1d36f1ull,
+    0x510e527fade682d1ull, 0x9b05688c2b3e6c1full, 0x1f83d9abfb41bd6bull, 0x5be0cd19137e2179ull
+};
+
+template<class T> const std::uint32_t blake2_constants<T>::IV32[ 8 ] =
+{
+    0x6a09e667u, 0xbb67ae85u, 0x3c6ef372u, 0xa54ff53au, 0x510e527fu, 0x9b05688cu, 0x1f83d9abu, 0x5be0cd19u
+};
+
+template<class T> const unsigned char blake2_constants<T>::sigma[ 12 ][ 16 ] =
+{
+    {  0,  1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 13, 14, 15 },
+    { 14, 10,  4,  8,  9, 15, 13,  6,  1, 12,  0,  2, 11,  7,  5,  3 },
+    { 11,  8, 12,  0,  5,  2, 15, 13, 10, 14,  3,  6,  7,  1,  9,  4 },
+    {  7,  9,  3,  1, 13, 12, 11, 14,  2,  6,  5, 10,  4,  0, 15,  8 },
+    {  9,  0,  5,  7,  2,  4, 10, 15, 14,  1, 11, 12,  6,  8,  3, 13 },
+    {  2, 12,  6, 10,  0, 11,  8,  3,  4, 13,  7,  5, 15, 14,  1,  9 },
+    { 12,  5,  1, 15, 14, 13,  4, 10,  0,  7,  6,  3,  9,  2,  8, 11 },
+    { 13, 11,  7, 14, 12,  1,  3,  9,  5,  0, 15,  4,  8,  6,  2, 10 },
+    {  6, 15, 14,  9, 11,  3,  0,  8, 12,  2, 13,  7,  1,  4, 10,  5 },
+    { 10,  2,  8,  4,  7,  6,  1,  5, 15, 11,  9, 14,  3, 12, 13,  0 },
+    {  0,  1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 13, 14, 15 },
+    { 14, 10,  4,  8,  9, 15, 13,  6,  1, 12,  0,  2, 11,  7,  5,  3 },
+};
+
+// The compression functions; each kernel also compresses the same block
+// position of `lanes` independent leaves at once, for BLAKE2bp/BLAKE2sp
+
+struct blake2b_kernel
+{
+    typedef std::uint64_t word_type;
+
+    static const int block_size = 128;
+    static const int max_digest_size = 64;
+    static const int max_key_size = 64;
+    static const int lanes = 4;
+
+    // initializes h from the parameter block
+    static void init( std::uint64_t h[ 8 ], int digest_size, int key_size, int fanout, int depth, std::uint64_t node_offset, int node_depth, int inner_size )
+    {
+        std::uint64_t const * IV = blake2_constants<>::IV64;
+
+        for( int i = 0; i < 8; ++i )
+        {
+            h[ i ] = IV[ i ];
+        }
+
+        h[ 0 ] ^= static_cast<std::uint64_t>( digest_size | key_size << 8 | fanout << 16 | depth << 24 );
+        h[ 1 ] ^= node_offset;
+        h[ 2 ] ^= static_cast<std::uint64_t>( node_depth | inner_size << 8 );
+    }
+
+    static BOOST_FORCEINLINE void G( std::uint64_t v[ 16 ], int a, int b, int c, int d, std::uint64_t x, std::uint64_t y )
+    {
+        v[ a ] = v[ a ] + v[ b ] + x;
+        v[ d ] = detail::rotr( v[ d ] ^ v[ a ], 32 );
+        v[ c ] = v[ c ] + v[ d ];
+        v[ b ] = detail::rotr( v[ b ] ^ v[ c ], 24 );
+        v[ a ] = v[ a ] + v[ b ] + y;
+        v[ d ] = detail::rotr( v[ d ] ^ v[ a ], 16 );
+        v[ c ] = v[ c ] + v[ d ];
+        v[ b ] = detail::rotr( v[ b ] ^ v[ c ], 63 );
+    }
+
+    static void compress_scalar( std::uint64_t h[ 8 ], unsigned char const block[ 128 ], std::uint64_t t, bool last, bool last_node )
+    {
+        std::uint64_t const * IV = blake2_constants<>::IV64;
+
+        std::uint64_t m[ 16 ];
+
+        for( int i = 0; i < 16; ++i )
+        {
+            m[ i ] = detail::read64le( block + i * 8 );
+        }
+
+        std::uint64_t v[ 16 ] =
+        {
+            h[ 0 ], h[ 1 ], h[ 2 ], h[ 3 ], h[ 4 ], h[ 5 ], h[ 6 ], h[ 7 ],
+            IV[ 0 ], IV[ 1 ], IV[ 2 ], IV[ 3 ],
+            IV[ 4 ] ^ t, IV[ 5 ], IV[ 6 ] ^ ( last? ~std::uint64_t(): 0 ), IV[ 7 ] ^ ( last_node? ~std::uint64_t(): 0 )
+        };
+
+        for( int r = 0; r < 12; ++r )
+        {
+            unsigned char const * s = blake2_constants<>::sigma[ r ];
+
+            G( v, 0, 4,  8, 12, m[ s[  0 ] ], m[ s[  1 ] ] );
+            G( v, 1, 5,  9, 13, m[ s[  2 ] ], m[ s[  3 ] ] );
+            G( v, 2, 6, 10, 14, m[ s[  4 ] ], m[ s[  5 ] ] );
+            G( v, 3, 7, 11, 15, m[ s[  6 ] ], m[ s[  7 ] ] );
+
+            G( v, 0, 5, 10, 15, m[ s[  8 ] ], m[ s[  9 ] ] );
+            G( v, 1, 6, 11, 12, m[ s[ 10 ] ], m[ s[ 11 ] ] );
+            G( v, 2, 7,  8, 13, m[ s[ 12 ] ], m[ s[ 13 ] ] );
+            G( v, 3, 4,  9, 14, m[ s[ 14 ] ], m[ s[ 15 ] ] );
+        }
+
+        for( int i = 0; i < 8; ++i )
+        {
+            h[ i ] ^= v[ i ] ^ v[ i + 8 ];
+        }
+    }
+
+#if defined(BOOST_HASH2_HAS_AVX2)
+
+#if defined(BOOST_HASH2_HAS_AVX512)
+
+    template<int K> static BOOST_FORCEINLINE __m256i rotr( __m256i x )
+    {
+        return _mm256_ror_epi64( x, K );
+    }
+
+#else
+
+    template<int K> static BOOST_FORCEINLINE __m256i rotr( __m256i x )
+    {
+        return _mm256_or_si256( _mm256_srli_epi64( x, K ), _mm256_slli_epi64( x, 64 - K ) );
+    }
+
+#endif
+
+    static BOOST_FORCEINLINE __m256i rotr32( __m256i x )
+    {
+        return _mm256_shuffle_epi32( x, _MM_SHUFFLE( 2, 3, 0, 1 ) );
+    }
+
+    static BOOST_FORCEINLINE __m256i rotr24( __m256i x )
+    {
+#if defined(BOOST_HASH2_HAS_AVX512)
+
+        return rotr<24>( x );
+
+#else
+
+        __m256i const mask = _mm256_setr_epi8( 3, 4, 5, 6, 7, 0, 1, 2, 11, 12, 13, 14, 15, 8, 9, 10, 3, 4, 5, 6, 7, 0, 1, 2, 11, 12, 13, 14, 15, 8, 9, 10 );
+        return _mm256_shuffle_epi8( x, mask );
+
+#endif
+    }
+
+    static BOOST_FORCEINLINE __m256i rotr16( __m256i x )
+    {
+#if defined(BOOST_HASH2_HAS_AVX512)
+
+        return rotr<16>( x );
+
+#else
+
+        __m256i const mask = _mm256_setr_epi8( 2, 3, 4, 5, 6, 7, 0, 1, 10, 11, 12, 13, 14, 15, 8, 9, 2, 3, 4, 5, 6, 7, 0, 1, 10, 11, 12, 13, 14, 15, 8, 9 );
+        return _mm256_shuffle_epi8( x, mask );
+
+#endif
+    }
+
+    static BOOST_FORCEINLINE __m256i rotr63( __m256i x )
+    {
+#if defined(BOOST_HASH2_HAS_AVX512)
+
+        return rotr<63>( x );
+
+#else
+
+        return _mm256_xor_si256( _mm256_srli_epi64( x, 63 ), _mm256_add_epi64( x, x ) );
+
+#endif
+    }
+
+    static BOOST_FORCEINLINE void G( __m256i & a, __m256i & b, __m256i & c, __m256i & d, __m256i x, __m256i y )
+    {
+        a = _mm256_add_epi64( _mm256_add_epi64( a, b ), x );
+        d = rotr32( _mm256_xor_si256( d, a ) );
+        c = _mm256_add_epi64( c, d );
+        b = rotr24( _mm256_xor_si256( b, c ) );
+        a = _mm256_add_epi64( _mm256_add_epi64( a, b ), y );
+        d = rotr16( _mm256_xor_si256( d, a ) );
+        c = _mm256_add_epi64( c, d );
+        b = rotr63( _mm256_xor_si256( b, c ) );
+    }
+
+    static BOOST_FORCEINLINE __m256i gather( std::uint64_t const m[ 16 ], unsigned char const * s )
+    {
+        return _mm256_set_epi64x( m[ s[ 6 ] ], m[ s[ 4 ] ], m[ s[ 2 ] ], m[ s[ 0 ] ] );
+    }
+
+    // the state rows are held in one register each; the four G functions
+    // of a column or diagonal step run in parallel
+
+    static void compress_avx2( std::uint64_t h[ 8 ], unsigned char const block[ 128 ], std::uint64_t t, bool last, bool last_node )
+    {
+        std::uint64_t const * IV = blake2_constants<>::IV64;
+
+        std::uint64_t m[ 16 ];
+        std::memcpy( m, block, 128 ); // x86 is little endian
+
+        __m256i a = _mm256_loadu_si256( reinterpret_cast<__m256i const*>( h + 0 ) );
+        __m256i b = _mm256_loadu_si256( reinterpret_cast<__m256i const*>( h + 4 ) );
+        __m256i c = _mm256_loadu_si256( reinterpret_cast<__m256i const*>( IV + 0 ) );
+
+        __m256i d = _mm256_xor_si256(
+            _mm256_loadu_si256( reinterpret_cast<__m256i const*>( IV + 4 ) ),
+            _mm256_set_epi64x( last_node? -1: 0, last? -1: 0, 0, static_cast<long long>( t ) ) );
+
+        __m256i const a0 = a, b0 = b;
+
+        for( int r = 0; r < 12; ++r )
+        {
+            unsigned char const * s = blake2_constants<>::sigma[ r ];
+
+            G( a, b, c, d, gather( m, s + 0 ), gather( m, s + 1 ) );
+
+            b = _mm256_permute4x64_epi64( b, _MM_SHUFFLE( 0, 3, 2, 1 ) );
+            c = _mm256_permute4x64_epi64( c, _MM_SHUFFLE( 1, 0, 3, 2 ) );
+            d = _mm256_permute4x64_epi64( d, _MM_SHUFFLE( 2, 1, 0, 3 ) );
+
+            G( a, b, c, d, gather( m, s + 8 ), gather( m, s + 9 ) );
+
+            b = _mm256_permute4x64_epi64( b, _MM_SHUFFLE( 2, 1, 0, 3 ) );
+            c = _mm256_permute4x64_epi64( c, _MM_SHUFFLE( 1, 0, 3, 2 ) );
+            d = _mm256_permute4x64_epi64( d, _MM_SHUFFLE( 0, 3, 2, 1 ) );
+        }
+
+        a = _mm256_xor_si256( a0, _mm256_xor_si256( a, c ) );
+        b = _mm256_xor_si256( b0, _mm256_xor_si256( b, d ) );
+
+        _mm256_storeu_si256( reinterpret_cast<__m256i*>( h + 0 ), a );
+        _mm256_storeu_si256( reinterpret_cast<__m256i*>( h + 4 ), b );
+    }
+
+    // w[ i ] receives word i of the four blocks at p[ 0 ], ..., p[ 3 ]
+    static BOOST_FORCEINLINE void load_transposed( unsigned char const * const p[ 4 ], __m256i w[ 16 ] )
+    {
+        for( int k = 0; k < 4; ++k )
+        {
+            __m256i r0 = _mm256_loadu_si256( reinterpret_cast<__m256i const*>( p[ 0 ] + k * 32 ) );
+            __m256i r1 = _mm256_loadu_si256( reinterpret_cast<__m256i const*>( p[ 1 ] + k * 32 ) );
+            __m256i r2 = _mm256_loadu_si256( reinterpret_cast<__m256i const*>( p[ 2 ] + k * 32 ) );
+            __m256i r3 = _mm256_loadu_si256( reinterpret_cast<__m256i const*>( p[ 3 ] + k * 32 ) );
+
+            __m256i t0 = _mm256_unpacklo_epi64( r0, r1 );
+            __m256i t1 = _mm256_unpackhi_epi64( r0, r1 );
+            __m256i t2 = _mm256_unpacklo_epi64( r2, r3 );
+            __m256i t3 = _mm256_unpackhi_epi64( r2, r3 );
+
+            w[ k * 4 + 0 ] = _mm256_permute2x128_si256( t0, t2, 0x20 );
+            w[ k * 4 + 1 ] = _mm256_permute2x128_si256( t1, t3, 0x20 );
+            w[ k * 4 + 2 ] = _mm256_permute2x128_si256( t0, t2, 0x31 );
+            w[ k * 4 + 3 ] = _mm256_permute2x128_si256( t1, t3, 0x31 );
+        }
+    }
+
+    static void compress_lanes( std::uint64_t h[ 8 ][ 4 ], unsigned char const * const p[ 4 ], std::uint64_t t )
+    {
+        std::uint64_t const * IV = blake2_constants<>::IV64;
+
+        __m256i m[ 16 ];
+        load_transposed( p, m );
+
+        __m256i v[ 16 ];
+
+        for( int i = 0; i < 8; ++i )
+        {
+            v[ i ] = _mm256_loadu_si256( reinterpret_cast<__m256i const*>( h[ i ] ) );
+            v[ i + 8 ] = _mm256_set1_epi64x( static_cast<long long>( IV[ i ] ) );
+        }
+
+        v[ 12 ] = _mm256_xor_si256( v[ 12 ], _mm256_set1_epi64x( static_cast<long long>( t ) ) );
+
+        for( int r = 0; r < 12; ++r )
+        {
+            unsigned char const * s = blake2_constants<>::sigma[ r ];
+
+            G( v[ 0 ], v[ 4 ], v[  8 ], v[ 12 ], m[ s[  0 ] ], m[ s[  1 ] ] );
+            G( v[ 1 ], v[ 5 ], v[  9 ], v[ 13 ], m[ s[  2 ] ], m[ s[  3 ] ] );
+            G( v[ 2 ], v[ 6 ], v[ 10 ], v[ 14 ], m[ s[  4 ] ], m[ s[  5 ] ] );
+            G( v[ 3 ], v[ 7 ], v[ 11 ], v[ 15 ], m[ s[  6 ] ], m[ s[  7 ] ] );
+
+            G( v[ 0 ], v[ 5 ], v[ 10 ], v[ 15 ], m[ s[  8 ] ], m[ s[  9 ] ] );
+            G( v[ 1 ], v[ 6 ], v[ 11 ], v[ 12 ], m[ s[ 10 ] ], m[ s[ 11 ] ] );
+            G( v[ 2 ], v[ 7 ], v[  8 ], v[ 13 ], m[ s[ 12 ] ], m[ s[ 13 ] ] );
+            G( v[ 3 ], v[ 4 ], v[  9 ], v[ 14 ], m[ s[ 14 ] ], m[ s[ 15 ] ] );
+        }
+
+        for( int i = 0; i < 8; ++i )
+        {
+            __m256i x = _mm256_loadu_si256( reinterpret_cast<__m256i const*>( h[ i ] ) );
+            x = _mm256_xor_si256( x, _mm256_xor_si256( v[ i ], v[ i + 8 ] ) );
+            _mm256_storeu_si256( reinterpret_cast<__m256i*>( h[ i ] ), x );
+        }
+    }
+
+#else
+
+    static void compress_lanes( std::uint64_t h[ 8 ][ 4 ], unsigned char const * const p[ 4 ], std::uint64_t t )
+    {
+        for( int j = 0; j < 4; ++j )
+        {
+            std::uint64_t hj[ 8 ];
+
+            for( int i = 0; i < 8; ++i ) hj[ i ] = h[ i ][ j ];
+
+            compress( hj, p[ j ], t, false, false );
+
+            for( int i = 0; i < 8; ++i ) h[ i ][ j ] = hj[ i ];
+        }
+    }
+
+#endif // #if defined(BOOST_HASH2_HAS_AVX2)
+
+    static void compress( std::uint64_t h[ 8 ], unsigned char const block[ 128 ], std::uint64_t t, bool last, bool last_node )
+    {
+#if defined(BOOST_HASH2_HAS_AVX2)
+
+        compress_avx2( h, block, t, last, last_node );
+
+#else
+
+        compress_scalar( h, block, t, last, last_node );
+
+#endif
+    }
+};
+
+struct blake2s_kernel
+{
+    typedef std::uint32_t word_type;
+
+    static const int block_size = 64;
+    static const int max_digest_size = 32;
+    static const int max_key_size = 32;
+    static const int lanes = 8;
+
+    static void init( std::uint32_t h[ 8 ], int digest_size, int key_size, int fanout, int depth, std::uint64_t node_offset, int node_depth, int inner_size )
+    {
+        std::uint32_t const * IV = blake2_constants<>::IV32;
+
+        for( int i = 0; i < 8; ++i )
+        {
+            h[ i ] = IV[ i ];
+        }
+
+        h[ 0 ] ^= static_cast<std::uint32_t>( digest_size | key_size << 8 | fanout << 16 | depth << 24 );
+        h[ 2 ] ^= static_cast<std::uint32_t>( node_offset );
+        h[ 3 ] ^= static_cast<std::uint32_t>( node_offset >> 32 ) ^ static_cast<std::uint32_t>( node_depth << 16 | inner_size << 24 );
+    }
+
+    static BOOST_FORCEINLINE void G( std::uint32_t v[ 16 ], int a, int b, int c, int d, std::uint32_t x, std::uint32_t y )
+    {
+        v[ a ] = v[ a ] + v[ b ] + x;
+        v[ d ] = detail::rotr( v[ d ] ^ v[ a ], 16 );
+        v[ c ] = v[ c ] + v[ d ];
+        v[ b ] = detail::rotr( v[ b ] ^ v[ c ], 12 );
+        v[ a ] = v[ a ] + v[ b ] + y;
+        v[ d ] = detail::rotr( v[ d ] ^ v[ a ], 8 );
+        v[ c ] = v[ c ] + v[ d ];
+        v[ b ] = detail::rotr( v[ b ] ^ v[ c ], 7 );
+    }
+
+    static void compress_scalar( std::uint32_t h[ 8 ], unsigned char const block[ 64 ], std::uint64_t t, bool last, bool last_node )
+    {
+        std::uint32_t const * IV = blake2_constants<>::IV32;
+
+        std::uint32_t m[ 16 ];
+
+        for( int i = 0; i < 16; ++i )
+        {
+            m[ i ] = detail::read32le( block + i * 4 );
+        }
+
+        std::uint32_t v[ 16 ] =
+        {
+            h[ 0 ], h[ 1 ], h[ 2 ], h[ 3 ], h[ 4 ], h[ 5 ], h[ 6 ], h[ 7 ],
+            IV[ 0 ], IV[ 1 ], IV[ 2 ], IV[ 3 ],
+            IV[ 4 ] ^ static_cast<std::uint32_t>( t ), IV[ 5 ] ^ static_cast<std::uint32_t>( t >> 32 ),
+            IV[ 6 ] ^ ( last? ~std::uint32_t(): 0 ), IV[ 7 ] ^ ( last_node? ~std::uint32_t(): 0 )
+        };
+
+        for( int r = 0; r < 10; ++r )
+        {
+            unsigned char const * s = blake2_constants<>::sigma[ r ];
+
+            G( v, 0, 4,  8, 12, m[ s[  0 ] ], m[ s[  1 ] ] );
+            G( v, 1, 5,  9, 13, m[ s[  2 ] ], m[ s[  3 ] ] );
+            G( v, 2, 6, 10, 14, m[ s[  4 ] ], m[ s[  5 ] ] );
+            G( v, 3, 7, 11, 15, m[ s[  6 ] ], m[ s[  7 ] ] );
+
+            G( v, 0, 5, 10, 15, m[ s[  8 ] ], m[ s[  9 ] ] );
+            G( v, 1, 6, 11, 12, m[ s[ 10 ] ], m[ s[ 11 ] ] );
+            G( v, 2, 7,  8, 13, m[ s[ 12 ] ], m[ s[ 13 ] ] );
+            G( v, 3, 4,  9, 14, m[ s[ 14 ] ], m[ s[ 15 ] ] );
+        }
+
+        for( int i = 0; i < 8; ++i )
+        {
+            h[ i ] ^= v[ i ] ^ v[ i + 8 ];
+        }
+    }
+
+#if defined(BOOST_HASH2_HAS_SSSE3)
+
+    static BOOST_FORCEINLINE __m128i rotr16( __m128i x )
+    {
+#if defined(BOOST_HASH2_HAS_AVX512)
+
+        return _mm_ror_epi32( x, 16 );
+
+#else
+
+        __m128i const mask = _mm_setr_epi8( 2, 3, 0, 1, 6, 7, 4, 5, 10, 11, 8, 9, 14, 15, 12, 13 );
+        return _mm_shuffle_epi8( x, mask );
+
+#endif
+    }
+
+    static BOOST_FORCEINLINE __m128i rotr12( __m128i x )
+    {
+#if defined(BOOST_HASH2_HAS_AVX512)
+
+        return _mm_ror_epi32( x, 12 );
+
+#else
+
+        return _mm_or_si128( _mm_srli_epi32( x, 12 ), _mm_slli_epi32( x, 20 ) );
+
+#endif
+    }
+
+    static BOOST_FORCEINLINE __m128i rotr8( __m128i x )
+    {
+#if defined(BOOST_HASH2_HAS_AVX512)
+
+        return _mm_ror_epi32( x, 8 );
+
+#else
+
+        __m128i const mask = _mm_setr_epi8( 1, 2, 3, 0, 5, 6, 7, 4, 9, 10, 11, 8, 13, 14, 15, 12 );
+        return _mm_shuffle_epi8( x, mask );
+
+#endif
+    }
+
+    static BOOST_FORCEINLINE __m128i rotr7( __m128i x )
+    {
+#if defined(BOOST_HASH2_HAS_AVX512)
+
+        return _mm_ror_epi32( x, 7 );
+
+#else
+
+        return _mm_or_si128( _mm_srli_epi32( x, 7 ), _mm_slli_epi32( x, 25 ) );
+
+#endif
+    }
+
+    static BOOST_FORCEINLINE void G( __m128i & a, __m128i & b, __m128i & c, __m128i & d, __m128i x, __m128i y )
+    {
+        a = _mm_add_epi32( _mm_add_epi32( a, b ), x );
+        d = rotr16( _mm_xor_si128( d, a ) );
+        c = _mm_add_epi32( c, d );
+        b = rotr12( _mm_xor_si128( b, c ) );
+        a = _mm_add_epi32( _mm_add_epi32( a, b ), y );
+        d = rotr8( _mm_xor_si128( d, a ) );
+        c = _mm_add_epi32( c, d );
+        b = rotr7( _mm_xor_si128( b, c ) );
+    }
+
+    static BOOST_FORCEINLINE __m128i gather( std::uint32_t const m[ 16 ], unsigned char const * s )
+    {
+        return _mm_set_epi32( static_cast<int>( m[ s[ 6 ] ] ), static_cast<int>( m[ s[ 4 ] ] ), static_cast<int>( m[ s[ 2 ] ] ), static_cast<int>( m[ s[ 0 ] ] ) );
+    }
+
+    static void compress_ssse3( std::uint32_t h[ 8 ], unsigned char const block[ 64 ], std::uint64_t t, bool last, bool last_node )
+    {
+        std::uint32_t const * IV = blake2_constants<>::IV32;
+
+        std::uint32_t m[ 16 ];
+        std::memcpy( m, block, 64 ); // x86 is little endian
+
+        __m128i a = _mm_loadu_si128( reinterpret_cast<__m128i const*>( h + 0 ) );
+        __m128i b = _mm_loadu_si128( reinterpret_cast<__m128i const*>( h + 4 ) );
+        __m128i c = _mm_loadu_si128( reinterpret_cast<__m128i const*>( IV + 0 ) );
+
+        __m128i d = _mm_xor_si128(
+            _mm_loadu_si128( reinterpret_cast<__m128i const*>( IV + 4 ) ),
+            _mm_set_epi32( last_node? -1: 0, last? -1: 0, static_cast<int>( t >> 32 ), static_cast<int>( t ) ) );
+
+        __m128i const a0 = a, b0 = b;
+
+        for( int r = 0; r < 10; ++r )
+        {
+            unsigned char const * s = blake2_constants<>::sigma[ r ];
+
+            G( a, b, c, d, gather( m, s + 0 ), gather( m, s + 1 ) );
+
+            b = _mm_shuffle_epi32( b, _MM_SHUFFLE( 0, 3, 2, 1 ) );
+            c = _mm_shuffle_epi32( c, _MM_SHUFFLE( 1, 0, 3, 2 ) );
+            d = _mm_shuffle_epi32( d, _MM_SHUFFLE( 2, 1, 0, 3 ) );
+
+            G( a, b, c, d, gather( m, s + 8 ), gather( m, s + 9 ) );
+
+            b = _mm_shuffle_epi32( b, _MM_SHUFFLE( 2, 1, 0, 3 ) );
+            c = _mm_shuffle_epi32( c, _MM_SHUFFLE( 1, 0, 3, 2 ) );
+            d = _mm_shuffle_epi32( d, _MM_SHUFFLE( 0, 3, 2, 1 ) );
+        }
+
+        a = _mm_xor_si128( a0, _mm_xor_si128( a, c ) );
+        b = _mm_xor_si128( b0, _mm_xor_si128( b, d ) );
+
+        _mm_storeu_si128( reinterpret_cast<__m128i*>( h + 0 ), a );
+        _mm_storeu_si128( reinterpret_cast<__m128i*>( h + 4 ), b );
+    }
+
+#endif // #if defined(BOOST_HASH2_HAS_SSSE3)
+
+    static void compress( std::uint32_t h[ 8 ], unsigned char const block[ 64 ], std::uint64_t t, bool last, bool last_node )
+    {
+#if defined(BOOST_HASH2_HAS_SSSE3)
+
+        compress_ssse3( h, block, t, last, last_node );
+
+#else
+
+        compress_scalar( h, block, t, last, last_node );
+
+#endif
+    }
+
+#if defined(BOOST_HASH2_HAS_SSE2)
+
+    static BOOST_FORCEINLINE void G( u32x8 & a, u32x8 & b, u32x8 & c, u32x8 & d, u32x8 x, u32x8 y )
+    {
+        a = a + b + x;
+        d = rotl<16>( d ^ a );
+        c = c + d;
+        b = rotl<20>( b ^ c );
+        a = a + b + y;
+        d = rotl<24>( d ^ a );
+        c = c + d;
+        b = rotl<25>( b ^ c );
+    }
+
+    static void compress_lanes( std::uint32_t h[ 8 ][ 8 ], unsigned char const * const p[ 8 ], std::uint64_t t )
+    {
+        std::uint32_t const * IV = blake2_constants<>::IV32;
+
+        u32x8 m[ 16 ];
+        load_u32x8_transposed( p, 0, m );
+
+        u32x8 v[ 16 ];
+
+        for( int i = 0; i < 8; ++i )
+        {
+            v[ i ] = load_u32x8( h[ i ] );
+            v[ i + 8 ] = set1_u32x8( IV[ i ] );
+        }
+
+        v[ 12 ] = v[ 12 ] ^ set1_u32x8( static_cast<std::uint32_t>( t ) );
+        v[ 13 ] = v[ 13 ] ^ set1_u32x8( static_cast<std::uint32_t>( t >> 32 ) );
+
+        for( int r = 0; r < 10; ++r )
+        {
+            unsigned char const * s = blake2_constants<>::sigma[ r ];
+
+            G( v[ 0 ], v[ 4 ], v[  8 ], v[ 12 ], m[ s[  0 ] ], m[ s[  1 ] ] );
+            G( v[ 1 ], v[ 5 ], v[  9 ], v[ 13 ], m[ s[  2 ] ], m[ s[  3 ] ] );
+            G( v[ 2 ], v[ 6 ], v[ 10 ], v[ 14 ], m[ s[  4 ] ], m[ s[  5 ] ] );
+            G( v[ 3 ], v[ 7 ], v[ 11 ], v[ 15 ], m[ s[  6 ] ], m[ s[  7 ] ] );
+
+            G( v[ 0 ], v[ 5 ], v[ 10 ], v[ 15 ], m[ s[  8 ] ], m[ s[  9 ] ] );
+            G( v[ 1 ], v[ 6 ], v[ 11 ], v[ 12 ], m[ s[ 10 ] ], m[ s[ 11 ] ] );
+            G( v[ 2 ], v[ 7 ], v[  8 ], v[ 13 ], m[ s[ 12 ] ], m[ s[ 13 ] ] );
+            G( v[ 3 ], v[ 4 ], v[  9 ], v[ 14 ], m[ s[ 14 ] ], m[ s[ 15 ] ] );
+        }
+
+        for( int i = 0; i < 8; ++i )
+        {
+            store_u32x8( h[ i ], load_u32x8( h[ i ] ) ^ v[ i ] ^ v[ i + 8 ] );
+        }
+    }
+
+#else
+
+    static void compress_lanes( std::uint32_t h[ 8 ][ 8 ], unsigned char const * const p[ 8 ], std::uint64_t t )
+    {
+        for( int j = 0; j < 8; ++j )
+        {
+            std::uint32_t hj[ 8 ];
+
+            for( int i = 0; i < 8; ++i ) hj[ i ] = h[ i ][ j ];
+
+            compress( hj, p[ j ], t, false, false );
+
+            for( int i = 0; i < 8; ++i ) h[ i ][ j ] = hj[ i ];
+        }
+    }
+
+#endif // #if defined(BOOST_HASH2_HAS_SSE2)
+};
+
+// sequential mode
+
+template<class K> class blake2_base
+{
+private:
+
+    typedef typename K::word_type word_type;
+
+    static const int N = K::block_size;
+
+    word_type state_[ 8 ];
+
+    unsigned char buffer_[ N ];
+    std::size_t m_; // 0..N; a full block is kept until more input arrives
+
+    std::uint64_t n_; // compressed bytes
+
+    int digest_size_;
+
+private:
+
+    void init( unsigned char const * key, std::size_t n )
+    {
+        BOOST_ASSERT( n <= static_cast<std::size_t>( K::max_key_size ) );
+
+        K::init( state_, digest_size_, static_cast<int>( n ), 1, 1, 0, 0, 0 );
+
+        std::memset( buffer_, 0, N );
+        m_ = 0;
+
+        n_ = 0;
+
+        if( n != 0 )
+        {
+            // the key, padded to a full block, is the first block
+
+            std::memcpy( buffer_, key, n );
+            m_ = N;
+        }
+    }
+
+protected:
+
+    explicit blake2_base( int digest_size ): digest_size_( digest_size )
+    {
+        init( 0, 0 );
+    }
+
+    // a nonzero seed is used as an eight byte key
+    blake2_base( int digest_size, std::uint64_t seed ): digest_size_( digest_size )
+    {
+        if( seed == 0 )
+        {
+            init( 0, 0 );
+        }
+        else
+        {
+            unsigned char key[ 8 ];
+            detail::write64le( key, seed );
+
+            init( key, 8 );
+        }
+    }
+
+    // a byte seed is the key; the part of it that doesn't fit in a key
+    // is processed as input
+
+    blake2_base( int digest_size, unsigned char const * p, std::size_t n ): digest_size_( digest_size )
+    {
+        std::size_t const M = K::max_key_size;
+
+        if( n <= M )
+        {
+            init( p, n );
+        }
+        else
+        {
+            init( p, M );
+
+            update( p + M, n - M );
+
+            unsigned char tmp[ M ];
+            finalize( tmp );
+        }
+    }
+
+    // writes digest_size bytes to out
+    void finalize( unsigned char * out )
+    {
+        n_ += m_;
+
+        K::compress( state_, buffer_, n_, true, false );
+
+        std::memset( buffer_, 0, N );
+        m_ = 0;
+
+        // subsequent calls continue from the finalized state
+
+        unsigned char tmp[ 8 * sizeof( word_type ) ];
+
+        for( int i = 0; i < 8; ++i )
+        {
+            write_word( tmp + i * sizeof( word_type ), state_[ i ] );
+        }
+
+        std::memcpy( out, tmp, digest_size_ );
+    }
+
+    static void write_word( unsigned char * p, std::uint64_t v )
+    {
+        detail::write64le( p, v );
+    }
+
+    static void write_word( unsigned char * p, std::uint32_t v )
+    {
+        detail::write32le( p, v );
+    }
+
+public:
+
+    typedef std::uint64_t size_type;
+
+    static const int block_size = N;
+
+    void update( void const * pv, std::size_t n )
+    {
+        unsigned char const* p = static_cast<unsigned char const*>( pv );
+
+        while( n > 0 )
+        {
+            if( m_ == N )
+            {
+                n_ += N;
+                K::compress( state_, buffer_, n_, false, false );
+
+                std::memset( buffer_, 0, N );
+                m_ = 0;
+            }
+
+            if( m_ == 0 )
+            {
+                while( n > N )
+                {
+                    n_ += N;
+                    K::compress( state_, p, n_, false, false );
+
+                    p += N;
+                    n -= N;
+                }
+            }
+
+            std::size_t k = N - m_;
+
+            if( n < k )
+            {
+                k = n;
+            }
+
+            std::memcpy( buffer_ + m_, p, k );
+
+            p += k;
+            n -= k;
+            m_ += k;
+        }
+    }
+};
+
+// parallel mode; the input is split into blocks, which are distributed
+// round robin to K::lanes leaves, hashed in parallel, one block of each
+// leaf at a time
+
+template<class K> class blake2p_base
+{
+private:
+
+    typedef typename K::word_type word_type;
+
+    static const int N = K::block_size;
+    static const int L = K::lanes;
+    static const int S = N * L; // stripe
+
+    static const int D = K::max_digest_size;
+
+    word_type state_[ 8 ][ L ]; // word i of leaf j is state_[ i ][ j ]
+
+    unsigned char key_[ N ];
+    std::size_t key_size_;
+
+    bool key_pending_; // the key block hasn't been compressed yet
+
+    unsigned char buffer_[ 2 * S ];
+    std::size_t m_; // 0..2*S
+
+    std::uint64_t n_; // compressed bytes, per leaf
+
+private:
+
+    void init( unsigned char const * key, std::size_t n )
+    {
+        BOOST_ASSERT( n <= static_cast<std::size_t>( K::max_key_size ) );
+
+        for( int j = 0; j < L; ++j )
+        {
+            word_type h[ 8 ];
+            K::init( h, D, static_cast<int>( n ), L, 2, j, 0, D );
+
+            for( int i = 0; i < 8; ++i ) state_[ i ][ j ] = h[ i ];
+        }
+
+        std::memset( key_, 0, N );
+
+        if( n != 0 )
+        {
+            std::memcpy( key_, key, n );
+        }
+
+        key_size_ = n;
+        key_pending_ = n != 0;
+
+        std::memset( buffer_, 0, 2 * S );
+        m_ = 0;
+
+        n_ = 0;
+    }
+
+    void compress_stripe( unsigned char const * p )
+    {
+        unsigned char const * q[ L ];
+
+        if( key_pending_ )
+        {
+            for( int j = 0; j < L; ++j )
+            {
+                q[ j ] = key_;
+            }
+
+            n_ += N;
+            K::compress_lanes( state_, q, n_ );
+
+            key_pending_ = false;
+        }
+
+        for( int j = 0; j < L; ++j )
+        {
+            q[ j ] = p + j * N;
+        }
+
+        n_ += N;
+        K::compress_lanes( state_, q, n_ );
+    }
+
+    static void write_word( unsigned char * p, std::uint64_t v )
+    {
+        detail::write64le( p, v );
+    }
+
+    static void write_word( unsigned char * p, std::uint32_t v )
+    {
+        detail::write32le( p, v );
+    }
+
+protected:
+
+    blake2p_base()
+    {
+        init( 0, 0 );
+    }
+
+    explicit blake2p_base( std::uint64_t seed )
+    {
+        if( seed == 0 )
+        {
+            init( 0, 0 );
+        }
+        else
+        {
+            unsigned char key[ 8 ];
+            detail::write64le( key, seed );
+
+            init( key, 8 );
+        }
+    }
+
+    blake2p_base( unsigned char const * p, std::size_t n )
+    {
+        std::size_t const M = K::max_key_size;
+
+        if( n <= M )
+        {
+            init( p, n );
+        }
+        else
+        {
+            init( p, M );
+
+            update( p + M, n - M );
+
+            unsigned char tmp[ D ];
+            finalize( tmp );
+        }
+    }
+
+    // writes D bytes to out
+    void finalize( unsigned char * out )
+    {
+        // finish the leaves
+
+        unsigned char leaves[ L * D ];
+
+        for( int j = 0; j < L; ++j )
+        {
+            word_type h[ 8 ];
+
+            for( int i = 0; i < 8; ++i ) h[ i ] = state_[ i ][ j ];
+
+            std::uint64_t t = n_;
+
+            bool last_node = j == L - 1;
+
+            // every compressed stripe is followed by more than a stripe
+            // of input, so the remaining blocks of each leaf are here
+
+            std::size_t k = 0;
+
+            for( std::size_t q = j * N; q < m_; q += S )
+            {
+                ++k;
+            }
+
+            BOOST_ASSERT( k > 0 || n_ == 0 );
+
+            if( key_pending_ )
+            {
+                t += N;
+                K::compress( h, key_, t, k == 0, k == 0 && last_node );
+            }
+            else if( k == 0 )
+            {
+                // an empty leaf
+
+                unsigned char block[ N ] = {};
+                K::compress( h, block, 0, true, last_node );
+            }
+
+            for( std::size_t i = 0; i < k; ++i )
+            {
+                std::size_t q = j * N + i * S;
+
+                std::size_t r = m_ - q;
+
+                if( r > N )
+                {
+                    r = N;
+                }
+
+                t += r;
+                K::compress( h, buffer_ + q, t, i + 1 == k, i + 1 == k && last_node );
+            }
+
+            for( int i = 0; i < 8; ++i )
+            {
+                write_word( leaves + j * D + i * sizeof( word_type ), h[ i ] );
+            }
+        }
+
+        // and the root
+
+        word_type h[ 8 ];
+        K::init( h, D, static_cast<int>( key_size_ ), L, 2, 0, 1, D );
+
+        int const R = L * D / N;
+
+        for( int i = 0; i < R; ++i )
+        {
+            K::compress( h, leaves + i * N, static_cast<std::uint64_t>( i + 1 ) * N, i + 1 == R, i + 1 == R );
+        }
+
+        for( int i = 0; i < D / static_cast<int>( sizeof( word_type ) ); ++i )
+        {
+            write_word( out + i * sizeof( word_type ), h[ i ] );
+        }
+
+        // subsequent calls continue keyed with the result
+
+        init( out, D );
+    }
+
+public:
+
+    typedef std::uint64_t size_type;
+
+    void update( void const * pv, std::size_t n )
+    {
+        unsigned char const* p = static_cast<unsigned char const*>( pv );
+
+        while( n > 0 )
+        {
+            // a stripe is compressed only when more than a stripe of input
+            // follows it, so that it doesn't contain the last block of a leaf
+
+            while( m_ >= S && m_ - S + n > S )
+            {
+                compress_stripe( buffer_ );
+
+                std::memcpy( buffer_, buffer_ + S, m_ - S );
+                m_ -= S;
+
+                std::memset( buffer_ + m_, 0, 2 * S - m_ );
+            }
+
+            if( m_ == 0 )
+            {
+                while( n > 2 * S )
+                {
+                    compress_stripe( p );
+
+                    p += S;
+                    n -= S;
+                }
+            }
+
+            std::size_t k = 2 * S - m_;
+
+            if( n < k )
+            {
+                k = n;
+            }
+
+            std::memcpy( buffer_ + m_, p, k );
+
+            p += k;
+            n -= k;
+            m_ += k;
+        }
+    }
+};
+
+} // namespace detail
+
+// BLAKE2b with a digest of Bits bits, up to 512
+
+template<std::size_t Bits> class basic_blake2b: public detail::blake2_base<detail::blake2b_kernel>
+{
+private:
+
+    static_assert( Bits % 8 == 0 && Bits >= 8 && Bits <= 512, "Bits must be a multiple of 8 between 8 and 512" );
+
+    typedef detail::blake2_base<detail::blake2b_kernel> base_type;
+
+public:
+
+    typedef std::array<unsigned char, Bits / 8> result_type;
+
+    basic_blake2b(): base_type( Bits / 8 )
+    {
+    }
+
+    explicit basic_blake2b( std::uint64_t seed ): base_type( Bits / 8, seed )
+    {
+    }
+
+    basic_blake2b( unsigned char const * p, std::size_t n ): base_type( Bits / 8, p, n )
+    {
+    }
+
+    result_type result()
+    {
+        result_type digest;
+        finalize( &digest[ 0 ] );
+
+        return digest;
+    }
+};
+
+// BLAKE2s with a digest of Bits bits, up to 256
+
+template<std::size_t Bits> class basic_blake2s: public detail::blake2_base<detail::blake2s_kernel>
+{
+private:
+
+    static_assert( Bits % 8 == 0 && Bits >= 8 && Bits <= 256, "Bits must be a multiple of 8 between 8 and 256" );
+
+    typedef detail::blake2_base<detail::blake2s_kernel> base_type;
+
+public:
+
+    typedef std::array<unsigned char, Bits / 8> result_type;
+
+    basic_blake2s(): base_type( Bits / 8 )
+    {
+    }
+
+    explicit basic_blake2s( std::uint64_t seed ): base_type( Bits / 8, seed )
+    {
+    }
+
+    basic_blake2s( unsigned char const * p, std::size_t n ): base_type( Bits / 8, p, n )
+    {
+    }
+
+    result_type result()
+    {
+        result_type digest;
+        finalize( &digest[ 0 ] );
+
+        return digest;
+    }
+};
+
+typedef basic_blake2b<512> blake2b_512;
+typedef basic_blake2b<256> blake2b_256;
+
+typedef basic_blake2s<256> blake2s_256;
+typedef basic_blake2s<128> blake2s_128;
+
+// BLAKE2bp, four BLAKE2b leaves
+
+class blake2bp_512: public detail::blake2p_base<detail::blake2b_kernel>
+{
+private:
+
+    typedef detail::blake2p_base<detail::blake2b_kernel> base_type;
+
+public:
+
+    typedef std::array<unsigned char, 64> result_type;
+
+    blake2bp_512()
+    {
+    }
+
+    explicit blake2bp_512( std::uint64_t seed ): base_type( seed )
+    {
+    }
+
+    blake2bp_512( unsigned char const * p, std::size_t n ): base_type( p, n )
+    {
+    }
+
+    result_type result()
+    {
+        result_type digest;
+        finalize( &digest[ 0 ] );
+
+        return digest;
+    }
+};
+
+// BLAKE2sp, eight BLAKE2s leaves
+
+class blake2sp_256: public detail::blake2p_base<detail::blake2s_kernel>
+{
+private:
+
+    typedef detail::blake2p_base<detail::blake2s_kernel> base_type;
+
+public:
+
+    typedef std::array<unsigned char, 32> result_type;
+
+    blake2sp_256()
+    {
+    }
+
+    explicit blake2sp_256( std::uint64_t seed ): base_type( seed )
+    {
+    }
+
+    blake2sp_256( unsigned char const * p, std::size_t n ): base_type( p, n )
+    {
+    }
+
+    result_type result()
+    {
+        result_type digest;
+        finalize( &digest[ 0 ] );
+
+        return digest;
+    }
+};
+
+} // namespace hash2
+} // namespace boost
+
+#endif // #ifndef BOOST_HASH2_BLAKE2_HPP_INCLUDED
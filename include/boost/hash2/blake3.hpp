@@ -0,0 +1,754 @@
+#ifndef BOOST_HASH2_BLAKE3_HPP_INCLUDED
+#define BOOST_HASH2_BLAKE3_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// BLAKE3, https://github.com/BLAKE3-team/BLAKE3-specs
+
+#include <boost/hash2/detail/u32x8.hpp>
+#include <boost/hash2/detail/read.hpp>
+#include <boost/hash2/detail/write.hpp>
+#include <boost/hash2/detail/rot.hpp>
+#include <boost/hash2/detail/config.hpp>
+#include <boost/assert.hpp>
+#include <boost/config.hpp>
+#include <thread>
+#include <cstdint>
+#include <array>
+#include <cstring>
+#include <cstddef>
+
+namespace boost
+{
+namespace hash2
+{
+namespace detail
+{
+
+template<class = void> struct blake3_constants
+{
+    static const std::uint32_t IV[ 8 ];
+    static const unsigned char schedule[ 7 ][ 16 ];
+};
+
+template<class T> const std::uint32_t blake3_constants<T>::IV[ 8 ] =
+{
+    0x6a09e667u, 0xbb67ae85u, 0x3c6ef372u, 0xa54ff53au, 0x510e527fu, 0x9b05688cu, 0x1f83d9abu, 0x5be0cd19u
+};
+
+// message word order for each round; the permutation applied repeatedly
+
+template<class T> const unsigned char blake3_constants<T>::schedule[ 7 ][ 16 ] =
+{
+    {  0,  1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 13, 14, 15 },
+    {  2,  6,  3, 10,  7,  0,  4, 13,  1, 11, 12,  5,  9, 14, 15,  8 },
+    {  3,  4, 10, 12, 13,  2,  7, 14,  6,  5,  9,  0, 11, 15,  8,  1 },
+    { 10,  7, 12,  9, 14,  3, 13, 15,  4,  0, 11,  2,  5,  8,  1,  6 },
+    { 12, 13,  9, 11, 15, 10, 14,  8,  7,  2,  5,  3,  0,  1,  6,  4 },
+    {  9, 14, 11,  5,  8, 12, 15,  1, 13,  3,  0, 10,  2,  6,  4,  7 },
+    { 11, 15,  5,  0,  1,  9,  8,  6, 14, 10,  2, 12,  3,  4,  7, 13 },
+};
+
+} // namespace detail
+
+// result() returns the first 32 bytes of the extendable output;
+// result( p, n ) writes the first n bytes. Either one then rekeys the
+// hash from a part of the output not returned by result(), so that
+// subsequent results differ.
+
+class blake3
+{
+private:
+
+    static const std::uint32_t CHUNK_START = 1;
+    static const std::uint32_t CHUNK_END = 2;
+    static const std::uint32_t PARENT = 4;
+    static const std::uint32_t ROOT = 8;
+    static const std::uint32_t KEYED_HASH = 16;
+
+    static const std::size_t B = 64; // block length
+    static const std::size_t C = 1024; // chunk length
+
+    static const int max_depth = 54;
+
+    std::uint32_t key_[ 8 ];
+    std::uint32_t flags_;
+
+    // the current chunk
+
+    std::uint32_t cv_[ 8 ];
+    std::uint64_t chunk_counter_;
+
+    unsigned char buffer_[ B ];
+    std::size_t m_; // bytes in buffer_, 0..B
+
+    std::size_t blocks_; // compressed blocks in the current chunk
+
+    // chaining values of the completed subtrees, merged lazily,
+    // so that the last one is never merged before it's known not
+    // to be the root
+
+    std::uint32_t stack_[ max_depth + 1 ][ 8 ];
+    std::size_t stack_size_;
+
+private:
+
+    static BOOST_FORCEINLINE void G( std::uint32_t v[ 16 ], int a, int b, int c, int d, std::uint32_t x, std::uint32_t y )
+    {
+        v[ a ] = v[ a ] + v[ b ] + x;
+        v[ d ] = detail::rotl( v[ d ] ^ v[ a ], 16 );
+        v[ c ] = v[ c ] + v[ d ];
+        v[ b ] = detail::rotl( v[ b ] ^ v[ c ], 20 );
+        v[ a ] = v[ a ] + v[ b ] + y;
+        v[ d ] = detail::rotl( v[ d ] ^ v[ a ], 24 );
+        v[ c ] = v[ c ] + v[ d ];
+        v[ b ] = detail::rotl( v[ b ] ^ v[ c ], 25 );
+    }
+
+    static void compress( std::uint32_t const cv[ 8 ], std::uint32_t const w[ 16 ], std::uint64_t counter, std::uint32_t len, std::uint32_t flags, std::uint32_t out[ 16 ] )
+    {
+        std::uint32_t const * IV = detail::blake3_constants<>::IV;
+
+        std::uint32_t v[ 16 ] =
+        {
+            cv[ 0 ], cv[ 1 ], cv[ 2 ], cv[ 3 ], cv[ 4 ], cv[ 5 ], cv[ 6 ], cv[ 7 ],
+            IV[ 0 ], IV[ 1 ], IV[ 2 ], IV[ 3 ],
+            static_cast<std::uint32_t>( counter ), static_cast<std::uint32_t>( counter >> 32 ), len, flags
+        };
+
+        for( int r = 0; r < 7; ++r )
+        {
+            unsigned char const * s = detail::blake3_constants<>::schedule[ r ];
+
+            G( v, 0, 4,  8, 12, w[ s[  0 ] ], w[ s[  1 ] ] );
+            G( v, 1, 5,  9, 13, w[ s[  2 ] ], w[ s[  3 ] ] );
+            G( v, 2, 6, 10, 14, w[ s[  4 ] ], w[ s[  5 ] ] );
+            G( v, 3, 7, 11, 15, w[ s[  6 ] ], w[ s[  7 ] ] );
+
+            G( v, 0, 5, 10, 15, w[ s[  8 ] ], w[ s[  9 ] ] );
+            G( v, 1, 6, 11, 12, w[ s[ 10 ] ], w[ s[ 11 ] ] );
+            G( v, 2, 7,  8, 13, w[ s[ 12 ] ], w[ s[ 13 ] ] );
+            G( v, 3, 4,  9, 14, w[ s[ 14 ] ], w[ s[ 15 ] ] );
+        }
+
+        for( int i = 0; i < 8; ++i )
+        {
+            out[ i ] = v[ i ] ^ v[ i + 8 ];
+            out[ i + 8 ] = v[ i + 8 ] ^ cv[ i ];
+        }
+    }
+
+    // chaining value of one full block, in place
+    static void compress_block( std::uint32_t cv[ 8 ], unsigned char const block[ B ], std::uint64_t counter, std::uint32_t flags )
+    {
+        std::uint32_t w[ 16 ];
+
+        for( int i = 0; i < 16; ++i )
+        {
+            w[ i ] = detail::read32le( block + i * 4 );
+        }
+
+        std::uint32_t out[ 16 ];
+        compress( cv, w, counter, B, flags, out );
+
+        std::memcpy( cv, out, 8 * sizeof( std::uint32_t ) );
+    }
+
+    // hashes an input of the given number of blocks, storing the chaining value at out
+
+    static void hash_one( unsigned char const * p, std::size_t blocks, std::uint32_t const key[ 8 ], std::uint64_t counter, std::uint32_t flags, std::uint32_t flags_start, std::uint32_t flags_end, unsigned char * out )
+    {
+        std::uint32_t cv[ 8 ];
+        std::memcpy( cv, key, sizeof( cv ) );
+
+        std::uint32_t f = flags | flags_start;
+
+        for( std::size_t i = 0; i < blocks; ++i )
+        {
+            if( i + 1 == blocks )
+            {
+                f |= flags_end;
+            }
+
+            compress_block( cv, p + i * B, counter, f );
+            f = flags;
+        }
+
+        for( int i = 0; i < 8; ++i )
+        {
+            detail::write32le( out + i * 4, cv[ i ] );
+        }
+    }
+
+#if defined(BOOST_HASH2_HAS_SSE2)
+
+    static BOOST_FORCEINLINE void G( detail::u32x8 v[ 16 ], int a, int b, int c, int d, detail::u32x8 x, detail::u32x8 y )
+    {
+        using namespace detail;
+
+        v[ a ] = v[ a ] + v[ b ] + x;
+        v[ d ] = rotl<16>( v[ d ] ^ v[ a ] );
+        v[ c ] = v[ c ] + v[ d ];
+        v[ b ] = rotl<20>( v[ b ] ^ v[ c ] );
+        v[ a ] = v[ a ] + v[ b ] + y;
+        v[ d ] = rotl<24>( v[ d ] ^ v[ a ] );
+        v[ c ] = v[ c ] + v[ d ];
+        v[ b ] = rotl<25>( v[ b ] ^ v[ c ] );
+    }
+
+    // hash_one for eight inputs at once, one in each lane
+
+    static void hash8( unsigned char const * const p[ 8 ], std::size_t blocks, std::uint32_t const key[ 8 ], std::uint64_t counter, bool increment_counter, std::uint32_t flags, std::uint32_t flags_start, std::uint32_t flags_end, unsigned char * out )
+    {
+        using namespace detail;
+
+        std::uint32_t const * IV = blake3_constants<>::IV;
+
+        u32x8 h[ 8 ];
+
+        for( int i = 0; i < 8; ++i )
+        {
+            h[ i ] = set1_u32x8( key[ i ] );
+        }
+
+        u32x8 counter_low, counter_high;
+
+        {
+            std::uint32_t lo[ 8 ], hi[ 8 ];
+
+            for( int j = 0; j < 8; ++j )
+            {
+                std::uint64_t c = counter + ( increment_counter? j: 0 );
+
+                lo[ j ] = static_cast<std::uint32_t>( c );
+                hi[ j ] = static_cast<std::uint32_t>( c >> 32 );
+            }
+
+            counter_low = load_u32x8( lo );
+            counter_high = load_u32x8( hi );
+        }
+
+        std::uint32_t f = flags | flags_start;
+
+        for( std::size_t i = 0; i < blocks; ++i )
+        {
+            if( i + 1 == blocks )
+            {
+                f |= flags_end;
+            }
+
+            u32x8 w[ 16 ];
+            load_u32x8_transposed( p, i * B, w );
+
+            u32x8 v[ 16 ] =
+            {
+                h[ 0 ], h[ 1 ], h[ 2 ], h[ 3 ], h[ 4 ], h[ 5 ], h[ 6 ], h[ 7 ],
+                set1_u32x8( IV[ 0 ] ), set1_u32x8( IV[ 1 ] ), set1_u32x8( IV[ 2 ] ), set1_u32x8( IV[ 3 ] ),
+                counter_low, counter_high, set1_u32x8( B ), set1_u32x8( f )
+            };
+
+            for( int r = 0; r < 7; ++r )
+            {
+                unsigned char const * s = blake3_constants<>::schedule[ r ];
+
+                G( v, 0, 4,  8, 12, w[ s[  0 ] ], w[ s[  1 ] ] );
+                G( v, 1, 5,  9, 13, w[ s[  2 ] ], w[ s[  3 ] ] );
+                G( v, 2, 6, 10, 14, w[ s[  4 ] ], w[ s[  5 ] ] );
+                G( v, 3, 7, 11, 15, w[ s[  6 ] ], w[ s[  7 ] ] );
+
+                G( v, 0, 5, 10, 15, w[ s[  8 ] ], w[ s[  9 ] ] );
+                G( v, 1, 6, 11, 12, w[ s[ 10 ] ], w[ s[ 11 ] ] );
+                G( v, 2, 7,  8, 13, w[ s[ 12 ] ], w[ s[ 13 ] ] );
+                G( v, 3, 4,  9, 14, w[ s[ 14 ] ], w[ s[ 15 ] ] );
+            }
+
+            for( int k = 0; k < 8; ++k )
+            {
+                h[ k ] = v[ k ] ^ v[ k + 8 ];
+            }
+
+            f = flags;
+        }
+
+        std::uint32_t cv[ 8 ][ 8 ];
+
+        for( int i = 0; i < 8; ++i )
+        {
+            store_u32x8( cv[ i ], h[ i ] );
+        }
+
+        for( int j = 0; j < 8; ++j )
+        {
+            for( int i = 0; i < 8; ++i )
+            {
+                detail::write32le( out + j * 32 + i * 4, cv[ i ][ j ] );
+            }
+        }
+    }
+
+#endif // #if defined(BOOST_HASH2_HAS_SSE2)
+
+    // hashes n inputs of equal length, spaced by stride bytes;
+    // the chaining values are stored consecutively at out
+    //
+    // out may coincide with p when stride >= 32
+
+    static void hash_many( unsigned char const * p, std::size_t n, std::size_t stride, std::size_t blocks, std::uint32_t const key[ 8 ], std::uint64_t counter, bool increment_counter, std::uint32_t flags, std::uint32_t flags_start, std::uint32_t flags_end, unsigned char * out )
+    {
+        std::size_t i = 0;
+
+#if defined(BOOST_HASH2_HAS_SSE2)
+
+        for( ; i + 8 <= n; i += 8 )
+        {
+            unsigned char const * q[ 8 ];
+
+            for( int j = 0; j < 8; ++j )
+            {
+                q[ j ] = p + ( i + j ) * stride;
+            }
+
+            hash8( q, blocks, key, counter + ( increment_counter? i: 0 ), increment_counter, flags, flags_start, flags_end, out + i * 32 );
+        }
+
+#endif
+
+        for( ; i < n; ++i )
+        {
+            hash_one( p + i * stride, blocks, key, counter + ( increment_counter? i: 0 ), flags, flags_start, flags_end, out + i * 32 );
+        }
+    }
+
+    void parent_cv( std::uint32_t const left[ 8 ], std::uint32_t const right[ 8 ], std::uint32_t out[ 8 ] ) const
+    {
+        std::uint32_t w[ 16 ];
+
+        std::memcpy( w + 0, left, 8 * sizeof( std::uint32_t ) );
+        std::memcpy( w + 8, right, 8 * sizeof( std::uint32_t ) );
+
+        std::uint32_t tmp[ 16 ];
+        compress( key_, w, 0, B, flags_ | PARENT, tmp );
+
+        std::memcpy( out, tmp, 8 * sizeof( std::uint32_t ) );
+    }
+
+    // chaining value of the subtree of n full chunks starting at p,
+    // n a power of two, known not to be the root
+
+    void subtree_cv( unsigned char const * p, std::uint64_t n, std::uint64_t counter, std::uint32_t out[ 8 ] ) const
+    {
+        std::size_t const M = 64;
+
+        if( n <= M )
+        {
+            unsigned char cvs[ M * 32 ];
+
+            std::size_t k = static_cast<std::size_t>( n );
+
+            hash_many( p, k, C, C / B, key_, counter, true, flags_, CHUNK_START, CHUNK_END, cvs );
+
+            while( k > 1 )
+            {
+                k /= 2;
+                hash_many( cvs, k, 64, 1, key_, 0, false, flags_ | PARENT, 0, 0, cvs );
+            }
+
+            for( int i = 0; i < 8; ++i )
+            {
+                out[ i ] = detail::read32le( cvs + i * 4 );
+            }
+        }
+        else
+        {
+            std::uint32_t left[ 8 ], right[ 8 ];
+
+            subtree_cv( p, n / 2, counter, left );
+            subtree_cv( p + n / 2 * C, n / 2, counter + n / 2, right );
+
+            parent_cv( left, right, out );
+        }
+    }
+
+    void subtree_cv_parallel( unsigned char const * p, std::uint64_t n, std::uint64_t counter, std::uint32_t out[ 8 ], unsigned threads ) const
+    {
+        // below 256K per thread, splitting doesn't pay off
+        if( threads < 2 || n < 512 )
+        {
+            subtree_cv( p, n, counter, out );
+            return;
+        }
+
+        std::uint32_t left[ 8 ], right[ 8 ];
+
+        std::thread th( [&]{ this->subtree_cv_parallel( p, n / 2, counter, left, threads / 2 ); } );
+
+        try
+        {
+            subtree_cv_parallel( p + n / 2 * C, n / 2, counter + n / 2, right, threads - threads / 2 );
+        }
+        catch( ... )
+        {
+            th.join();
+            throw;
+        }
+
+        th.join();
+
+        parent_cv( left, right, out );
+    }
+
+    static int popcount( std::uint64_t x )
+    {
+        int r = 0;
+
+        for( ; x != 0; x &= x - 1 )
+        {
+            ++r;
+        }
+
+        return r;
+    }
+
+    // merges the subtrees preceding chunk t that are known to be complete
+    void merge_stack( std::uint64_t t )
+    {
+        std::size_t k = static_cast<std::size_t>( popcount( t ) );
+
+        while( stack_size_ > k )
+        {
+            --stack_size_;
+            parent_cv( stack_[ stack_size_ - 1 ], stack_[ stack_size_ ], stack_[ stack_size_ - 1 ] );
+        }
+    }
+
+    // adds the chaining value of the subtree starting at chunk t
+    void push_cv( std::uint32_t const cv[ 8 ], std::uint64_t t )
+    {
+        merge_stack( t );
+
+        BOOST_ASSERT( stack_size_ <= static_cast<std::size_t>( max_depth ) );
+
+        std::memcpy( stack_[ stack_size_ ], cv, 8 * sizeof( std::uint32_t ) );
+        ++stack_size_;
+    }
+
+    void reset_chunk()
+    {
+        std::memcpy( cv_, key_, sizeof( cv_ ) );
+
+        std::memset( buffer_, 0, B );
+        m_ = 0;
+
+        blocks_ = 0;
+    }
+
+    void init( std::uint32_t const key[ 8 ], std::uint32_t flags )
+    {
+        std::memcpy( key_, key, sizeof( key_ ) );
+        flags_ = flags;
+
+        chunk_counter_ = 0;
+        stack_size_ = 0;
+
+        reset_chunk();
+    }
+
+    void init( unsigned char const key[ 32 ] )
+    {
+        std::uint32_t k[ 8 ];
+
+        for( int i = 0; i < 8; ++i )
+        {
+            k[ i ] = detail::read32le( key + i * 4 );
+        }
+
+        init( k, KEYED_HASH );
+    }
+
+    std::uint32_t chunk_start_flag() const
+    {
+        return blocks_ == 0? CHUNK_START: 0;
+    }
+
+    // feeds bytes into the current chunk, stopping when it's full
+    void update_chunk( unsigned char const * & p, std::size_t & n )
+    {
+        while( n > 0 && blocks_ * B + m_ < C )
+        {
+            if( m_ == B )
+            {
+                compress_block( cv_, buffer_, chunk_counter_, flags_ | chunk_start_flag() );
+                ++blocks_;
+
+                std::memset( buffer_, 0, B );
+                m_ = 0;
+
+                continue;
+            }
+
+            if( m_ == 0 && n > B && blocks_ < C / B - 1 )
+            {
+                // the last block of the chunk is always buffered
+                while( n > B && blocks_ < C / B - 1 )
+                {
+                    compress_block( cv_, p, chunk_counter_, flags_ | chunk_start_flag() );
+                    ++blocks_;
+
+                    p += B;
+                    n -= B;
+                }
+
+                continue;
+            }
+
+            std::size_t k = B - m_;
+
+            if( n < k )
+            {
+                k = n;
+            }
+
+            std::memcpy( buffer_ + m_, p, k );
+
+            p += k;
+            n -= k;
+            m_ += k;
+        }
+    }
+
+    template<class F> void update_( unsigned char const * p, std::size_t n, F subtree )
+    {
+        while( n > 0 )
+        {
+            if( blocks_ * B + m_ == C )
+            {
+                // the current chunk is complete, and more input follows
+
+                std::uint32_t cv[ 16 ];
+
+                std::uint32_t w[ 16 ];
+
+                for( int i = 0; i < 16; ++i )
+                {
+                    w[ i ] = detail::read32le( buffer_ + i * 4 );
+                }
+
+                compress( cv_, w, chunk_counter_, B, flags_ | CHUNK_END, cv );
+
+                push_cv( cv, chunk_counter_ );
+                ++chunk_counter_;
+
+                reset_chunk();
+            }
+
+            if( blocks_ == 0 && m_ == 0 && n > C )
+            {
+                // hash whole subtrees directly, leaving at least one byte
+                // for the current chunk
+
+                std::uint64_t k = ( n - 1 ) / C;
+
+                std::uint64_t chunks = 1;
+
+                while( chunks * 2 <= k )
+                {
+                    chunks *= 2;
+                }
+
+                // the subtree must be aligned with its position in the tree
+                while( chunk_counter_ & ( chunks - 1 ) )
+                {
+                    chunks /= 2;
+                }
+
+                std::uint32_t cv[ 8 ];
+                subtree( p, chunks, chunk_counter_, cv );
+
+                push_cv( cv, chunk_counter_ );
+                chunk_counter_ += chunks;
+
+                p += chunks * C;
+                n -= static_cast<std::size_t>( chunks * C );
+
+                continue;
+            }
+
+            update_chunk( p, n );
+
+            // the current chunk is now nonempty, so it's not the root
+            merge_stack( chunk_counter_ );
+        }
+    }
+
+    struct subtree_fn
+    {
+        blake3 const * this_;
+
+        void operator()( unsigned char const * p, std::uint64_t n, std::uint64_t counter, std::uint32_t out[ 8 ] ) const
+        {
+            this_->subtree_cv( p, n, counter, out );
+        }
+    };
+
+    struct subtree_parallel_fn
+    {
+        blake3 const * this_;
+        unsigned threads_;
+
+        void operator()( unsigned char const * p, std::uint64_t n, std::uint64_t counter, std::uint32_t out[ 8 ] ) const
+        {
+            this_->subtree_cv_parallel( p, n, counter, out, threads_ );
+        }
+    };
+
+public:
+
+    typedef std::array<unsigned char, 32> result_type;
+    typedef std::uint64_t size_type;
+
+    blake3()
+    {
+        init( detail::blake3_constants<>::IV, 0 );
+    }
+
+    // a nonzero seed selects the keyed mode, with the seed as the key
+
+    explicit blake3( std::uint64_t seed )
+    {
+        if( seed == 0 )
+        {
+            init( detail::blake3_constants<>::IV, 0 );
+        }
+        else
+        {
+            unsigned char key[ 32 ] = {};
+            detail::write64le( key, seed );
+
+            init( key );
+        }
+    }
+
+    // a byte seed of up to 32 bytes is the key, zero-padded
+
+    blake3( unsigned char const * p, std::size_t n )
+    {
+        if( n == 0 )
+        {
+            init( detail::blake3_constants<>::IV, 0 );
+        }
+        else if( n <= 32 )
+        {
+            unsigned char key[ 32 ] = {};
+            std::memcpy( key, p, n );
+
+            init( key );
+        }
+        else
+        {
+            init( p );
+
+            update( p + 32, n - 32 );
+            result();
+        }
+    }
+
+    void update( void const * pv, std::size_t n )
+    {
+        unsigned char const* p = static_cast<unsigned char const*>( pv );
+
+        subtree_fn f = { this };
+        update_( p, n, f );
+    }
+
+    // as update, but hashes large inputs using up to the given number
+    // of threads (zero means std::thread::hardware_concurrency())
+
+    void update_parallel( void const * pv, std::size_t n, unsigned threads = 0 )
+    {
+        unsigned char const* p = static_cast<unsigned char const*>( pv );
+
+        if( threads == 0 )
+        {
+            threads = std::thread::hardware_concurrency();
+        }
+
+        subtree_parallel_fn f = { this, threads };
+        update_( p, n, f );
+    }
+
+    void result( unsigned char * out, std::size_t n )
+    {
+        // the root node
+
+        std::uint32_t cv[ 8 ];
+        std::memcpy( cv, cv_, sizeof( cv ) );
+
+        std::uint32_t w[ 16 ];
+
+        for( int i = 0; i < 16; ++i )
+        {
+            w[ i ] = detail::read32le( buffer_ + i * 4 );
+        }
+
+        std::uint64_t counter = chunk_counter_;
+        std::uint32_t len = static_cast<std::uint32_t>( m_ );
+        std::uint32_t flags = flags_ | chunk_start_flag() | CHUNK_END;
+
+        for( std::size_t i = stack_size_; i > 0; --i )
+        {
+            std::uint32_t tmp[ 16 ];
+            compress( cv, w, counter, len, flags, tmp );
+
+            std::memcpy( w + 0, stack_[ i - 1 ], 8 * sizeof( std::uint32_t ) );
+            std::memcpy( w + 8, tmp, 8 * sizeof( std::uint32_t ) );
+
+            std::memcpy( cv, key_, sizeof( cv ) );
+
+            counter = 0;
+            len = B;
+            flags = flags_ | PARENT;
+        }
+
+        // the output blocks
+
+        std::uint32_t block[ 16 ];
+        compress( cv, w, 0, len, flags | ROOT, block );
+
+        std::uint32_t next_key[ 8 ];
+        std::memcpy( next_key, block + 8, sizeof( next_key ) );
+
+        for( std::uint64_t t = 1; ; ++t )
+        {
+            std::size_t k = n < B? n: B;
+
+            for( std::size_t i = 0; i < k; ++i )
+            {
+                out[ i ] = static_cast<unsigned char>( block[ i / 4 ] >> ( i % 4 * 8 ) );
+            }
+
+            out += k;
+            n -= k;
+
+            if( n == 0 ) break;
+
+            compress( cv, w, t, len, flags | ROOT, block );
+        }
+
+        init( next_key, KEYED_HASH );
+    }
+
+    result_type result()
+    {
+        result_type r;
+        result( &r[ 0 ], r.size() );
+
+        return r;
+    }
+};
+
+} // namespace hash2
+} // namespace boost
+
+#endif // #ifndef BOOST_HASH2_BLAKE3_HPP_INCLUDED
@@ -0,0 +1,173 @@
+#ifndef BOOST_HASH2_BUFFERED_HPP_INCLUDED
+#define BOOST_HASH2_BUFFERED_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// buffered<H, N>: collects small writes, such as the ones made by
+// hash_append for the members of a tuple or struct, and passes them
+// to H::update in multiples of N bytes
+
+#include <boost/assert.hpp>
+#include <boost/config.hpp>
+#include <type_traits>
+#include <utility>
+#include <cstring>
+#include <cstddef>
+
+namespace boost
+{
+namespace hash2
+{
+
+namespace detail
+{
+
+// buffered<H> has block_size when H does, so that it can be used in hmac
+
+template<class H, class = void> struct buffered_block_size
+{
+};
+
+template<class H> struct buffered_block_size<H, decltype( (void)H::block_size )>
+{
+    static const int block_size = H::block_size;
+};
+
+} // namespace detail
+
+template<class H, std::size_t N = 64> class buffered: public detail::buffered_block_size<H>
+{
+private:
+
+    static_assert( N > 0, "N must be positive" );
+
+    H h_;
+
+    unsigned char buffer_[ N ];
+    std::size_t m_; // < N
+
+private:
+
+    void flush()
+    {
+        if( m_ > 0 )
+        {
+            h_.update( buffer_, m_ );
+            m_ = 0;
+        }
+    }
+
+    // the writes that don't fit in the buffer
+
+    BOOST_NOINLINE void update_( unsigned char const * p, std::size_t n )
+    {
+        if( m_ > 0 )
+        {
+            std::size_t k = N - m_;
+
+            std::memcpy( buffer_ + m_, p, k );
+
+            p += k;
+            n -= k;
+
+            h_.update( buffer_, N );
+            m_ = 0;
+        }
+
+        {
+            std::size_t k = n / N * N;
+
+            if( k > 0 )
+            {
+                h_.update( p, k );
+
+                p += k;
+                n -= k;
+            }
+        }
+
+        BOOST_ASSERT( n < N );
+
+        if( n > 0 )
+        {
+            std::memcpy( buffer_, p, n );
+            m_ = n;
+        }
+    }
+
+public:
+
+    typedef typename H::result_type result_type;
+    typedef typename H::size_type size_type;
+
+    buffered(): m_( 0 )
+    {
+        std::memset( buffer_, 0, N );
+    }
+
+    // passes the arguments to the constructor of H, such as a seed,
+    // a byte seed ( p, n ), or the two seeds of murmur3_128
+
+    template<class A1, class... A,
+        class E = typename std::enable_if< std::is_constructible<H, A1&&, A&&...>::value >::type>
+    explicit buffered( A1&& a1, A&&... a ): h_( std::forward<A1>( a1 ), std::forward<A>( a )... ), m_( 0 )
+    {
+        std::memset( buffer_, 0, N );
+    }
+
+    void update( void const * pv, std::size_t n )
+    {
+        unsigned char const* p = static_cast<unsigned char const*>( pv );
+
+        BOOST_ASSERT( m_ < N );
+
+        if( n < N && m_ < N - n )
+        {
+            // a small write, such as that of an integer by hash_append
+
+            if( n > 0 )
+            {
+                std::memcpy( buffer_ + m_, p, n );
+                m_ += n;
+            }
+        }
+        else
+        {
+            update_( p, n );
+        }
+    }
+
+    // update( p, M ), with the length known at compile time
+
+    template<std::size_t M> void update_fixed( unsigned char const * p )
+    {
+        BOOST_ASSERT( m_ < N );
+
+        if( M < N && m_ < N - M )
+        {
+            std::memcpy( buffer_ + m_, p, M );
+            m_ += M;
+        }
+        else
+        {
+            update_( p, M );
+        }
+    }
+
+    result_type result()
+    {
+        flush();
+
+        // clear buffered plaintext
+        std::memset( buffer_, 0, N );
+
+        return h_.result();
+    }
+};
+
+} // namespace hash2
+} // namespace boost
+
+#endif // #ifndef BOOST_HASH2_BUFFERED_HPP_INCLUDED
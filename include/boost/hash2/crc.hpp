@@ -0,0 +1,615 @@
+#ifndef BOOST_HASH2_CRC_HPP_INCLUDED
+#define BOOST_HASH2_CRC_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// CRC-32C (Castagnoli), https://tools.ietf.org/html/rfc3720#appendix-B.4
+// CRC-32 (IEEE 802.3, zlib), https://www.rfc-editor.org/rfc/rfc1952#section-8
+// CRC-64/XZ (ECMA-182), https://tukaani.org/xz/xz-file-format.txt
+// CRC-64/NVME, https://reveng.sourceforge.io/crc-catalogue/17plus.htm#crc.cat.crc-64-nvme
+
+#include <boost/hash2/detail/intrin.hpp>
+#include <boost/hash2/detail/read.hpp>
+#include <boost/hash2/detail/write.hpp>
+#include <boost/hash2/detail/config.hpp>
+#include <boost/mp11/integer_sequence.hpp>
+#include <boost/assert.hpp>
+#include <boost/config.hpp>
+#include <type_traits>
+#include <cstdint>
+#include <cstddef>
+
+namespace boost
+{
+namespace hash2
+{
+namespace detail
+{
+
+// Arithmetic on reflected CRC values, in which the most significant
+// bit holds the coefficient of x^0
+
+template<class T> constexpr T crc_one()
+{
+    return static_cast<T>( T( 1 ) << ( sizeof( T ) * 8 - 1 ) );
+}
+
+template<class T> constexpr T crc_mul_( T a, T b, T poly, T m )
+{
+    return m == 0? T( 0 ): static_cast<T>( ( ( a & m )? b: T( 0 ) ) ^ crc_mul_<T>( a, static_cast<T>( ( b & 1 )? ( b >> 1 ) ^ poly: b >> 1 ), poly, static_cast<T>( m >> 1 ) ) );
+}
+
+// a * b mod P
+template<class T> constexpr T crc_mul( T a, T b, T poly )
+{
+    return crc_mul_<T>( a, b, poly, crc_one<T>() );
+}
+
+template<class T> constexpr T crc_xpow_( T r, T poly, bool odd )
+{
+    return odd? crc_mul<T>( r, static_cast<T>( crc_one<T>() >> 1 ), poly ): r;
+}
+
+template<class T> constexpr T crc_square( T a, T poly )
+{
+    return crc_mul<T>( a, a, poly );
+}
+
+// x^e mod P
+template<class T> constexpr T crc_xpow( T poly, std::uint64_t e )
+{
+    return e == 0? crc_one<T>(): crc_xpow_<T>( crc_square<T>( crc_xpow<T>( poly, e >> 1 ), poly ), poly, ( e & 1 ) != 0 );
+}
+
+// Slicing-by-16 tables; table[ j ][ i ] is the CRC of the byte i
+// followed by j zero bytes
+
+template<class T> constexpr T crc_table_bits( T c, T poly, int k )
+{
+    return k == 0? c: crc_table_bits<T>( static_cast<T>( ( c >> 1 ) ^ ( ( c & 1 )? poly: T( 0 ) ) ), poly, k - 1 );
+}
+
+template<class T> constexpr T crc_table_next( T poly, T v )
+{
+    return static_cast<T>( crc_table_bits<T>( v & 0xFF, poly, 8 ) ^ ( v >> 8 ) );
+}
+
+template<class T> constexpr T crc_table_entry( T poly, int j, T i )
+{
+    return j == 0? crc_table_bits<T>( i, poly, 8 ): crc_table_next<T>( poly, crc_table_entry<T>( poly, j - 1, i ) );
+}
+
+template<class T, T Poly, class S = mp11::make_index_sequence<256>> struct crc_tables;
+
+template<class T, T Poly, std::size_t... I> struct crc_tables<T, Poly, mp11::index_sequence<I...>>
+{
+    static const T table[ 16 ][ 256 ];
+};
+
+template<class T, T Poly, std::size_t... I> const T crc_tables<T, Poly, mp11::index_sequence<I...>>::table[ 16 ][ 256 ] =
+{
+    { crc_table_entry<T>( Poly,  0, I )... },
+    { crc_table_entry<T>( Poly,  1, I )... },
+    { crc_table_entry<T>( Poly,  2, I )... },
+    { crc_table_entry<T>( Poly,  3, I )... },
+    { crc_table_entry<T>( Poly,  4, I )... },
+    { crc_table_entry<T>( Poly,  5, I )... },
+    { crc_table_entry<T>( Poly,  6, I )... },
+    { crc_table_entry<T>( Poly,  7, I )... },
+    { crc_table_entry<T>( Poly,  8, I )... },
+    { crc_table_entry<T>( Poly,  9, I )... },
+    { crc_table_entry<T>( Poly, 10, I )... },
+    { crc_table_entry<T>( Poly, 11, I )... },
+    { crc_table_entry<T>( Poly, 12, I )... },
+    { crc_table_entry<T>( Poly, 13, I )... },
+    { crc_table_entry<T>( Poly, 14, I )... },
+    { crc_table_entry<T>( Poly, 15, I )... }
+};
+
+BOOST_FORCEINLINE std::uint32_t crc_slice16( std::uint32_t const t[ 16 ][ 256 ], std::uint32_t c, unsigned char const * p )
+{
+    c ^= detail::read32le( p );
+
+    return
+        t[ 15 ][ c & 0xFF ] ^ t[ 14 ][ ( c >> 8 ) & 0xFF ] ^ t[ 13 ][ ( c >> 16 ) & 0xFF ] ^ t[ 12 ][ c >> 24 ] ^
+        t[ 11 ][ p[  4 ] ] ^ t[ 10 ][ p[  5 ] ] ^ t[  9 ][ p[  6 ] ] ^ t[  8 ][ p[  7 ] ] ^
+        t[  7 ][ p[  8 ] ] ^ t[  6 ][ p[  9 ] ] ^ t[  5 ][ p[ 10 ] ] ^ t[  4 ][ p[ 11 ] ] ^
+        t[  3 ][ p[ 12 ] ] ^ t[  2 ][ p[ 13 ] ] ^ t[  1 ][ p[ 14 ] ] ^ t[  0 ][ p[ 15 ] ];
+}
+
+BOOST_FORCEINLINE std::uint64_t crc_slice16( std::uint64_t const t[ 16 ][ 256 ], std::uint64_t c, unsigned char const * p )
+{
+    c ^= detail::read64le( p );
+
+    return
+        t[ 15 ][ c & 0xFF ] ^ t[ 14 ][ ( c >> 8 ) & 0xFF ] ^ t[ 13 ][ ( c >> 16 ) & 0xFF ] ^ t[ 12 ][ ( c >> 24 ) & 0xFF ] ^
+        t[ 11 ][ ( c >> 32 ) & 0xFF ] ^ t[ 10 ][ ( c >> 40 ) & 0xFF ] ^ t[  9 ][ ( c >> 48 ) & 0xFF ] ^ t[  8 ][ c >> 56 ] ^
+        t[  7 ][ p[  8 ] ] ^ t[  6 ][ p[  9 ] ] ^ t[  5 ][ p[ 10 ] ] ^ t[  4 ][ p[ 11 ] ] ^
+        t[  3 ][ p[ 12 ] ] ^ t[  2 ][ p[ 13 ] ] ^ t[  1 ][ p[ 14 ] ] ^ t[  0 ][ p[ 15 ] ];
+}
+
+// updates the (uninverted) CRC register c
+template<class T, T Poly> T crc_update_portable( T c, unsigned char const * p, std::size_t n )
+{
+    T const (*t)[ 256 ] = crc_tables<T, Poly>::table;
+
+    while( n >= 16 )
+    {
+        c = crc_slice16( t, c, p );
+
+        p += 16;
+        n -= 16;
+    }
+
+    while( n > 0 )
+    {
+        c = static_cast<T>( t[ 0 ][ ( c ^ *p ) & 0xFF ] ^ ( c >> 8 ) );
+
+        ++p;
+        --n;
+    }
+
+    return c;
+}
+
+#if defined(BOOST_HASH2_HAS_PCLMUL)
+
+// Folding constants for moving a 128 bit block D bytes forward;
+// a carry-less multiplication by a reflected W bit constant adds
+// a factor of x^(65-W)
+
+template<class T, T Poly, std::size_t D> BOOST_FORCEINLINE __m128i crc_fold_k()
+{
+    constexpr T k0 = crc_xpow<T>( Poly, 8 * D + sizeof( T ) * 8 - 1 );
+    constexpr T k1 = crc_xpow<T>( Poly, 8 * D + sizeof( T ) * 8 - 65 );
+
+    return _mm_set_epi64x( static_cast<long long>( k1 ), static_cast<long long>( k0 ) );
+}
+
+BOOST_FORCEINLINE __m128i crc_fold( __m128i x, __m128i k, __m128i y )
+{
+    return _mm_xor_si128( _mm_xor_si128( _mm_clmulepi64_si128( x, k, 0x00 ), _mm_clmulepi64_si128( x, k, 0x11 ) ), y );
+}
+
+#if defined(BOOST_HASH2_HAS_VPCLMUL)
+
+BOOST_FORCEINLINE __m512i crc_fold( __m512i x, __m512i k, __m512i y )
+{
+    return _mm512_ternarylogic_epi64( _mm512_clmulepi64_epi128( x, k, 0x00 ), _mm512_clmulepi64_epi128( x, k, 0x11 ), y, 0x96 );
+}
+
+// Folds the input 256 bytes at a time; consumes n - n % 64 bytes
+
+template<class T, T Poly> inline __m128i crc_fold_avx512( __m128i c, unsigned char const * & p, std::size_t & n )
+{
+    BOOST_ASSERT( n >= 256 );
+
+    __m512i x0 = _mm512_loadu_si512( p +   0 );
+    __m512i x1 = _mm512_loadu_si512( p +  64 );
+    __m512i x2 = _mm512_loadu_si512( p + 128 );
+    __m512i x3 = _mm512_loadu_si512( p + 192 );
+
+    x0 = _mm512_xor_si512( x0, _mm512_inserti32x4( _mm512_setzero_si512(), c, 0 ) );
+
+    p += 256;
+    n -= 256;
+
+    {
+        __m512i const k = _mm512_broadcast_i32x4( crc_fold_k<T, Poly, 256>() );
+
+        while( n >= 256 )
+        {
+            x0 = crc_fold( x0, k, _mm512_loadu_si512( p +   0 ) );
+            x1 = crc_fold( x1, k, _mm512_loadu_si512( p +  64 ) );
+            x2 = crc_fold( x2, k, _mm512_loadu_si512( p + 128 ) );
+            x3 = crc_fold( x3, k, _mm512_loadu_si512( p + 192 ) );
+
+            p += 256;
+            n -= 256;
+        }
+    }
+
+    x3 = crc_fold( x2, _mm512_broadcast_i32x4( crc_fold_k<T, Poly,  64>() ), x3 );
+    x3 = crc_fold( x1, _mm512_broadcast_i32x4( crc_fold_k<T, Poly, 128>() ), x3 );
+    x3 = crc_fold( x0, _mm512_broadcast_i32x4( crc_fold_k<T, Poly, 192>() ), x3 );
+
+    {
+        __m512i const k = _mm512_broadcast_i32x4( crc_fold_k<T, Poly, 64>() );
+
+        while( n >= 64 )
+        {
+            x3 = crc_fold( x3, k, _mm512_loadu_si512( p ) );
+
+            p += 64;
+            n -= 64;
+        }
+    }
+
+    // fold the four lanes onto the last one
+
+    __m512i const k = _mm512_inserti64x4( _mm512_castsi256_si512( _mm256_set_m128i( crc_fold_k<T, Poly, 32>(), crc_fold_k<T, Poly, 48>() ) ), _mm256_castsi128_si256( crc_fold_k<T, Poly, 16>() ), 1 );
+
+    __m512i z = _mm512_xor_si512( _mm512_clmulepi64_epi128( x3, k, 0x00 ), _mm512_clmulepi64_epi128( x3, k, 0x11 ) );
+    z = _mm512_mask_mov_epi64( z, 0xC0, x3 );
+
+    __m256i y = _mm256_xor_si256( _mm512_castsi512_si256( z ), _mm512_extracti64x4_epi64( z, 1 ) );
+    return _mm_xor_si128( _mm256_castsi256_si128( y ), _mm256_extracti128_si256( y, 1 ) );
+}
+
+#endif // #if defined(BOOST_HASH2_HAS_VPCLMUL)
+
+// Folds the CRC register c and the input, n >= 64, into a 128 bit
+// block with the same CRC; consumes n - n % 16 bytes
+
+template<class T, T Poly> inline __m128i crc_fold_128( T c, unsigned char const * & p, std::size_t & n )
+{
+    BOOST_ASSERT( n >= 64 );
+
+    __m128i x = _mm_set_epi64x( 0, static_cast<long long>( c ) );
+
+#if defined(BOOST_HASH2_HAS_VPCLMUL)
+
+    if( n >= 256 )
+    {
+        x = crc_fold_avx512<T, Poly>( x, p, n );
+    }
+    else
+
+#endif
+    {
+        __m128i x0 = _mm_loadu_si128( reinterpret_cast<__m128i const*>( p +  0 ) );
+        __m128i x1 = _mm_loadu_si128( reinterpret_cast<__m128i const*>( p + 16 ) );
+        __m128i x2 = _mm_loadu_si128( reinterpret_cast<__m128i const*>( p + 32 ) );
+        __m128i x3 = _mm_loadu_si128( reinterpret_cast<__m128i const*>( p + 48 ) );
+
+        x0 = _mm_xor_si128( x0, x );
+
+        p += 64;
+        n -= 64;
+
+        __m128i const k = crc_fold_k<T, Poly, 64>();
+
+        while( n >= 64 )
+        {
+            x0 = crc_fold( x0, k, _mm_loadu_si128( reinterpret_cast<__m128i const*>( p +  0 ) ) );
+            x1 = crc_fold( x1, k, _mm_loadu_si128( reinterpret_cast<__m128i const*>( p + 16 ) ) );
+            x2 = crc_fold( x2, k, _mm_loadu_si128( reinterpret_cast<__m128i const*>( p + 32 ) ) );
+            x3 = crc_fold( x3, k, _mm_loadu_si128( reinterpret_cast<__m128i const*>( p + 48 ) ) );
+
+            p += 64;
+            n -= 64;
+        }
+
+        x3 = crc_fold( x2, crc_fold_k<T, Poly, 16>(), x3 );
+        x3 = crc_fold( x1, crc_fold_k<T, Poly, 32>(), x3 );
+        x = crc_fold( x0, crc_fold_k<T, Poly, 48>(), x3 );
+    }
+
+    __m128i const k = crc_fold_k<T, Poly, 16>();
+
+    while( n >= 16 )
+    {
+        x = crc_fold( x, k, _mm_loadu_si128( reinterpret_cast<__m128i const*>( p ) ) );
+
+        p += 16;
+        n -= 16;
+    }
+
+    return x;
+}
+
+#endif // #if defined(BOOST_HASH2_HAS_PCLMUL)
+
+// updates the (uninverted) CRC register c, folding with carry-less
+// multiplication when available
+template<class T, T Poly> inline T crc_update( T c, unsigned char const * p, std::size_t n, std::integral_constant<T, Poly> )
+{
+#if defined(BOOST_HASH2_HAS_PCLMUL)
+
+    if( n >= 64 )
+    {
+        __m128i x = crc_fold_128<T, Poly>( c, p, n );
+
+        unsigned char tmp[ 16 ];
+        _mm_storeu_si128( reinterpret_cast<__m128i*>( tmp ), x );
+
+        c = crc_update_portable<T, Poly>( 0, tmp, 16 );
+    }
+
+#endif
+
+    return crc_update_portable<T, Poly>( c, p, n );
+}
+
+struct crc_poly
+{
+    static constexpr std::uint32_t crc32c = 0x82F63B78ul;
+    static constexpr std::uint32_t crc32_ieee = 0xEDB88320ul;
+    static constexpr std::uint64_t crc64_xz = 0xC96C5795D7870F42ull;
+    static constexpr std::uint64_t crc64_nvme = 0x9A6C9329AC4BC9B5ull;
+};
+
+#if defined(BOOST_HASH2_HAS_SSE42)
+
+BOOST_FORCEINLINE std::uint32_t crc32c_u64( std::uint32_t c, std::uint64_t v )
+{
+#if defined(__x86_64__) || defined(_M_X64)
+
+    return static_cast<std::uint32_t>( _mm_crc32_u64( c, v ) );
+
+#else
+
+    c = _mm_crc32_u32( c, static_cast<std::uint32_t>( v ) );
+    return _mm_crc32_u32( c, static_cast<std::uint32_t>( v >> 32 ) );
+
+#endif
+}
+
+// Three independent streams of L bytes each are processed in parallel
+// to hide the latency of the crc32 instruction, then merged as
+//
+//   c0 * x^(16L) + c1 * x^(8L) + c2
+
+template<std::size_t L> BOOST_FORCEINLINE std::uint32_t crc32c_merge( std::uint32_t c0, std::uint32_t c1, std::uint32_t c2 )
+{
+    std::uint32_t const P = crc_poly::crc32c;
+
+#if defined(BOOST_HASH2_HAS_PCLMUL)
+
+    // crc32( 0, a * b ) computes a * b * x^33 mod P
+
+    constexpr std::uint32_t k0 = crc_xpow<std::uint32_t>( P, 16 * L - 33 );
+    constexpr std::uint32_t k1 = crc_xpow<std::uint32_t>( P,  8 * L - 33 );
+
+    __m128i x = _mm_xor_si128(
+        _mm_clmulepi64_si128( _mm_cvtsi32_si128( static_cast<int>( c0 ) ), _mm_cvtsi32_si128( static_cast<int>( k0 ) ), 0x00 ),
+        _mm_clmulepi64_si128( _mm_cvtsi32_si128( static_cast<int>( c1 ) ), _mm_cvtsi32_si128( static_cast<int>( k1 ) ), 0x00 ) );
+
+    std::uint64_t w;
+    _mm_storel_epi64( reinterpret_cast<__m128i*>( &w ), x );
+
+    return crc32c_u64( 0, w ) ^ c2;
+
+#else
+
+    constexpr std::uint32_t k0 = crc_xpow<std::uint32_t>( P, 16 * L );
+    constexpr std::uint32_t k1 = crc_xpow<std::uint32_t>( P,  8 * L );
+
+    return crc_mul<std::uint32_t>( c0, k0, P ) ^ crc_mul<std::uint32_t>( c1, k1, P ) ^ c2;
+
+#endif
+}
+
+template<std::size_t L> BOOST_FORCEINLINE void crc32c_streams( std::uint32_t & c, unsigned char const * & p, std::size_t & n )
+{
+    while( n >= 3 * L )
+    {
+        std::uint32_t c0 = c;
+        std::uint32_t c1 = 0;
+        std::uint32_t c2 = 0;
+
+        for( std::size_t i = 0; i < L; i += 8 )
+        {
+            c0 = crc32c_u64( c0, detail::read64le( p + i ) );
+            c1 = crc32c_u64( c1, detail::read64le( p + i + L ) );
+            c2 = crc32c_u64( c2, detail::read64le( p + i + 2 * L ) );
+        }
+
+        c = crc32c_merge<L>( c0, c1, c2 );
+
+        p += 3 * L;
+        n -= 3 * L;
+    }
+}
+
+inline std::uint32_t crc_update( std::uint32_t c, unsigned char const * p, std::size_t n, std::integral_constant<std::uint32_t, crc_poly::crc32c> )
+{
+#if defined(BOOST_HASH2_HAS_VPCLMUL)
+
+    if( n >= 256 )
+    {
+        __m128i x = crc_fold_128<std::uint32_t, crc_poly::crc32c>( c, p, n );
+
+        std::uint64_t w[ 2 ];
+        _mm_storeu_si128( reinterpret_cast<__m128i*>( w ), x );
+
+        c = crc32c_u64( crc32c_u64( 0, w[ 0 ] ), w[ 1 ] );
+    }
+
+#endif
+
+    crc32c_streams<1024>( c, p, n );
+    crc32c_streams<128>( c, p, n );
+
+    while( n >= 8 )
+    {
+        c = crc32c_u64( c, detail::read64le( p ) );
+
+        p += 8;
+        n -= 8;
+    }
+
+    while( n > 0 )
+    {
+        c = _mm_crc32_u8( c, *p );
+
+        ++p;
+        --n;
+    }
+
+    return c;
+}
+
+#endif // #if defined(BOOST_HASH2_HAS_SSE42)
+
+template<class T, T Poly> class crc
+{
+private:
+
+    T st_;
+
+public:
+
+    typedef T result_type;
+    typedef T size_type;
+
+    crc(): st_( static_cast<T>( ~T( 0 ) ) )
+    {
+    }
+
+    explicit crc( std::uint64_t seed ): st_( static_cast<T>( ~T( 0 ) ) )
+    {
+        if( seed )
+        {
+            if( seed >> 32 )
+            {
+                unsigned char tmp[ 8 ];
+                detail::write64le( tmp, seed );
+                update( tmp, 8 );
+            }
+            else
+            {
+                unsigned char tmp[ 4 ];
+                detail::write32le( tmp, static_cast<std::uint32_t>( seed ) );
+                update( tmp, 4 );
+            }
+        }
+    }
+
+    crc( unsigned char const * p, std::size_t n ): st_( static_cast<T>( ~T( 0 ) ) )
+    {
+        if( n != 0 )
+        {
+            update( p, n );
+        }
+    }
+
+    void update( void const * pv, std::size_t n )
+    {
+        unsigned char const* p = static_cast<unsigned char const*>( pv );
+
+        st_ = detail::crc_update( st_, p, n, std::integral_constant<T, Poly>() );
+    }
+
+    T result()
+    {
+        T r = static_cast<T>( ~st_ );
+
+        // advance as if by update( "\xFF", 1 ), to allow
+        // multiple result() calls to generate a sequence
+        // of distinct values
+
+        unsigned char const tmp = 0xFF;
+        st_ = detail::crc_update( st_, &tmp, 1, std::integral_constant<T, Poly>() );
+
+        return r;
+    }
+};
+
+// crc( A + B ) == crc( A ) * x^(8 * len_b) + crc( B ); the initial
+// and final inversions cancel out
+
+template<class T> T crc_combine( T poly, T crc_a, T crc_b, std::uint64_t len_b )
+{
+    return static_cast<T>( crc_mul<T>( crc_a, crc_xpow<T>( poly, 8 * len_b ), poly ) ^ crc_b );
+}
+
+} // namespace detail
+
+class crc32c: public detail::crc<std::uint32_t, detail::crc_poly::crc32c>
+{
+public:
+
+    crc32c()
+    {
+    }
+
+    explicit crc32c( std::uint64_t seed ): detail::crc<std::uint32_t, detail::crc_poly::crc32c>( seed )
+    {
+    }
+
+    crc32c( unsigned char const * p, std::size_t n ): detail::crc<std::uint32_t, detail::crc_poly::crc32c>( p, n )
+    {
+    }
+};
+
+class crc32_ieee: public detail::crc<std::uint32_t, detail::crc_poly::crc32_ieee>
+{
+public:
+
+    crc32_ieee()
+    {
+    }
+
+    explicit crc32_ieee( std::uint64_t seed ): detail::crc<std::uint32_t, detail::crc_poly::crc32_ieee>( seed )
+    {
+    }
+
+    crc32_ieee( unsigned char const * p, std::size_t n ): detail::crc<std::uint32_t, detail::crc_poly::crc32_ieee>( p, n )
+    {
+    }
+};
+
+class crc64_xz: public detail::crc<std::uint64_t, detail::crc_poly::crc64_xz>
+{
+public:
+
+    crc64_xz()
+    {
+    }
+
+    explicit crc64_xz( std::uint64_t seed ): detail::crc<std::uint64_t, detail::crc_poly::crc64_xz>( seed )
+    {
+    }
+
+    crc64_xz( unsigned char const * p, std::size_t n ): detail::crc<std::uint64_t, detail::crc_poly::crc64_xz>( p, n )
+    {
+    }
+};
+
+class crc64_nvme: public detail::crc<std::uint64_t, detail::crc_poly::crc64_nvme>
+{
+public:
+
+    crc64_nvme()
+    {
+    }
+
+    explicit crc64_nvme( std::uint64_t seed ): detail::crc<std::uint64_t, detail::crc_poly::crc64_nvme>( seed )
+    {
+    }
+
+    crc64_nvme( unsigned char const * p, std::size_t n ): detail::crc<std::uint64_t, detail::crc_poly::crc64_nvme>( p, n )
+    {
+    }
+};
+
+// Given crc_a, the CRC of A, and crc_b, the CRC of B, these return
+// the CRC of A followed by B; len_b is the size of B in bytes
+
+inline std::uint32_t crc32c_combine( std::uint32_t crc_a, std::uint32_t crc_b, std::uint64_t len_b )
+{
+    return detail::crc_combine<std::uint32_t>( detail::crc_poly::crc32c, crc_a, crc_b, len_b );
+}
+
+inline std::uint32_t crc32_ieee_combine( std::uint32_t crc_a, std::uint32_t crc_b, std::uint64_t len_b )
+{
+    return detail::crc_combine<std::uint32_t>( detail::crc_poly::crc32_ieee, crc_a, crc_b, len_b );
+}
+
+inline std::uint64_t crc64_xz_combine( std::uint64_t crc_a, std::uint64_t crc_b, std::uint64_t len_b )
+{
+    return detail::crc_combine<std::uint64_t>( detail::crc_poly::crc64_xz, crc_a, crc_b, len_b );
+}
+
+inline std::uint64_t crc64_nvme_combine( std::uint64_t crc_a, std::uint64_t crc_b, std::uint64_t len_b )
+{
+    return detail::crc_combine<std::uint64_t>( detail::crc_poly::crc64_nvme, crc_a, crc_b, len_b );
+}
+
+} // namespace hash2
+} // namespace boost
+
+#endif // #ifndef BOOST_HASH2_CRC_HPP_INCLUDED
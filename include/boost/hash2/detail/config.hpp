@@ -0,0 +1,106 @@
+#ifndef BOOST_HASH2_DETAIL_CONFIG_HPP_INCLUDED
+#define BOOST_HASH2_DETAIL_CONFIG_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+// Instruction set detection
+//
+// The library is header-only, so the vectorized code paths are selected
+// at compile time, from the instruction sets enabled for the translation
+// unit (e.g. by -mavx2 or -march=native under GCC and Clang, or /arch:AVX2
+// under MSVC.)
+//
+// MSVC doesn't indicate AES-NI, PCLMULQDQ or the SHA extensions under
+// any /arch; the code paths using them are enabled there by defining
+// BOOST_HASH2_HAS_AES, BOOST_HASH2_HAS_PCLMUL or BOOST_HASH2_HAS_SHA
+// before including the library.
+//
+// The SHA-NI kernel of sha1_160 is also compiled when the SHA extensions
+// aren't enabled, and is then used when the CPU supports them, as
+// reported by cpuid (BOOST_HASH2_SHA_DISPATCH.) Defining
+// BOOST_HASH2_DISABLE_DISPATCH disables this.
+//
+// Defining BOOST_HASH2_DISABLE_SIMD disables all of them and restricts
+// the library to its portable implementations, which produce identical
+// results.
+
+#include <boost/config.hpp>
+
+#if !defined(BOOST_HASH2_DISABLE_SIMD)
+
+#if defined(__SSE2__) || defined(_M_X64) || ( defined(_M_IX86_FP) && _M_IX86_FP >= 2 )
+# define BOOST_HASH2_HAS_SSE2
+#endif
+
+#if defined(__SSSE3__) || defined(__AVX__)
+# define BOOST_HASH2_HAS_SSSE3
+#endif
+
+#if defined(__SSE4_1__) || defined(__AVX__)
+# define BOOST_HASH2_HAS_SSE41
+#endif
+
+#if defined(__SSE4_2__) || defined(__AVX__)
+# define BOOST_HASH2_HAS_SSE42
+#endif
+
+#if defined(__PCLMUL__) && defined(BOOST_HASH2_HAS_SSE2) && !defined(BOOST_HASH2_HAS_PCLMUL)
+# define BOOST_HASH2_HAS_PCLMUL
+#endif
+
+#if defined(__AES__) && defined(BOOST_HASH2_HAS_SSE2) && !defined(BOOST_HASH2_HAS_AES)
+# define BOOST_HASH2_HAS_AES
+#endif
+
+#if defined(__SHA__) && defined(BOOST_HASH2_HAS_SSSE3) && !defined(BOOST_HASH2_HAS_SHA)
+# define BOOST_HASH2_HAS_SHA
+#endif
+
+#if defined(__AVX2__)
+# define BOOST_HASH2_HAS_AVX2
+#endif
+
+#if defined(__AVX512F__) && defined(__AVX512VL__) && defined(__AVX512BW__) && defined(__AVX512DQ__)
+# define BOOST_HASH2_HAS_AVX512
+#endif
+
+#if defined(__AVX512IFMA__) && defined(BOOST_HASH2_HAS_AVX512)
+# define BOOST_HASH2_HAS_AVX512IFMA
+#endif
+
+#if defined(__VPCLMULQDQ__) && defined(BOOST_HASH2_HAS_AVX512)
+# define BOOST_HASH2_HAS_VPCLMUL
+#endif
+
+#if defined(__VAES__) && defined(BOOST_HASH2_HAS_AES) && defined(BOOST_HASH2_HAS_AVX2)
+# define BOOST_HASH2_HAS_VAES
+#endif
+
+#if !defined(BOOST_HASH2_HAS_SHA) && !defined(BOOST_HASH2_DISABLE_DISPATCH) && defined(BOOST_HASH2_HAS_SSE2) && ( defined(__x86_64__) || defined(_M_X64) ) \
+    && ( defined(_MSC_VER) || defined(__clang__) || ( defined(BOOST_GCC) && BOOST_GCC >= 50000 ) )
+
+# define BOOST_HASH2_SHA_DISPATCH
+
+# if defined(__GNUC__) || defined(__clang__)
+#  define BOOST_HASH2_TARGET_SHA __attribute__(( target( "sha,ssse3" ) ))
+# endif
+
+#endif
+
+#else // #if !defined(BOOST_HASH2_DISABLE_SIMD)
+
+# undef BOOST_HASH2_HAS_AES
+# undef BOOST_HASH2_HAS_PCLMUL
+# undef BOOST_HASH2_HAS_SHA
+
+#endif // #if !defined(BOOST_HASH2_DISABLE_SIMD)
+
+// the functions compiled for the SHA extensions when dispatching
+
+#if !defined(BOOST_HASH2_TARGET_SHA)
+# define BOOST_HASH2_TARGET_SHA
+#endif
+
+#endif // #ifndef BOOST_HASH2_DETAIL_CONFIG_HPP_INCLUDED
@@ -0,0 +1,82 @@
+#ifndef BOOST_HASH2_DETAIL_CPUID_HPP_INCLUDED
+#define BOOST_HASH2_DETAIL_CPUID_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+// Runtime detection of the instruction sets used by the code paths
+// that are selected at runtime (see BOOST_HASH2_SHA_DISPATCH in
+// detail/config.hpp)
+
+#include <boost/hash2/detail/config.hpp>
+
+#if defined(BOOST_HASH2_SHA_DISPATCH)
+
+#if defined(_MSC_VER) && !defined(__clang__)
+# include <intrin.h>
+#else
+# include <cpuid.h>
+#endif
+
+namespace boost
+{
+namespace hash2
+{
+namespace detail
+{
+
+inline void cpuid( unsigned leaf, unsigned & eax, unsigned & ebx, unsigned & ecx, unsigned & edx )
+{
+#if defined(_MSC_VER) && !defined(__clang__)
+
+    int w[ 4 ];
+    __cpuidex( w, static_cast<int>( leaf ), 0 );
+
+    eax = static_cast<unsigned>( w[0] );
+    ebx = static_cast<unsigned>( w[1] );
+    ecx = static_cast<unsigned>( w[2] );
+    edx = static_cast<unsigned>( w[3] );
+
+#else
+
+    __cpuid_count( leaf, 0, eax, ebx, ecx, edx );
+
+#endif
+}
+
+// SHA extensions and SSSE3
+
+inline bool cpu_has_sha_()
+{
+    unsigned max_leaf, eax, ebx, ecx, edx;
+    cpuid( 0, max_leaf, ebx, ecx, edx );
+
+    if( max_leaf < 7 ) return false;
+
+    cpuid( 1, eax, ebx, ecx, edx );
+
+    bool const ssse3 = ( ecx >> 9 ) & 1;
+
+    cpuid( 7, eax, ebx, ecx, edx );
+
+    bool const sha = ( ebx >> 29 ) & 1;
+
+    return ssse3 && sha;
+}
+
+// queried once, on first use
+
+inline bool cpu_has_sha()
+{
+    static bool const r = cpu_has_sha_();
+    return r;
+}
+
+} // namespace detail
+} // namespace hash2
+} // namespace boost
+
+#endif // #if defined(BOOST_HASH2_SHA_DISPATCH)
+
+#endif // #ifndef BOOST_HASH2_DETAIL_CPUID_HPP_INCLUDED
@@ -0,0 +1,184 @@
+#ifndef BOOST_HASH2_DETAIL_INTEGER_HASH_HPP_INCLUDED
+#define BOOST_HASH2_DETAIL_INTEGER_HASH_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/detail/read.hpp>
+#include <boost/assert.hpp>
+#include <cstdint>
+#include <cstring>
+#include <cstddef>
+
+namespace boost
+{
+namespace hash2
+{
+namespace detail
+{
+
+// https://prng.di.unimi.it/splitmix64.c
+
+inline std::uint64_t splitmix64( std::uint64_t & s )
+{
+    std::uint64_t z = ( s += 0x9e3779b97f4a7c15ull );
+
+    z = ( z ^ ( z >> 30 ) ) * 0xbf58476d1ce4e5b9ull;
+    z = ( z ^ ( z >> 27 ) ) * 0x94d049bb133111ebull;
+
+    return z ^ ( z >> 31 );
+}
+
+// reduces a byte seed to an integral one; up to eight bytes are read
+// as a little-endian integer, longer seeds are folded a word at a time
+
+inline std::uint64_t integer_hash_seed( unsigned char const * p, std::size_t n )
+{
+    if( n == 0 )
+    {
+        return 0;
+    }
+
+    unsigned char q[ 8 ] = {};
+
+    if( n <= 8 )
+    {
+        std::memcpy( q, p, n );
+        return detail::read64le( q );
+    }
+
+    std::uint64_t s = n;
+
+    for( ; n >= 8; p += 8, n -= 8 )
+    {
+        std::uint64_t t = s ^ detail::read64le( p );
+        s = splitmix64( t );
+    }
+
+    if( n > 0 )
+    {
+        std::memcpy( q, p, n );
+
+        std::uint64_t t = s ^ detail::read64le( q );
+        s = splitmix64( t );
+    }
+
+    return s;
+}
+
+// The HashAlgorithm interface of the hash functions on 64 bit integers.
+// D::operator()( std::uint64_t ) is applied to the input, a little-endian
+// word at a time, as h = D()( h ^ w ), with the trailing partial word zero
+// padded; result() then hashes h ^ ~n, n being the input length. The
+// guarantees of the family only hold for operator() itself
+
+template<class D> class integer_hash_base
+{
+private:
+
+    std::uint64_t h_;
+
+    unsigned char buffer_[ 8 ];
+    std::size_t m_; // == n % 8
+
+    std::uint64_t n_;
+
+private:
+
+    BOOST_FORCEINLINE std::uint64_t f( std::uint64_t x ) const
+    {
+        return static_cast<D const&>( *this )( x );
+    }
+
+protected:
+
+    integer_hash_base(): h_( 0 ), m_( 0 ), n_( 0 )
+    {
+        std::memset( buffer_, 0, 8 );
+    }
+
+public:
+
+    typedef std::uint64_t result_type;
+    typedef std::uint64_t size_type;
+
+    void update( void const * pv, std::size_t n )
+    {
+        unsigned char const* p = static_cast<unsigned char const*>( pv );
+
+        if( n == 0 ) return;
+
+        n_ += n;
+
+        if( m_ > 0 )
+        {
+            std::size_t k = 8 - m_;
+
+            if( n < k )
+            {
+                k = n;
+            }
+
+            std::memcpy( buffer_ + m_, p, k );
+
+            p += k;
+            n -= k;
+            m_ += k;
+
+            if( m_ < 8 ) return;
+
+            BOOST_ASSERT( m_ == 8 );
+
+            h_ = f( h_ ^ detail::read64le( buffer_ ) );
+            m_ = 0;
+        }
+
+        BOOST_ASSERT( m_ == 0 );
+
+        std::uint64_t h = h_;
+
+        for( ; n >= 8; p += 8, n -= 8 )
+        {
+            h = f( h ^ detail::read64le( p ) );
+        }
+
+        h_ = h;
+
+        BOOST_ASSERT( n < 8 );
+
+        if( n > 0 )
+        {
+            std::memcpy( buffer_, p, n );
+            m_ = n;
+        }
+    }
+
+    std::uint64_t result()
+    {
+        if( m_ > 0 )
+        {
+            std::memset( buffer_ + m_, 0, 8 - m_ );
+
+            h_ = f( h_ ^ detail::read64le( buffer_ ) );
+            m_ = 0;
+        }
+
+        // clear buffered plaintext
+        std::memset( buffer_, 0, 8 );
+
+        // the result becomes the state, so that multiple
+        // result() calls generate a sequence of distinct
+        // values
+
+        h_ = f( h_ ^ ~n_ );
+
+        return h_;
+    }
+};
+
+} // namespace detail
+} // namespace hash2
+} // namespace boost
+
+#endif // #ifndef BOOST_HASH2_DETAIL_INTEGER_HASH_HPP_INCLUDED
@@ -0,0 +1,31 @@
+#ifndef BOOST_HASH2_DETAIL_INTRIN_HPP_INCLUDED
+#define BOOST_HASH2_DETAIL_INTRIN_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/detail/config.hpp>
+
+#if defined(BOOST_HASH2_HAS_SSE2)
+
+#if defined(__GNUC__) && !defined(__clang__)
+
+// GCC 12 issues spurious -Wuninitialized and -Wmaybe-uninitialized
+// warnings from the AVX-512 intrinsics; see GCC bug 105593
+
+# pragma GCC diagnostic push
+# pragma GCC diagnostic ignored "-Wuninitialized"
+# pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+
+#endif
+
+#include <immintrin.h>
+
+#if defined(__GNUC__) && !defined(__clang__)
+# pragma GCC diagnostic pop
+#endif
+
+#endif // #if defined(BOOST_HASH2_HAS_SSE2)
+
+#endif // #ifndef BOOST_HASH2_DETAIL_INTRIN_HPP_INCLUDED
@@ -0,0 +1,76 @@
+#ifndef BOOST_HASH2_DETAIL_MUL128_HPP_INCLUDED
+#define BOOST_HASH2_DETAIL_MUL128_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/config.hpp>
+#include <cstdint>
+
+#if defined(_MSC_VER) && defined(_M_X64) && !defined(__clang__)
+# include <intrin.h>
+#endif
+
+namespace boost
+{
+namespace hash2
+{
+namespace detail
+{
+
+struct uint128
+{
+    std::uint64_t low;
+    std::uint64_t high;
+};
+
+BOOST_FORCEINLINE uint128 mul128( std::uint64_t x, std::uint64_t y )
+{
+    uint128 r;
+
+#if defined(BOOST_HAS_INT128)
+
+    __extension__ typedef unsigned __int128 uint128_t;
+
+    uint128_t p = static_cast<uint128_t>( x ) * y;
+
+    r.low = static_cast<std::uint64_t>( p );
+    r.high = static_cast<std::uint64_t>( p >> 64 );
+
+#elif defined(_MSC_VER) && defined(_M_X64) && !defined(__clang__)
+
+    r.low = _umul128( x, y, &r.high );
+
+#else
+
+    std::uint64_t x0 = x & 0xFFFFFFFFu, x1 = x >> 32;
+    std::uint64_t y0 = y & 0xFFFFFFFFu, y1 = y >> 32;
+
+    std::uint64_t p00 = x0 * y0;
+    std::uint64_t p01 = x0 * y1;
+    std::uint64_t p10 = x1 * y0;
+    std::uint64_t p11 = x1 * y1;
+
+    std::uint64_t mid = ( p00 >> 32 ) + ( p10 & 0xFFFFFFFFu ) + p01;
+
+    r.low = ( mid << 32 ) | ( p00 & 0xFFFFFFFFu );
+    r.high = p11 + ( p10 >> 32 ) + ( mid >> 32 );
+
+#endif
+
+    return r;
+}
+
+// the low and high halves of the product, xor-ed together
+BOOST_FORCEINLINE std::uint64_t mulx( std::uint64_t x, std::uint64_t y )
+{
+    uint128 r = mul128( x, y );
+    return r.low ^ r.high;
+}
+
+} // namespace detail
+} // namespace hash2
+} // namespace boost
+
+#endif // #ifndef BOOST_HASH2_DETAIL_MUL128_HPP_INCLUDED
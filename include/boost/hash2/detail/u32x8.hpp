@@ -0,0 +1,467 @@
+#ifndef BOOST_HASH2_DETAIL_U32X8_HPP_INCLUDED
+#define BOOST_HASH2_DETAIL_U32X8_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// Eight 32 bit lanes, held in one AVX2 register, two SSE2 registers,
+// or a plain array
+
+#include <boost/hash2/detail/config.hpp>
+#include <boost/hash2/detail/intrin.hpp>
+#include <boost/hash2/detail/rot.hpp>
+#include <boost/hash2/detail/read.hpp>
+#include <boost/config.hpp>
+#include <cstdint>
+#include <cstddef>
+
+namespace boost
+{
+namespace hash2
+{
+namespace detail
+{
+
+#if defined(BOOST_HASH2_HAS_AVX2)
+
+struct u32x8
+{
+    __m256i v;
+};
+
+BOOST_FORCEINLINE u32x8 make_u32x8( __m256i v )
+{
+    u32x8 r = { v };
+    return r;
+}
+
+BOOST_FORCEINLINE u32x8 load_u32x8( std::uint32_t const * p )
+{
+    return make_u32x8( _mm256_loadu_si256( reinterpret_cast<__m256i const*>( p ) ) );
+}
+
+BOOST_FORCEINLINE void store_u32x8( std::uint32_t * p, u32x8 x )
+{
+    _mm256_storeu_si256( reinterpret_cast<__m256i*>( p ), x.v );
+}
+
+BOOST_FORCEINLINE u32x8 set1_u32x8( std::uint32_t x )
+{
+    return make_u32x8( _mm256_set1_epi32( static_cast<int>( x ) ) );
+}
+
+BOOST_FORCEINLINE u32x8 operator+( u32x8 x, u32x8 y )
+{
+    return make_u32x8( _mm256_add_epi32( x.v, y.v ) );
+}
+
+BOOST_FORCEINLINE u32x8 operator^( u32x8 x, u32x8 y )
+{
+    return make_u32x8( _mm256_xor_si256( x.v, y.v ) );
+}
+
+BOOST_FORCEINLINE u32x8 operator&( u32x8 x, u32x8 y )
+{
+    return make_u32x8( _mm256_and_si256( x.v, y.v ) );
+}
+
+BOOST_FORCEINLINE u32x8 operator|( u32x8 x, u32x8 y )
+{
+    return make_u32x8( _mm256_or_si256( x.v, y.v ) );
+}
+
+// the low 32 bits of the products
+BOOST_FORCEINLINE u32x8 operator*( u32x8 x, u32x8 y )
+{
+    return make_u32x8( _mm256_mullo_epi32( x.v, y.v ) );
+}
+
+template<int K> BOOST_FORCEINLINE u32x8 shr( u32x8 x )
+{
+    return make_u32x8( _mm256_srli_epi32( x.v, K ) );
+}
+
+#if defined(BOOST_HASH2_HAS_AVX512)
+
+template<int K> BOOST_FORCEINLINE u32x8 rotl( u32x8 x )
+{
+    return make_u32x8( _mm256_rol_epi32( x.v, K ) );
+}
+
+// x? y: z
+BOOST_FORCEINLINE u32x8 select( u32x8 x, u32x8 y, u32x8 z )
+{
+    return make_u32x8( _mm256_ternarylogic_epi32( x.v, y.v, z.v, 0xCA ) );
+}
+
+BOOST_FORCEINLINE u32x8 xor3( u32x8 x, u32x8 y, u32x8 z )
+{
+    return make_u32x8( _mm256_ternarylogic_epi32( x.v, y.v, z.v, 0x96 ) );
+}
+
+BOOST_FORCEINLINE u32x8 majority( u32x8 x, u32x8 y, u32x8 z )
+{
+    return make_u32x8( _mm256_ternarylogic_epi32( x.v, y.v, z.v, 0xE8 ) );
+}
+
+// y ^ ( x | ~z ), the I function of MD5
+BOOST_FORCEINLINE u32x8 xor_or_not( u32x8 x, u32x8 y, u32x8 z )
+{
+    return make_u32x8( _mm256_ternarylogic_epi32( x.v, y.v, z.v, 0x39 ) );
+}
+
+#else
+
+template<int K> BOOST_FORCEINLINE u32x8 rotl( u32x8 x )
+{
+    return make_u32x8( _mm256_or_si256( _mm256_slli_epi32( x.v, K ), _mm256_srli_epi32( x.v, 32 - K ) ) );
+}
+
+#endif
+
+BOOST_FORCEINLINE u32x8 operator~( u32x8 x )
+{
+    return make_u32x8( _mm256_xor_si256( x.v, _mm256_set1_epi32( -1 ) ) );
+}
+
+// w[ i ] receives the little endian words at p[ 0 ] + offset + 4 * i,
+// ..., p[ 7 ] + offset + 4 * i, i < 16
+
+BOOST_FORCEINLINE void load_u32x8_transposed( unsigned char const * const p[ 8 ], std::size_t offset, u32x8 w[ 16 ] )
+{
+    for( int k = 0; k < 2; ++k )
+    {
+        __m256i r[ 8 ];
+
+        for( int j = 0; j < 8; ++j )
+        {
+            r[ j ] = _mm256_loadu_si256( reinterpret_cast<__m256i const*>( p[ j ] + offset + k * 32 ) );
+        }
+
+        __m256i t0 = _mm256_unpacklo_epi32( r[ 0 ], r[ 1 ] );
+        __m256i t1 = _mm256_unpackhi_epi32( r[ 0 ], r[ 1 ] );
+        __m256i t2 = _mm256_unpacklo_epi32( r[ 2 ], r[ 3 ] );
+        __m256i t3 = _mm256_unpackhi_epi32( r[ 2 ], r[ 3 ] );
+        __m256i t4 = _mm256_unpacklo_epi32( r[ 4 ], r[ 5 ] );
+        __m256i t5 = _mm256_unpackhi_epi32( r[ 4 ], r[ 5 ] );
+        __m256i t6 = _mm256_unpacklo_epi32( r[ 6 ], r[ 7 ] );
+        __m256i t7 = _mm256_unpackhi_epi32( r[ 6 ], r[ 7 ] );
+
+        __m256i u0 = _mm256_unpacklo_epi64( t0, t2 );
+        __m256i u1 = _mm256_unpackhi_epi64( t0, t2 );
+        __m256i u2 = _mm256_unpacklo_epi64( t1, t3 );
+        __m256i u3 = _mm256_unpackhi_epi64( t1, t3 );
+        __m256i u4 = _mm256_unpacklo_epi64( t4, t6 );
+        __m256i u5 = _mm256_unpackhi_epi64( t4, t6 );
+        __m256i u6 = _mm256_unpacklo_epi64( t5, t7 );
+        __m256i u7 = _mm256_unpackhi_epi64( t5, t7 );
+
+        u32x8 * q = w + k * 8;
+
+        q[ 0 ] = make_u32x8( _mm256_permute2x128_si256( u0, u4, 0x20 ) );
+        q[ 1 ] = make_u32x8( _mm256_permute2x128_si256( u1, u5, 0x20 ) );
+        q[ 2 ] = make_u32x8( _mm256_permute2x128_si256( u2, u6, 0x20 ) );
+        q[ 3 ] = make_u32x8( _mm256_permute2x128_si256( u3, u7, 0x20 ) );
+        q[ 4 ] = make_u32x8( _mm256_permute2x128_si256( u0, u4, 0x31 ) );
+        q[ 5 ] = make_u32x8( _mm256_permute2x128_si256( u1, u5, 0x31 ) );
+        q[ 6 ] = make_u32x8( _mm256_permute2x128_si256( u2, u6, 0x31 ) );
+        q[ 7 ] = make_u32x8( _mm256_permute2x128_si256( u3, u7, 0x31 ) );
+    }
+}
+
+#elif defined(BOOST_HASH2_HAS_SSE2)
+
+struct u32x8
+{
+    __m128i v0, v1;
+};
+
+BOOST_FORCEINLINE u32x8 make_u32x8( __m128i v0, __m128i v1 )
+{
+    u32x8 r = { v0, v1 };
+    return r;
+}
+
+BOOST_FORCEINLINE u32x8 load_u32x8( std::uint32_t const * p )
+{
+    return make_u32x8( _mm_loadu_si128( reinterpret_cast<__m128i const*>( p ) ), _mm_loadu_si128( reinterpret_cast<__m128i const*>( p + 4 ) ) );
+}
+
+BOOST_FORCEINLINE void store_u32x8( std::uint32_t * p, u32x8 x )
+{
+    _mm_storeu_si128( reinterpret_cast<__m128i*>( p ), x.v0 );
+    _mm_storeu_si128( reinterpret_cast<__m128i*>( p + 4 ), x.v1 );
+}
+
+BOOST_FORCEINLINE u32x8 set1_u32x8( std::uint32_t x )
+{
+    __m128i v = _mm_set1_epi32( static_cast<int>( x ) );
+    return make_u32x8( v, v );
+}
+
+BOOST_FORCEINLINE u32x8 operator+( u32x8 x, u32x8 y )
+{
+    return make_u32x8( _mm_add_epi32( x.v0, y.v0 ), _mm_add_epi32( x.v1, y.v1 ) );
+}
+
+BOOST_FORCEINLINE u32x8 operator^( u32x8 x, u32x8 y )
+{
+    return make_u32x8( _mm_xor_si128( x.v0, y.v0 ), _mm_xor_si128( x.v1, y.v1 ) );
+}
+
+BOOST_FORCEINLINE u32x8 operator&( u32x8 x, u32x8 y )
+{
+    return make_u32x8( _mm_and_si128( x.v0, y.v0 ), _mm_and_si128( x.v1, y.v1 ) );
+}
+
+BOOST_FORCEINLINE u32x8 operator|( u32x8 x, u32x8 y )
+{
+    return make_u32x8( _mm_or_si128( x.v0, y.v0 ), _mm_or_si128( x.v1, y.v1 ) );
+}
+
+#if defined(BOOST_HASH2_HAS_SSE41)
+
+BOOST_FORCEINLINE __m128i mullo_epi32( __m128i x, __m128i y )
+{
+    return _mm_mullo_epi32( x, y );
+}
+
+#else
+
+BOOST_FORCEINLINE __m128i mullo_epi32( __m128i x, __m128i y )
+{
+    __m128i even = _mm_mul_epu32( x, y );
+    __m128i odd = _mm_mul_epu32( _mm_srli_epi64( x, 32 ), _mm_srli_epi64( y, 32 ) );
+
+    return _mm_unpacklo_epi32( _mm_shuffle_epi32( even, 0x08 ), _mm_shuffle_epi32( odd, 0x08 ) );
+}
+
+#endif
+
+// the low 32 bits of the products
+BOOST_FORCEINLINE u32x8 operator*( u32x8 x, u32x8 y )
+{
+    return make_u32x8( mullo_epi32( x.v0, y.v0 ), mullo_epi32( x.v1, y.v1 ) );
+}
+
+BOOST_FORCEINLINE u32x8 operator~( u32x8 x )
+{
+    __m128i const m = _mm_set1_epi32( -1 );
+    return make_u32x8( _mm_xor_si128( x.v0, m ), _mm_xor_si128( x.v1, m ) );
+}
+
+// w[ i ] receives the little endian words at p[ 0 ] + offset + 4 * i,
+// ..., p[ 7 ] + offset + 4 * i, i < 16
+
+BOOST_FORCEINLINE void load_u32x8_transposed( unsigned char const * const p[ 8 ], std::size_t offset, u32x8 w[ 16 ] )
+{
+    for( int k = 0; k < 4; ++k )
+    {
+        __m128i r[ 8 ];
+
+        for( int j = 0; j < 8; ++j )
+        {
+            r[ j ] = _mm_loadu_si128( reinterpret_cast<__m128i const*>( p[ j ] + offset + k * 16 ) );
+        }
+
+        __m128i o[ 8 ];
+
+        for( int j = 0; j < 8; j += 4 )
+        {
+            __m128i t0 = _mm_unpacklo_epi32( r[ j + 0 ], r[ j + 1 ] );
+            __m128i t1 = _mm_unpacklo_epi32( r[ j + 2 ], r[ j + 3 ] );
+            __m128i t2 = _mm_unpackhi_epi32( r[ j + 0 ], r[ j + 1 ] );
+            __m128i t3 = _mm_unpackhi_epi32( r[ j + 2 ], r[ j + 3 ] );
+
+            o[ j + 0 ] = _mm_unpacklo_epi64( t0, t1 );
+            o[ j + 1 ] = _mm_unpackhi_epi64( t0, t1 );
+            o[ j + 2 ] = _mm_unpacklo_epi64( t2, t3 );
+            o[ j + 3 ] = _mm_unpackhi_epi64( t2, t3 );
+        }
+
+        for( int i = 0; i < 4; ++i )
+        {
+            w[ k * 4 + i ] = make_u32x8( o[ i ], o[ i + 4 ] );
+        }
+    }
+}
+
+template<int K> BOOST_FORCEINLINE u32x8 shr( u32x8 x )
+{
+    return make_u32x8( _mm_srli_epi32( x.v0, K ), _mm_srli_epi32( x.v1, K ) );
+}
+
+template<int K> BOOST_FORCEINLINE u32x8 rotl( u32x8 x )
+{
+    return make_u32x8(
+        _mm_or_si128( _mm_slli_epi32( x.v0, K ), _mm_srli_epi32( x.v0, 32 - K ) ),
+        _mm_or_si128( _mm_slli_epi32( x.v1, K ), _mm_srli_epi32( x.v1, 32 - K ) ) );
+}
+
+#else
+
+struct u32x8
+{
+    std::uint32_t v[ 8 ];
+};
+
+BOOST_FORCEINLINE u32x8 load_u32x8( std::uint32_t const * p )
+{
+    u32x8 r;
+
+    for( int i = 0; i < 8; ++i )
+    {
+        r.v[ i ] = p[ i ];
+    }
+
+    return r;
+}
+
+BOOST_FORCEINLINE void store_u32x8( std::uint32_t * p, u32x8 x )
+{
+    for( int i = 0; i < 8; ++i )
+    {
+        p[ i ] = x.v[ i ];
+    }
+}
+
+BOOST_FORCEINLINE u32x8 set1_u32x8( std::uint32_t x )
+{
+    u32x8 r;
+
+    for( int i = 0; i < 8; ++i )
+    {
+        r.v[ i ] = x;
+    }
+
+    return r;
+}
+
+BOOST_FORCEINLINE u32x8 operator+( u32x8 x, u32x8 y )
+{
+    for( int i = 0; i < 8; ++i )
+    {
+        x.v[ i ] += y.v[ i ];
+    }
+
+    return x;
+}
+
+BOOST_FORCEINLINE u32x8 operator^( u32x8 x, u32x8 y )
+{
+    for( int i = 0; i < 8; ++i )
+    {
+        x.v[ i ] ^= y.v[ i ];
+    }
+
+    return x;
+}
+
+BOOST_FORCEINLINE u32x8 operator&( u32x8 x, u32x8 y )
+{
+    for( int i = 0; i < 8; ++i )
+    {
+        x.v[ i ] &= y.v[ i ];
+    }
+
+    return x;
+}
+
+BOOST_FORCEINLINE u32x8 operator|( u32x8 x, u32x8 y )
+{
+    for( int i = 0; i < 8; ++i )
+    {
+        x.v[ i ] |= y.v[ i ];
+    }
+
+    return x;
+}
+
+BOOST_FORCEINLINE u32x8 operator*( u32x8 x, u32x8 y )
+{
+    for( int i = 0; i < 8; ++i )
+    {
+        x.v[ i ] *= y.v[ i ];
+    }
+
+    return x;
+}
+
+BOOST_FORCEINLINE u32x8 operator~( u32x8 x )
+{
+    for( int i = 0; i < 8; ++i )
+    {
+        x.v[ i ] = ~x.v[ i ];
+    }
+
+    return x;
+}
+
+// w[ i ] receives the little endian words at p[ 0 ] + offset + 4 * i,
+// ..., p[ 7 ] + offset + 4 * i, i < 16
+
+BOOST_FORCEINLINE void load_u32x8_transposed( unsigned char const * const p[ 8 ], std::size_t offset, u32x8 w[ 16 ] )
+{
+    for( int i = 0; i < 16; ++i )
+    {
+        for( int j = 0; j < 8; ++j )
+        {
+            w[ i ].v[ j ] = detail::read32le( p[ j ] + offset + i * 4 );
+        }
+    }
+}
+
+template<int K> BOOST_FORCEINLINE u32x8 shr( u32x8 x )
+{
+    for( int i = 0; i < 8; ++i )
+    {
+        x.v[ i ] >>= K;
+    }
+
+    return x;
+}
+
+template<int K> BOOST_FORCEINLINE u32x8 rotl( u32x8 x )
+{
+    for( int i = 0; i < 8; ++i )
+    {
+        x.v[ i ] = detail::rotl( x.v[ i ], K );
+    }
+
+    return x;
+}
+
+#endif
+
+#if !defined(BOOST_HASH2_HAS_AVX2) || !defined(BOOST_HASH2_HAS_AVX512)
+
+// x? y: z
+BOOST_FORCEINLINE u32x8 select( u32x8 x, u32x8 y, u32x8 z )
+{
+    return z ^ ( x & ( y ^ z ) );
+}
+
+BOOST_FORCEINLINE u32x8 xor3( u32x8 x, u32x8 y, u32x8 z )
+{
+    return x ^ y ^ z;
+}
+
+BOOST_FORCEINLINE u32x8 majority( u32x8 x, u32x8 y, u32x8 z )
+{
+    return ( x & y ) | ( z & ( x | y ) );
+}
+
+// y ^ ( x | ~z ), the I function of MD5
+BOOST_FORCEINLINE u32x8 xor_or_not( u32x8 x, u32x8 y, u32x8 z )
+{
+    return y ^ ( x | ~z );
+}
+
+#endif
+
+} // namespace detail
+} // namespace hash2
+} // namespace boost
+
+#endif // #ifndef BOOST_HASH2_DETAIL_U32X8_HPP_INCLUDED
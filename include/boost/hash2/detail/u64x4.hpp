@@ -0,0 +1,345 @@
+#ifndef BOOST_HASH2_DETAIL_U64X4_HPP_INCLUDED
+#define BOOST_HASH2_DETAIL_U64X4_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// Four 64 bit lanes, held in one AVX2 register, two SSE2 registers,
+// or a plain array
+
+#include <boost/hash2/detail/config.hpp>
+#include <boost/hash2/detail/intrin.hpp>
+#include <boost/hash2/detail/rot.hpp>
+#include <boost/hash2/detail/read.hpp>
+#include <boost/config.hpp>
+#include <cstdint>
+#include <cstddef>
+
+namespace boost
+{
+namespace hash2
+{
+namespace detail
+{
+
+#if defined(BOOST_HASH2_HAS_AVX2)
+
+struct u64x4
+{
+    __m256i v;
+};
+
+BOOST_FORCEINLINE u64x4 make_u64x4( __m256i v )
+{
+    u64x4 r = { v };
+    return r;
+}
+
+BOOST_FORCEINLINE u64x4 load_u64x4( std::uint64_t const * p )
+{
+    return make_u64x4( _mm256_loadu_si256( reinterpret_cast<__m256i const*>( p ) ) );
+}
+
+BOOST_FORCEINLINE void store_u64x4( std::uint64_t * p, u64x4 x )
+{
+    _mm256_storeu_si256( reinterpret_cast<__m256i*>( p ), x.v );
+}
+
+BOOST_FORCEINLINE u64x4 set1_u64x4( std::uint64_t x )
+{
+    return make_u64x4( _mm256_set1_epi64x( static_cast<long long>( x ) ) );
+}
+
+BOOST_FORCEINLINE u64x4 operator+( u64x4 x, u64x4 y )
+{
+    return make_u64x4( _mm256_add_epi64( x.v, y.v ) );
+}
+
+BOOST_FORCEINLINE u64x4 operator^( u64x4 x, u64x4 y )
+{
+    return make_u64x4( _mm256_xor_si256( x.v, y.v ) );
+}
+
+BOOST_FORCEINLINE u64x4 operator&( u64x4 x, u64x4 y )
+{
+    return make_u64x4( _mm256_and_si256( x.v, y.v ) );
+}
+
+#if defined(BOOST_HASH2_HAS_AVX512)
+
+// the low 64 bits of the products
+BOOST_FORCEINLINE u64x4 operator*( u64x4 x, u64x4 y )
+{
+    return make_u64x4( _mm256_mullo_epi64( x.v, y.v ) );
+}
+
+template<int K> BOOST_FORCEINLINE u64x4 rotl( u64x4 x )
+{
+    return make_u64x4( _mm256_rol_epi64( x.v, K ) );
+}
+
+#else
+
+// the low 64 bits of the products, from three 32x32 bit ones
+BOOST_FORCEINLINE u64x4 operator*( u64x4 x, u64x4 y )
+{
+    __m256i t = _mm256_add_epi64( _mm256_mul_epu32( _mm256_srli_epi64( x.v, 32 ), y.v ), _mm256_mul_epu32( x.v, _mm256_srli_epi64( y.v, 32 ) ) );
+    return make_u64x4( _mm256_add_epi64( _mm256_mul_epu32( x.v, y.v ), _mm256_slli_epi64( t, 32 ) ) );
+}
+
+template<int K> BOOST_FORCEINLINE u64x4 rotl( u64x4 x )
+{
+    return make_u64x4( _mm256_or_si256( _mm256_slli_epi64( x.v, K ), _mm256_srli_epi64( x.v, 64 - K ) ) );
+}
+
+#endif
+
+template<int K> BOOST_FORCEINLINE u64x4 shr( u64x4 x )
+{
+    return make_u64x4( _mm256_srli_epi64( x.v, K ) );
+}
+
+// w[ i ] receives the little endian words at p[ 0 ] + offset + 8 * i,
+// ..., p[ 3 ] + offset + 8 * i, i < 8
+
+BOOST_FORCEINLINE void load_u64x4_transposed( unsigned char const * const p[ 4 ], std::size_t offset, u64x4 w[ 8 ] )
+{
+    for( int k = 0; k < 2; ++k )
+    {
+        __m256i r[ 4 ];
+
+        for( int j = 0; j < 4; ++j )
+        {
+            r[ j ] = _mm256_loadu_si256( reinterpret_cast<__m256i const*>( p[ j ] + offset + k * 32 ) );
+        }
+
+        __m256i t0 = _mm256_unpacklo_epi64( r[ 0 ], r[ 1 ] );
+        __m256i t1 = _mm256_unpackhi_epi64( r[ 0 ], r[ 1 ] );
+        __m256i t2 = _mm256_unpacklo_epi64( r[ 2 ], r[ 3 ] );
+        __m256i t3 = _mm256_unpackhi_epi64( r[ 2 ], r[ 3 ] );
+
+        u64x4 * q = w + k * 4;
+
+        q[ 0 ] = make_u64x4( _mm256_permute2x128_si256( t0, t2, 0x20 ) );
+        q[ 1 ] = make_u64x4( _mm256_permute2x128_si256( t1, t3, 0x20 ) );
+        q[ 2 ] = make_u64x4( _mm256_permute2x128_si256( t0, t2, 0x31 ) );
+        q[ 3 ] = make_u64x4( _mm256_permute2x128_si256( t1, t3, 0x31 ) );
+    }
+}
+
+#elif defined(BOOST_HASH2_HAS_SSE2)
+
+struct u64x4
+{
+    __m128i v0, v1;
+};
+
+BOOST_FORCEINLINE u64x4 make_u64x4( __m128i v0, __m128i v1 )
+{
+    u64x4 r = { v0, v1 };
+    return r;
+}
+
+BOOST_FORCEINLINE u64x4 load_u64x4( std::uint64_t const * p )
+{
+    return make_u64x4( _mm_loadu_si128( reinterpret_cast<__m128i const*>( p ) ), _mm_loadu_si128( reinterpret_cast<__m128i const*>( p + 2 ) ) );
+}
+
+BOOST_FORCEINLINE void store_u64x4( std::uint64_t * p, u64x4 x )
+{
+    _mm_storeu_si128( reinterpret_cast<__m128i*>( p ), x.v0 );
+    _mm_storeu_si128( reinterpret_cast<__m128i*>( p + 2 ), x.v1 );
+}
+
+BOOST_FORCEINLINE u64x4 set1_u64x4( std::uint64_t x )
+{
+    // _mm_set1_epi64x is missing on 32 bit MSVC
+    __m128i v = _mm_set_epi32( static_cast<int>( x >> 32 ), static_cast<int>( x ), static_cast<int>( x >> 32 ), static_cast<int>( x ) );
+    return make_u64x4( v, v );
+}
+
+BOOST_FORCEINLINE u64x4 operator+( u64x4 x, u64x4 y )
+{
+    return make_u64x4( _mm_add_epi64( x.v0, y.v0 ), _mm_add_epi64( x.v1, y.v1 ) );
+}
+
+BOOST_FORCEINLINE u64x4 operator^( u64x4 x, u64x4 y )
+{
+    return make_u64x4( _mm_xor_si128( x.v0, y.v0 ), _mm_xor_si128( x.v1, y.v1 ) );
+}
+
+BOOST_FORCEINLINE u64x4 operator&( u64x4 x, u64x4 y )
+{
+    return make_u64x4( _mm_and_si128( x.v0, y.v0 ), _mm_and_si128( x.v1, y.v1 ) );
+}
+
+BOOST_FORCEINLINE __m128i mullo_epi64( __m128i x, __m128i y )
+{
+    __m128i t = _mm_add_epi64( _mm_mul_epu32( _mm_srli_epi64( x, 32 ), y ), _mm_mul_epu32( x, _mm_srli_epi64( y, 32 ) ) );
+    return _mm_add_epi64( _mm_mul_epu32( x, y ), _mm_slli_epi64( t, 32 ) );
+}
+
+// the low 64 bits of the products, from three 32x32 bit ones
+BOOST_FORCEINLINE u64x4 operator*( u64x4 x, u64x4 y )
+{
+    return make_u64x4( mullo_epi64( x.v0, y.v0 ), mullo_epi64( x.v1, y.v1 ) );
+}
+
+template<int K> BOOST_FORCEINLINE u64x4 rotl( u64x4 x )
+{
+    return make_u64x4(
+        _mm_or_si128( _mm_slli_epi64( x.v0, K ), _mm_srli_epi64( x.v0, 64 - K ) ),
+        _mm_or_si128( _mm_slli_epi64( x.v1, K ), _mm_srli_epi64( x.v1, 64 - K ) ) );
+}
+
+template<int K> BOOST_FORCEINLINE u64x4 shr( u64x4 x )
+{
+    return make_u64x4( _mm_srli_epi64( x.v0, K ), _mm_srli_epi64( x.v1, K ) );
+}
+
+// w[ i ] receives the little endian words at p[ 0 ] + offset + 8 * i,
+// ..., p[ 3 ] + offset + 8 * i, i < 8
+
+BOOST_FORCEINLINE void load_u64x4_transposed( unsigned char const * const p[ 4 ], std::size_t offset, u64x4 w[ 8 ] )
+{
+    for( int k = 0; k < 4; ++k )
+    {
+        __m128i r[ 4 ];
+
+        for( int j = 0; j < 4; ++j )
+        {
+            r[ j ] = _mm_loadu_si128( reinterpret_cast<__m128i const*>( p[ j ] + offset + k * 16 ) );
+        }
+
+        w[ k * 2 + 0 ] = make_u64x4( _mm_unpacklo_epi64( r[ 0 ], r[ 1 ] ), _mm_unpacklo_epi64( r[ 2 ], r[ 3 ] ) );
+        w[ k * 2 + 1 ] = make_u64x4( _mm_unpackhi_epi64( r[ 0 ], r[ 1 ] ), _mm_unpackhi_epi64( r[ 2 ], r[ 3 ] ) );
+    }
+}
+
+#else
+
+struct u64x4
+{
+    std::uint64_t v[ 4 ];
+};
+
+BOOST_FORCEINLINE u64x4 load_u64x4( std::uint64_t const * p )
+{
+    u64x4 r;
+
+    for( int i = 0; i < 4; ++i )
+    {
+        r.v[ i ] = p[ i ];
+    }
+
+    return r;
+}
+
+BOOST_FORCEINLINE void store_u64x4( std::uint64_t * p, u64x4 x )
+{
+    for( int i = 0; i < 4; ++i )
+    {
+        p[ i ] = x.v[ i ];
+    }
+}
+
+BOOST_FORCEINLINE u64x4 set1_u64x4( std::uint64_t x )
+{
+    u64x4 r;
+
+    for( int i = 0; i < 4; ++i )
+    {
+        r.v[ i ] = x;
+    }
+
+    return r;
+}
+
+BOOST_FORCEINLINE u64x4 operator+( u64x4 x, u64x4 y )
+{
+    for( int i = 0; i < 4; ++i )
+    {
+        x.v[ i ] += y.v[ i ];
+    }
+
+    return x;
+}
+
+BOOST_FORCEINLINE u64x4 operator^( u64x4 x, u64x4 y )
+{
+    for( int i = 0; i < 4; ++i )
+    {
+        x.v[ i ] ^= y.v[ i ];
+    }
+
+    return x;
+}
+
+BOOST_FORCEINLINE u64x4 operator&( u64x4 x, u64x4 y )
+{
+    for( int i = 0; i < 4; ++i )
+    {
+        x.v[ i ] &= y.v[ i ];
+    }
+
+    return x;
+}
+
+BOOST_FORCEINLINE u64x4 operator*( u64x4 x, u64x4 y )
+{
+    for( int i = 0; i < 4; ++i )
+    {
+        x.v[ i ] *= y.v[ i ];
+    }
+
+    return x;
+}
+
+template<int K> BOOST_FORCEINLINE u64x4 rotl( u64x4 x )
+{
+    for( int i = 0; i < 4; ++i )
+    {
+        x.v[ i ] = detail::rotl( x.v[ i ], K );
+    }
+
+    return x;
+}
+
+template<int K> BOOST_FORCEINLINE u64x4 shr( u64x4 x )
+{
+    for( int i = 0; i < 4; ++i )
+    {
+        x.v[ i ] >>= K;
+    }
+
+    return x;
+}
+
+// w[ i ] receives the little endian words at p[ 0 ] + offset + 8 * i,
+// ..., p[ 3 ] + offset + 8 * i, i < 8
+
+BOOST_FORCEINLINE void load_u64x4_transposed( unsigned char const * const p[ 4 ], std::size_t offset, u64x4 w[ 8 ] )
+{
+    for( int i = 0; i < 8; ++i )
+    {
+        for( int j = 0; j < 4; ++j )
+        {
+            w[ i ].v[ j ] = detail::read64le( p[ j ] + offset + i * 8 );
+        }
+    }
+}
+
+#endif
+
+// x? y: z
+BOOST_FORCEINLINE u64x4 select( u64x4 x, u64x4 y, u64x4 z )
+{
+    return z ^ ( x & ( y ^ z ) );
+}
+
+} // namespace detail
+} // namespace hash2
+} // namespace boost
+
+#endif // #ifndef BOOST_HASH2_DETAIL_U64X4_HPP_INCLUDED
@@ -0,0 +1,343 @@
+#ifndef BOOST_HASH2_FLETCHER_HPP_INCLUDED
+#define BOOST_HASH2_FLETCHER_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// Fletcher-64, https://en.wikipedia.org/wiki/Fletcher%27s_checksum
+
+#include <boost/hash2/detail/config.hpp>
+#include <boost/hash2/detail/intrin.hpp>
+#include <boost/hash2/detail/read.hpp>
+#include <boost/hash2/detail/write.hpp>
+#include <boost/assert.hpp>
+#include <cstdint>
+#include <cstring>
+#include <cstddef>
+
+namespace boost
+{
+namespace hash2
+{
+
+// Fletcher-64 sums the input as little-endian 32 bit words, modulo
+// 2^32 - 1. A trailing partial word is padded with zeros, as in the
+// reference implementation, so trailing zero bytes up to a multiple
+// of four don't change the result; hash_append prefixes ranges with
+// their length, which tells these apart.
+
+class fletcher64
+{
+private:
+
+    static const std::uint64_t M = 0xFFFFFFFFu;
+
+    // the sums are reduced once every NMAX words; with s1 and s2
+    // below 2^32, s2 stays below 2^32 (NMAX + 1) (NMAX + 2) / 2
+    static const std::size_t NMAX = 16384;
+
+    std::uint64_t s1_, s2_;
+
+    unsigned char buffer_[ 4 ];
+    std::size_t m_; // == n % 4
+
+private:
+
+    static BOOST_FORCEINLINE std::uint64_t reduce( std::uint64_t x )
+    {
+        x = ( x & M ) + ( x >> 32 );
+        x = ( x & M ) + ( x >> 32 );
+
+        return x >= M? x - M: x;
+    }
+
+    static void update_( std::uint64_t & s1, std::uint64_t & s2, unsigned char const * p, std::size_t k )
+    {
+        BOOST_ASSERT( k <= NMAX );
+
+        for( ; k >= 4; k -= 4, p += 16 )
+        {
+            s1 += detail::read32le( p +  0 ); s2 += s1;
+            s1 += detail::read32le( p +  4 ); s2 += s1;
+            s1 += detail::read32le( p +  8 ); s2 += s1;
+            s1 += detail::read32le( p + 12 ); s2 += s1;
+        }
+
+        for( ; k > 0; --k, p += 4 )
+        {
+            s1 += detail::read32le( p ); s2 += s1;
+        }
+
+        s1 = reduce( s1 );
+        s2 = reduce( s2 );
+    }
+
+#if defined(BOOST_HASH2_HAS_AVX2) && ( defined(__x86_64__) || defined(_M_X64) )
+
+    static const std::size_t W = 8; // words per block
+
+    // k blocks of eight words, with the sums of s1 deferred in ps, and
+    // the words weighted by their distance from the end of the block in
+    // s2; the even and the odd words are in separate 64 bit lanes
+
+    static void update_v( std::uint64_t & s1, std::uint64_t & s2, unsigned char const * p, std::size_t k )
+    {
+        BOOST_ASSERT( k * W <= NMAX );
+
+        __m256i const we = _mm256_set_epi64x( 2, 4, 6, 8 );
+        __m256i const wo = _mm256_set_epi64x( 1, 3, 5, 7 );
+
+        __m256i const m = _mm256_set1_epi64x( static_cast<long long>( M ) );
+
+        __m256i v_ps = _mm256_setzero_si256();
+        __m256i v_s1 = _mm256_setzero_si256();
+        __m256i v_s2 = _mm256_setzero_si256();
+
+        for( std::size_t i = 0; i < k; ++i, p += 32 )
+        {
+            __m256i const w = _mm256_loadu_si256( reinterpret_cast<__m256i const*>( p ) );
+            __m256i const o = _mm256_srli_epi64( w, 32 );
+
+            v_ps = _mm256_add_epi64( v_ps, v_s1 );
+
+            v_s1 = _mm256_add_epi64( v_s1, _mm256_add_epi64( _mm256_and_si256( w, m ), o ) );
+            v_s2 = _mm256_add_epi64( v_s2, _mm256_add_epi64( _mm256_mul_epu32( w, we ), _mm256_mul_epu32( o, wo ) ) );
+        }
+
+        v_s2 = _mm256_add_epi64( v_s2, _mm256_slli_epi64( v_ps, 3 ) );
+
+        __m128i w1 = _mm_add_epi64( _mm256_castsi256_si128( v_s1 ), _mm256_extracti128_si256( v_s1, 1 ) );
+        __m128i w2 = _mm_add_epi64( _mm256_castsi256_si128( v_s2 ), _mm256_extracti128_si256( v_s2, 1 ) );
+
+        w1 = _mm_add_epi64( w1, _mm_unpackhi_epi64( w1, w1 ) );
+        w2 = _mm_add_epi64( w2, _mm_unpackhi_epi64( w2, w2 ) );
+
+        s2 += k * W * s1 + static_cast<std::uint64_t>( _mm_cvtsi128_si64( w2 ) );
+        s1 += static_cast<std::uint64_t>( _mm_cvtsi128_si64( w1 ) );
+
+        s1 = reduce( s1 );
+        s2 = reduce( s2 );
+    }
+
+#elif defined(BOOST_HASH2_HAS_SSE2) && ( defined(__x86_64__) || defined(_M_X64) )
+
+    static const std::size_t W = 4; // words per block
+
+    static void update_v( std::uint64_t & s1, std::uint64_t & s2, unsigned char const * p, std::size_t k )
+    {
+        BOOST_ASSERT( k * W <= NMAX );
+
+        __m128i const we = _mm_set_epi64x( 2, 4 );
+        __m128i const wo = _mm_set_epi64x( 1, 3 );
+
+        __m128i const m = _mm_set1_epi64x( static_cast<long long>( M ) );
+
+        __m128i v_ps = _mm_setzero_si128();
+        __m128i v_s1 = _mm_setzero_si128();
+        __m128i v_s2 = _mm_setzero_si128();
+
+        for( std::size_t i = 0; i < k; ++i, p += 16 )
+        {
+            __m128i const w = _mm_loadu_si128( reinterpret_cast<__m128i const*>( p ) );
+            __m128i const o = _mm_srli_epi64( w, 32 );
+
+            v_ps = _mm_add_epi64( v_ps, v_s1 );
+
+            v_s1 = _mm_add_epi64( v_s1, _mm_add_epi64( _mm_and_si128( w, m ), o ) );
+            v_s2 = _mm_add_epi64( v_s2, _mm_add_epi64( _mm_mul_epu32( w, we ), _mm_mul_epu32( o, wo ) ) );
+        }
+
+        v_s2 = _mm_add_epi64( v_s2, _mm_slli_epi64( v_ps, 2 ) );
+
+        __m128i w1 = _mm_add_epi64( v_s1, _mm_unpackhi_epi64( v_s1, v_s1 ) );
+        __m128i w2 = _mm_add_epi64( v_s2, _mm_unpackhi_epi64( v_s2, v_s2 ) );
+
+        s2 += k * W * s1 + static_cast<std::uint64_t>( _mm_cvtsi128_si64( w2 ) );
+        s1 += static_cast<std::uint64_t>( _mm_cvtsi128_si64( w1 ) );
+
+        s1 = reduce( s1 );
+        s2 = reduce( s2 );
+    }
+
+#else
+
+    static const std::size_t W = 4;
+
+    static void update_v( std::uint64_t & s1, std::uint64_t & s2, unsigned char const * p, std::size_t k )
+    {
+        update_( s1, s2, p, k * W );
+    }
+
+#endif
+
+    // k whole words
+
+    static void process( std::uint64_t & s1, std::uint64_t & s2, unsigned char const * p, std::size_t k )
+    {
+        while( k >= W )
+        {
+            std::size_t k2 = k;
+            if( k2 > NMAX ) k2 = NMAX;
+
+            k2 /= W;
+
+            update_v( s1, s2, p, k2 );
+
+            p += k2 * W * 4;
+            k -= k2 * W;
+        }
+
+        if( k > 0 )
+        {
+            update_( s1, s2, p, k );
+        }
+    }
+
+public:
+
+    typedef std::uint64_t result_type;
+    typedef std::uint64_t size_type;
+
+    fletcher64(): s1_( 0 ), s2_( 0 ), m_( 0 )
+    {
+        std::memset( buffer_, 0, 4 );
+    }
+
+    // as with the CRCs, a seed is hashed as if by update(); all
+    // eight bytes are used, as word sums are blind to their order
+
+    explicit fletcher64( std::uint64_t seed ): s1_( 0 ), s2_( 0 ), m_( 0 )
+    {
+        std::memset( buffer_, 0, 4 );
+
+        if( seed )
+        {
+            unsigned char tmp[ 8 ];
+            detail::write64le( tmp, seed );
+
+            update( tmp, 8 );
+        }
+    }
+
+    fletcher64( unsigned char const * p, std::size_t n ): s1_( 0 ), s2_( 0 ), m_( 0 )
+    {
+        std::memset( buffer_, 0, 4 );
+
+        if( n != 0 )
+        {
+            update( p, n );
+        }
+    }
+
+    void update( void const * pv, std::size_t n )
+    {
+        unsigned char const* p = static_cast<unsigned char const*>( pv );
+
+        if( n == 0 ) return;
+
+        std::uint64_t s1 = s1_;
+        std::uint64_t s2 = s2_;
+
+        if( m_ > 0 )
+        {
+            std::size_t k = 4 - m_;
+
+            if( n < k )
+            {
+                k = n;
+            }
+
+            std::memcpy( buffer_ + m_, p, k );
+
+            p += k;
+            n -= k;
+            m_ += k;
+
+            if( m_ < 4 ) return;
+
+            BOOST_ASSERT( m_ == 4 );
+
+            update_( s1, s2, buffer_, 1 );
+            m_ = 0;
+
+            // clear buffered plaintext
+            std::memset( buffer_, 0, 4 );
+        }
+
+        BOOST_ASSERT( m_ == 0 );
+
+        if( n >= 4 )
+        {
+            std::size_t k = n / 4;
+
+            process( s1, s2, p, k );
+
+            p += k * 4;
+            n -= k * 4;
+        }
+
+        BOOST_ASSERT( n < 4 );
+
+        if( n > 0 )
+        {
+            std::memcpy( buffer_, p, n );
+            m_ = n;
+        }
+
+        s1_ = s1;
+        s2_ = s2;
+    }
+
+    std::uint64_t result()
+    {
+        if( m_ > 0 )
+        {
+            std::memset( buffer_ + m_, 0, 4 - m_ );
+
+            update_( s1_, s2_, buffer_, 1 );
+
+            m_ = 0;
+
+            // clear buffered plaintext
+            std::memset( buffer_, 0, 4 );
+        }
+
+        std::uint64_t r = ( s2_ << 32 ) | s1_;
+
+        // advance as if by update( "\xFF\0\0\0", 4 ), to allow
+        // multiple result() calls to generate a sequence
+        // of distinct values; a whole word keeps the input
+        // that follows aligned
+
+        unsigned char const tmp[ 4 ] = { 0xFF, 0, 0, 0 };
+        update_( s1_, s2_, tmp, 1 );
+
+        return r;
+    }
+};
+
+// Given f_a, the Fletcher-64 of A, and f_b, the Fletcher-64 of B,
+// returns the Fletcher-64 of A followed by B; len_b is the size of
+// B in bytes, and the size of A must be a multiple of four. Each of
+// the ceil( len_b / 4 ) words of B adds s1 of A to s2
+
+inline std::uint64_t fletcher64_combine( std::uint64_t f_a, std::uint64_t f_b, std::uint64_t len_b )
+{
+    std::uint64_t const M = 0xFFFFFFFFu;
+
+    std::uint64_t const k = ( len_b / 4 + ( len_b % 4 != 0 ) ) % M;
+
+    std::uint64_t const s1a = f_a & M, s2a = f_a >> 32;
+    std::uint64_t const s1b = f_b & M, s2b = f_b >> 32;
+
+    std::uint64_t s1 = ( s1a + s1b ) % M;
+    std::uint64_t s2 = ( s2a + s2b + k * s1a % M ) % M;
+
+    return ( s2 << 32 ) | s1;
+}
+
+} // namespace hash2
+} // namespace boost
+
+#endif // #ifndef BOOST_HASH2_FLETCHER_HPP_INCLUDED
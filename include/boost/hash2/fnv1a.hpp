@@ -93,6 +93,21 @@ public:
         st_ = h;
     }
 
+    // update( p, N ), with the length known at compile time
+
+    template<std::size_t N> void update_fixed( unsigned char const * p )
+    {
+        T h = st_;
+
+        for( std::size_t i = 0; i < N; ++i )
+        {
+            h ^= static_cast<T>( p[i] );
+            h *= fnv1a_const<T>::prime;
+        }
+
+        st_ = h;
+    }
+
     T result()
     {
         T r = st_;
@@ -105,6 +120,17 @@ public:
 
         return r;
     }
+
+    // the result of update( p, n ) and result() on fnv1a( seed ),
+    // for uniformity with the other algorithms
+
+    static T hash( void const * pv, std::size_t n, std::uint64_t seed = 0 )
+    {
+        fnv1a h( seed );
+        h.update( pv, n );
+
+        return h.st_;
+    }
 };
 
 } // namespace detail
@@ -19,7 +19,9 @@
 #include <boost/container_hash/is_tuple_like.hpp>
 #include <boost/mp11/integer_sequence.hpp>
 #include <cstdint>
+#include <cstddef>
 #include <type_traits>
+#include <utility>
 #include <iterator>
 
 namespace boost
@@ -112,6 +114,42 @@ template<class H, class It> void hash_append_sized_range( H & h, It first, It la
     detail::hash_append_sized_range_( h, first, last, typename std::iterator_traits<It>::iterator_category() );
 }
 
+// update_fixed
+//
+// An algorithm may provide
+//
+//   template<std::size_t N> void update_fixed( unsigned char const * p );
+//
+// with the same effect as update( p, N ). It's used for the scalars
+// and the sizes, whose length is known at compile time.
+
+namespace detail
+{
+
+template<class H, std::size_t N, class = void> struct has_update_fixed: std::false_type
+{
+};
+
+template<class H, std::size_t N> struct has_update_fixed<H, N, decltype( std::declval<H&>().template update_fixed<N>( static_cast<unsigned char const*>( 0 ) ) )>: std::true_type
+{
+};
+
+template<std::size_t N, class H>
+    typename std::enable_if< has_update_fixed<H, N>::value, void >::type
+    update_fixed( H & h, unsigned char const * p )
+{
+    h.template update_fixed<N>( p );
+}
+
+template<std::size_t N, class H>
+    typename std::enable_if< !has_update_fixed<H, N>::value, void >::type
+    update_fixed( H & h, unsigned char const * p )
+{
+    h.update( p, N );
+}
+
+} // namespace detail
+
 // do_hash_append
 
 // contiguously hashable (this includes unsigned char const&)
@@ -122,7 +160,7 @@ template<class H, class T>
     do_hash_append( H & h, T const & v )
 {
     unsigned char const * p = reinterpret_cast<unsigned char const*>( &v );
-    hash_append_range( h, p, p + sizeof(T) );
+    detail::update_fixed<sizeof(T)>( h, p );
 }
 
 // floating point
@@ -134,7 +172,7 @@ template<class H, class T>
     T w = v == 0? 0: v;
 
     unsigned char const * p = reinterpret_cast<unsigned char const*>( &w );
-    hash_append_range( h, p, p + sizeof(T) );
+    detail::update_fixed<sizeof(T)>( h, p );
 }
 
 // C arrays
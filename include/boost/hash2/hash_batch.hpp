@@ -0,0 +1,804 @@
+#ifndef BOOST_HASH2_HASH_BATCH_HPP_INCLUDED
+#define BOOST_HASH2_HASH_BATCH_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// Hashing of many independent keys: murmur3_32, xxhash_32, xxhash_64 and
+// SipHash run the full blocks of several keys at once, each in a lane of
+// a SIMD register. Only keys of two blocks (128 bytes) or more use the
+// lanes; for the shorter ones, gathering the key into a lane and masking
+// the lanes of different lengths was measured to take about twice as long
+// as the scalar code
+
+#include <boost/hash2/murmur3.hpp>
+#include <boost/hash2/xxhash.hpp>
+#include <boost/hash2/siphash.hpp>
+#include <boost/hash2/detail/u32x8.hpp>
+#include <boost/hash2/detail/u64x4.hpp>
+#include <boost/hash2/detail/read.hpp>
+#include <boost/hash2/detail/rot.hpp>
+#include <boost/hash2/detail/config.hpp>
+#include <boost/config.hpp>
+#include <cstdint>
+#include <cstring>
+#include <cstddef>
+
+// The lanes are faster than hashing the keys one after the other only
+// when u32x8 and u64x4 are single AVX2 registers; with SSE2, the scalar
+// code, which the processor overlaps across keys, wins. Define
+// BOOST_HASH2_BATCH_LANES to use them regardless.
+
+#if defined(BOOST_HASH2_HAS_AVX2) && !defined(BOOST_HASH2_BATCH_LANES)
+# define BOOST_HASH2_BATCH_LANES
+#endif
+
+namespace boost
+{
+namespace hash2
+{
+namespace detail
+{
+
+// uses H::hash( p, n, seed ) when available
+
+template<class H> auto hash_one( unsigned char const * p, std::size_t n, std::uint64_t seed, int ) -> decltype( H::hash( p, n, seed ) )
+{
+    return H::hash( p, n, seed );
+}
+
+template<class H> typename H::result_type hash_one( unsigned char const * p, std::size_t n, std::uint64_t seed, long )
+{
+    H h( seed );
+    h.update( p, n );
+
+    return h.result();
+}
+
+// K describes the algorithm, with the state of lane j in state[][ j ]:
+//
+//   typedef ... word_type;
+//   typedef ... result_type;
+//   static const int lanes;
+//   static const int state_words;
+//   static void init( word_type state[][ lanes ], int j, std::uint64_t seed );
+//   static void transform( word_type state[][ lanes ], unsigned char const * const q[], std::size_t blocks );
+//   static result_type finish( word_type const state[][ lanes ], int j, unsigned char const * p, std::size_t m, std::size_t n );
+//
+// transform runs the 64 byte blocks at q[ j ] + 64 * i, i < blocks, through
+// all lanes; finish hashes the remaining m bytes at p of a key of n bytes
+
+template<class K> class batch_lanes
+{
+private:
+
+    typedef typename K::word_type word_type;
+
+    static const int L = K::lanes;
+    static const std::size_t N = 64;
+
+    struct lane
+    {
+        unsigned char const * p; // next full block of the key
+        std::size_t blocks;      // number of full blocks left
+        std::size_t index;       // index of the key, or -1 when idle
+    };
+
+public:
+
+    typedef typename K::result_type result_type;
+
+private:
+
+    // starts the next key of two blocks or more in lane j, hashing the
+    // shorter keys on the way, for which moving the state in and out of
+    // the lanes takes longer than it saves; returns false when none are left
+
+    static bool start( word_type state[][ L ], int j, lane & ln, std::size_t & next, std::size_t k, unsigned char const * const p[], std::size_t const n[], std::uint64_t seed, result_type r[] )
+    {
+        for( ; next < k; ++next )
+        {
+            K::init( state, j, seed );
+
+            if( n[ next ] >= 2 * N )
+            {
+                ln.p = p[ next ];
+                ln.blocks = n[ next ] / N;
+                ln.index = next++;
+
+                return true;
+            }
+
+            r[ next ] = K::finish( state, j, p[ next ], n[ next ], n[ next ] );
+        }
+
+        // idle lanes keep a valid state, which is ignored
+        K::init( state, j, seed );
+
+        ln.p = 0;
+        ln.blocks = 0;
+        ln.index = static_cast<std::size_t>( -1 );
+
+        return false;
+    }
+
+public:
+
+    // computes r[ i ] as the hash of the n[ i ] bytes at p[ i ], i < k
+    static void hash( std::size_t k, unsigned char const * const p[], std::size_t const n[], std::uint64_t seed, result_type r[] )
+    {
+        word_type state[ K::state_words ][ L ];
+
+        lane slots[ L ];
+
+        std::size_t next = 0;
+        int active = 0;
+
+        for( int j = 0; j < L; ++j )
+        {
+            active += start( state, j, slots[ j ], next, k, p, n, seed, r );
+        }
+
+        // once half of the lanes are idle, the scalar code is faster
+
+        while( next < k || active * 2 > L )
+        {
+            // the number of blocks that all keys have
+
+            std::size_t m = static_cast<std::size_t>( -1 );
+            int j0 = 0;
+
+            for( int j = 0; j < L; ++j )
+            {
+                if( slots[ j ].index == static_cast<std::size_t>( -1 ) ) continue;
+
+                if( slots[ j ].blocks < m )
+                {
+                    m = slots[ j ].blocks;
+                }
+
+                j0 = j;
+            }
+
+            // idle lanes process the blocks of another
+
+            unsigned char const * q[ L ];
+
+            for( int j = 0; j < L; ++j )
+            {
+                q[ j ] = slots[ j ].index == static_cast<std::size_t>( -1 )? slots[ j0 ].p: slots[ j ].p;
+            }
+
+            K::transform( state, q, m );
+
+            for( int j = 0; j < L; ++j )
+            {
+                lane & ln = slots[ j ];
+
+                if( ln.index == static_cast<std::size_t>( -1 ) ) continue;
+
+                ln.p += m * N;
+                ln.blocks -= m;
+
+                if( ln.blocks > 0 ) continue;
+
+                std::size_t i = ln.index;
+
+                r[ i ] = K::finish( state, j, ln.p, n[ i ] % N, n[ i ] );
+
+                if( !start( state, j, ln, next, k, p, n, seed, r ) )
+                {
+                    --active;
+                }
+            }
+        }
+
+        for( int j = 0; j < L; ++j )
+        {
+            lane & ln = slots[ j ];
+
+            if( ln.index == static_cast<std::size_t>( -1 ) ) continue;
+
+            std::size_t i = ln.index;
+
+            r[ i ] = K::finish( state, j, ln.p, ln.blocks * N + n[ i ] % N, n[ i ] );
+        }
+    }
+};
+
+struct murmur3_32_x8_kernel
+{
+    typedef std::uint32_t word_type;
+    typedef std::uint32_t result_type;
+
+    static const int lanes = 8;
+    static const int state_words = 1;
+
+    static const std::uint32_t c1 = 0xcc9e2d51u;
+    static const std::uint32_t c2 = 0x1b873593u;
+
+    static BOOST_FORCEINLINE void mix( std::uint32_t & h, std::uint32_t k )
+    {
+        k *= c1;
+        k = detail::rotl( k, 15 );
+        k *= c2;
+
+        h ^= k;
+        h = detail::rotl( h, 13 );
+        h = h * 5 + 0xe6546b64;
+    }
+
+    static BOOST_FORCEINLINE void mix( u32x8 & h, u32x8 k )
+    {
+        k = k * set1_u32x8( c1 );
+        k = rotl<15>( k );
+        k = k * set1_u32x8( c2 );
+
+        h = h ^ k;
+        h = rotl<13>( h );
+        h = h * set1_u32x8( 5 ) + set1_u32x8( 0xe6546b64 );
+    }
+
+    static void init( std::uint32_t state[][ 8 ], int j, std::uint64_t seed )
+    {
+        std::uint32_t h = static_cast<std::uint32_t>( seed );
+        std::uint32_t k = static_cast<std::uint32_t>( seed >> 32 );
+
+        if( k != 0 )
+        {
+            mix( h, k );
+        }
+
+        state[ 0 ][ j ] = h;
+    }
+
+    static void transform( std::uint32_t state[][ 8 ], unsigned char const * const q[ 8 ], std::size_t blocks )
+    {
+        u32x8 h = load_u32x8( state[ 0 ] );
+
+        for( std::size_t i = 0; i < blocks; ++i )
+        {
+            u32x8 w[ 16 ];
+            load_u32x8_transposed( q, i * 64, w );
+
+            for( int k = 0; k < 16; ++k )
+            {
+                mix( h, w[ k ] );
+            }
+        }
+
+        store_u32x8( state[ 0 ], h );
+    }
+
+    static std::uint32_t finish( std::uint32_t const state[][ 8 ], int j, unsigned char const * p, std::size_t m, std::size_t n )
+    {
+        std::uint32_t h = state[ 0 ][ j ];
+
+        for( ; m >= 4; p += 4, m -= 4 )
+        {
+            mix( h, detail::read32le( p ) );
+        }
+
+        std::uint32_t k = 0;
+
+        switch( m )
+        {
+        case 1:
+
+            k = p[0];
+            break;
+
+        case 2:
+
+            k = p[0] + (p[1] << 8);
+            break;
+
+        case 3:
+
+            k = p[0] + (p[1] << 8) + (p[2] << 16);
+            break;
+        }
+
+        k *= c1;
+        k = detail::rotl( k, 15 );
+        k *= c2;
+
+        h ^= k;
+        h ^= static_cast<std::uint32_t>( n );
+
+        h ^= h >> 16;
+        h *= 0x85ebca6b;
+        h ^= h >> 13;
+        h *= 0xc2b2ae35;
+        h ^= h >> 16;
+
+        return h;
+    }
+};
+
+struct xxhash_32_x8_kernel
+{
+    typedef std::uint32_t word_type;
+    typedef std::uint32_t result_type;
+
+    static const int lanes = 8;
+    static const int state_words = 4;
+
+    static const std::uint32_t P1 = 2654435761U;
+    static const std::uint32_t P2 = 2246822519U;
+    static const std::uint32_t P3 = 3266489917U;
+    static const std::uint32_t P4 =  668265263U;
+    static const std::uint32_t P5 =  374761393U;
+
+    static std::uint32_t round( std::uint32_t seed, std::uint32_t input )
+    {
+        seed += input * P2;
+        seed = detail::rotl( seed, 13 );
+        seed *= P1;
+
+#if defined(__GNUC__) && ( defined(__x86_64__) || defined(__i386__) )
+
+        // see xxhash_32::round
+        __asm__( "" : "+r"( seed ) );
+
+#endif
+
+        return seed;
+    }
+
+    static BOOST_FORCEINLINE u32x8 round( u32x8 seed, u32x8 input )
+    {
+        seed = seed + input * set1_u32x8( P2 );
+        seed = rotl<13>( seed );
+        seed = seed * set1_u32x8( P1 );
+        return seed;
+    }
+
+    static void init( std::uint32_t state[][ 8 ], int j, std::uint64_t seed )
+    {
+        std::uint32_t s0 = static_cast<std::uint32_t>( seed );
+        std::uint32_t s1 = static_cast<std::uint32_t>( seed >> 32 );
+
+        std::uint32_t v1 = s0 + P1 + P2;
+        std::uint32_t v2 = s0 + P2;
+        std::uint32_t v3 = s0;
+        std::uint32_t v4 = s0 - P1;
+
+        if( s1 != 0 )
+        {
+            v1 = round( v1, s1 );
+            v2 = round( v2, s1 );
+            v3 = round( v3, s1 );
+            v4 = round( v4, s1 );
+        }
+
+        state[ 0 ][ j ] = v1;
+        state[ 1 ][ j ] = v2;
+        state[ 2 ][ j ] = v3;
+        state[ 3 ][ j ] = v4;
+    }
+
+    static void transform( std::uint32_t state[][ 8 ], unsigned char const * const q[ 8 ], std::size_t blocks )
+    {
+        u32x8 v1 = load_u32x8( state[ 0 ] );
+        u32x8 v2 = load_u32x8( state[ 1 ] );
+        u32x8 v3 = load_u32x8( state[ 2 ] );
+        u32x8 v4 = load_u32x8( state[ 3 ] );
+
+        for( std::size_t i = 0; i < blocks; ++i )
+        {
+            u32x8 w[ 16 ];
+            load_u32x8_transposed( q, i * 64, w );
+
+            for( int k = 0; k < 16; k += 4 )
+            {
+                v1 = round( v1, w[ k + 0 ] );
+                v2 = round( v2, w[ k + 1 ] );
+                v3 = round( v3, w[ k + 2 ] );
+                v4 = round( v4, w[ k + 3 ] );
+            }
+        }
+
+        store_u32x8( state[ 0 ], v1 );
+        store_u32x8( state[ 1 ], v2 );
+        store_u32x8( state[ 2 ], v3 );
+        store_u32x8( state[ 3 ], v4 );
+    }
+
+    static std::uint32_t finish( std::uint32_t const state[][ 8 ], int j, unsigned char const * p, std::size_t m, std::size_t n )
+    {
+        std::uint32_t v1 = state[ 0 ][ j ];
+        std::uint32_t v2 = state[ 1 ][ j ];
+        std::uint32_t v3 = state[ 2 ][ j ];
+        std::uint32_t v4 = state[ 3 ][ j ];
+
+        for( ; m >= 16; p += 16, m -= 16 )
+        {
+            v1 = round( v1, detail::read32le( p +  0 ) );
+            v2 = round( v2, detail::read32le( p +  4 ) );
+            v3 = round( v3, detail::read32le( p +  8 ) );
+            v4 = round( v4, detail::read32le( p + 12 ) );
+        }
+
+        std::uint32_t h;
+
+        if( n >= 16 )
+        {
+            h = detail::rotl( v1, 1 ) + detail::rotl( v2, 7 ) + detail::rotl( v3, 12 ) + detail::rotl( v4, 18 );
+        }
+        else
+        {
+            h = v3 + P5;
+        }
+
+        h += static_cast<std::uint32_t>( n );
+
+        for( ; m >= 4; p += 4, m -= 4 )
+        {
+            h += detail::read32le( p ) * P3;
+            h = detail::rotl( h, 17 ) * P4;
+        }
+
+        for( ; m > 0; ++p, --m )
+        {
+            h += p[0] * P5;
+            h = detail::rotl( h, 11 ) * P1;
+        }
+
+        h ^= h >> 15;
+        h *= P2;
+        h ^= h >> 13;
+        h *= P3;
+        h ^= h >> 16;
+
+        return h;
+    }
+};
+
+struct xxhash_64_x4_kernel
+{
+    typedef std::uint64_t word_type;
+    typedef std::uint64_t result_type;
+
+    static const int lanes = 4;
+    static const int state_words = 4;
+
+    static const std::uint64_t P1 = 11400714785074694791ULL;
+    static const std::uint64_t P2 = 14029467366897019727ULL;
+    static const std::uint64_t P3 =  1609587929392839161ULL;
+    static const std::uint64_t P4 =  9650029242287828579ULL;
+    static const std::uint64_t P5 =  2870177450012600261ULL;
+
+    static std::uint64_t round( std::uint64_t seed, std::uint64_t input )
+    {
+        seed += input * P2;
+        seed = detail::rotl( seed, 31 );
+        seed *= P1;
+
+#if defined(__GNUC__) && defined(__x86_64__)
+
+        // see xxhash_64::round
+        __asm__( "" : "+r"( seed ) );
+
+#endif
+
+        return seed;
+    }
+
+    static std::uint64_t merge_round( std::uint64_t acc, std::uint64_t val )
+    {
+        val = round( 0, val );
+        acc ^= val;
+        acc = acc * P1 + P4;
+        return acc;
+    }
+
+    static BOOST_FORCEINLINE u64x4 round( u64x4 seed, u64x4 input )
+    {
+        seed = seed + input * set1_u64x4( P2 );
+        seed = rotl<31>( seed );
+        seed = seed * set1_u64x4( P1 );
+        return seed;
+    }
+
+    static void init( std::uint64_t state[][ 4 ], int j, std::uint64_t seed )
+    {
+        state[ 0 ][ j ] = seed + P1 + P2;
+        state[ 1 ][ j ] = seed + P2;
+        state[ 2 ][ j ] = seed;
+        state[ 3 ][ j ] = seed - P1;
+    }
+
+    static void transform( std::uint64_t state[][ 4 ], unsigned char const * const q[ 4 ], std::size_t blocks )
+    {
+        u64x4 v1 = load_u64x4( state[ 0 ] );
+        u64x4 v2 = load_u64x4( state[ 1 ] );
+        u64x4 v3 = load_u64x4( state[ 2 ] );
+        u64x4 v4 = load_u64x4( state[ 3 ] );
+
+        for( std::size_t i = 0; i < blocks; ++i )
+        {
+            u64x4 w[ 8 ];
+            load_u64x4_transposed( q, i * 64, w );
+
+            for( int k = 0; k < 8; k += 4 )
+            {
+                v1 = round( v1, w[ k + 0 ] );
+                v2 = round( v2, w[ k + 1 ] );
+                v3 = round( v3, w[ k + 2 ] );
+                v4 = round( v4, w[ k + 3 ] );
+            }
+        }
+
+        store_u64x4( state[ 0 ], v1 );
+        store_u64x4( state[ 1 ], v2 );
+        store_u64x4( state[ 2 ], v3 );
+        store_u64x4( state[ 3 ], v4 );
+    }
+
+    static std::uint64_t finish( std::uint64_t const state[][ 4 ], int j, unsigned char const * p, std::size_t m, std::uint64_t n )
+    {
+        std::uint64_t v1 = state[ 0 ][ j ];
+        std::uint64_t v2 = state[ 1 ][ j ];
+        std::uint64_t v3 = state[ 2 ][ j ];
+        std::uint64_t v4 = state[ 3 ][ j ];
+
+        for( ; m >= 32; p += 32, m -= 32 )
+        {
+            v1 = round( v1, detail::read64le( p +  0 ) );
+            v2 = round( v2, detail::read64le( p +  8 ) );
+            v3 = round( v3, detail::read64le( p + 16 ) );
+            v4 = round( v4, detail::read64le( p + 24 ) );
+        }
+
+        std::uint64_t h;
+
+        if( n >= 32 )
+        {
+            h = detail::rotl( v1, 1 ) + detail::rotl( v2, 7 ) + detail::rotl( v3, 12 ) + detail::rotl( v4, 18 );
+
+            h = merge_round( h, v1 );
+            h = merge_round( h, v2 );
+            h = merge_round( h, v3 );
+            h = merge_round( h, v4 );
+        }
+        else
+        {
+            h = v3 + P5;
+        }
+
+        h += n;
+
+        for( ; m >= 8; p += 8, m -= 8 )
+        {
+            h ^= round( 0, detail::read64le( p ) );
+            h = detail::rotl( h, 27 ) * P1 + P4;
+        }
+
+        for( ; m >= 4; p += 4, m -= 4 )
+        {
+            h ^= static_cast<std::uint64_t>( detail::read32le( p ) ) * P1;
+            h = detail::rotl( h, 23 ) * P2 + P3;
+        }
+
+        for( ; m > 0; ++p, --m )
+        {
+            h ^= p[0] * P5;
+            h = detail::rotl( h, 11 ) * P1;
+        }
+
+        h ^= h >> 33;
+        h *= P2;
+        h ^= h >> 29;
+        h *= P3;
+        h ^= h >> 32;
+
+        return h;
+    }
+};
+
+// the seed is k0, and k1 is zero, as in basic_siphash_64( seed )
+
+template<int C, int D> struct siphash_64_x4_kernel
+{
+    typedef std::uint64_t word_type;
+    typedef std::uint64_t result_type;
+
+    static const int lanes = 4;
+    static const int state_words = 4;
+
+    static BOOST_FORCEINLINE void sipround( std::uint64_t & v0, std::uint64_t & v1, std::uint64_t & v2, std::uint64_t & v3 )
+    {
+        v0 += v1;
+        v1 = detail::rotl(v1, 13);
+        v1 ^= v0;
+        v0 = detail::rotl(v0, 32);
+        v2 += v3;
+        v3 = detail::rotl(v3, 16);
+        v3 ^= v2;
+        v0 += v3;
+        v3 = detail::rotl(v3, 21);
+        v3 ^= v0;
+        v2 += v1;
+        v1 = detail::rotl(v1, 17);
+        v1 ^= v2;
+        v2 = detail::rotl(v2, 32);
+    }
+
+    static BOOST_FORCEINLINE void sipround( u64x4 & v0, u64x4 & v1, u64x4 & v2, u64x4 & v3 )
+    {
+        v0 = v0 + v1;
+        v1 = rotl<13>( v1 );
+        v1 = v1 ^ v0;
+        v0 = rotl<32>( v0 );
+        v2 = v2 + v3;
+        v3 = rotl<16>( v3 );
+        v3 = v3 ^ v2;
+        v0 = v0 + v3;
+        v3 = rotl<21>( v3 );
+        v3 = v3 ^ v0;
+        v2 = v2 + v1;
+        v1 = rotl<17>( v1 );
+        v1 = v1 ^ v2;
+        v2 = rotl<32>( v2 );
+    }
+
+    template<class T> static BOOST_FORCEINLINE void compress( T & v0, T & v1, T & v2, T & v3, T m )
+    {
+        v3 = v3 ^ m;
+
+        for( int i = 0; i < C; ++i )
+        {
+            sipround( v0, v1, v2, v3 );
+        }
+
+        v0 = v0 ^ m;
+    }
+
+    static void init( std::uint64_t state[][ 4 ], int j, std::uint64_t seed )
+    {
+        state[ 0 ][ j ] = 0x736f6d6570736575ULL ^ seed;
+        state[ 1 ][ j ] = 0x646f72616e646f6dULL;
+        state[ 2 ][ j ] = 0x6c7967656e657261ULL ^ seed;
+        state[ 3 ][ j ] = 0x7465646279746573ULL;
+    }
+
+    static void transform( std::uint64_t state[][ 4 ], unsigned char const * const q[ 4 ], std::size_t blocks )
+    {
+        u64x4 v0 = load_u64x4( state[ 0 ] );
+        u64x4 v1 = load_u64x4( state[ 1 ] );
+        u64x4 v2 = load_u64x4( state[ 2 ] );
+        u64x4 v3 = load_u64x4( state[ 3 ] );
+
+        for( std::size_t i = 0; i < blocks; ++i )
+        {
+            u64x4 w[ 8 ];
+            load_u64x4_transposed( q, i * 64, w );
+
+            for( int k = 0; k < 8; ++k )
+            {
+                compress( v0, v1, v2, v3, w[ k ] );
+            }
+        }
+
+        store_u64x4( state[ 0 ], v0 );
+        store_u64x4( state[ 1 ], v1 );
+        store_u64x4( state[ 2 ], v2 );
+        store_u64x4( state[ 3 ], v3 );
+    }
+
+    static std::uint64_t finish( std::uint64_t const state[][ 4 ], int j, unsigned char const * p, std::size_t m, std::uint64_t n )
+    {
+        std::uint64_t v0 = state[ 0 ][ j ];
+        std::uint64_t v1 = state[ 1 ][ j ];
+        std::uint64_t v2 = state[ 2 ][ j ];
+        std::uint64_t v3 = state[ 3 ][ j ];
+
+        for( ; m >= 8; p += 8, m -= 8 )
+        {
+            compress( v0, v1, v2, v3, detail::read64le( p ) );
+        }
+
+        unsigned char q[ 8 ] = { 0 };
+        std::memcpy( q, p, m );
+
+        q[ 7 ] = static_cast<unsigned char>( n & 0xFF );
+
+        compress( v0, v1, v2, v3, detail::read64le( q ) );
+
+        v2 ^= 0xFF;
+
+        for( int i = 0; i < D; ++i )
+        {
+            sipround( v0, v1, v2, v3 );
+        }
+
+        return v0 ^ v1 ^ v2 ^ v3;
+    }
+};
+
+// batch_kernel<H>::hash( k, p, n, seed, r ) computes r[ i ] as the hash of
+// the n[ i ] bytes at p[ i ], i < k, by H::hash( p[ i ], n[ i ], seed )
+
+template<class H> struct batch_kernel
+{
+    typedef typename H::result_type result_type;
+
+    static void hash( std::size_t k, unsigned char const * const p[], std::size_t const n[], std::uint64_t seed, result_type r[] )
+    {
+        for( std::size_t i = 0; i < k; ++i )
+        {
+            r[ i ] = detail::hash_one<H>( p[ i ], n[ i ], seed, 0 );
+        }
+    }
+};
+
+#if defined(BOOST_HASH2_BATCH_LANES)
+
+template<> struct batch_kernel<murmur3_32>: batch_lanes<murmur3_32_x8_kernel>
+{
+};
+
+template<> struct batch_kernel<xxhash_32>: batch_lanes<xxhash_32_x8_kernel>
+{
+};
+
+#if defined(BOOST_HASH2_XXHASH64_SIMD)
+
+// as with xxhash_64::update_, only where vpmullq is fast
+
+template<> struct batch_kernel<xxhash_64>: batch_lanes<xxhash_64_x4_kernel>
+{
+};
+
+#endif
+
+template<int C, int D> struct batch_kernel< basic_siphash_64<C, D> >: batch_lanes< siphash_64_x4_kernel<C, D> >
+{
+};
+
+#endif
+
+} // namespace detail
+
+// Stores the hash of each key k in [first, last), as computed by
+// H::hash( k.data(), k.size(), seed ), to *out++. The keys are
+// contiguous ranges, such as std::string
+
+template<class H, class It, class Out> Out hash_batch( It first, It last, std::uint64_t seed, Out out )
+{
+    typedef detail::batch_kernel<H> K;
+
+    std::size_t const M = 64;
+
+    unsigned char const * p[ M ];
+    std::size_t n[ M ];
+
+    typename K::result_type r[ M ];
+
+    while( first != last )
+    {
+        std::size_t k = 0;
+
+        for( ; k < M && first != last; ++k, ++first )
+        {
+            p[ k ] = static_cast<unsigned char const*>( static_cast<void const*>( (*first).data() ) );
+            n[ k ] = (*first).size() * sizeof( *(*first).data() );
+        }
+
+        K::hash( k, p, n, seed, r );
+
+        for( std::size_t i = 0; i < k; ++i )
+        {
+            *out++ = r[ i ];
+        }
+    }
+
+    return out;
+}
+
+} // namespace hash2
+} // namespace boost
+
+#endif // #ifndef BOOST_HASH2_HASH_BATCH_HPP_INCLUDED
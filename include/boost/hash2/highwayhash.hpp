@@ -0,0 +1,525 @@
+#ifndef BOOST_HASH2_HIGHWAYHASH_HPP_INCLUDED
+#define BOOST_HASH2_HIGHWAYHASH_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// HighwayHash, https://github.com/google/highwayhash
+
+#include <boost/hash2/detail/config.hpp>
+#include <boost/hash2/detail/intrin.hpp>
+#include <boost/hash2/detail/read.hpp>
+#include <boost/hash2/detail/write.hpp>
+#include <boost/hash2/detail/rot.hpp>
+#include <boost/assert.hpp>
+#include <cstdint>
+#include <array>
+#include <cstring>
+#include <cstddef>
+
+namespace boost
+{
+namespace hash2
+{
+
+namespace detail
+{
+
+class highwayhash_base
+{
+private:
+
+    static const std::size_t N = 32;
+
+    std::uint64_t v0_[ 4 ];
+    std::uint64_t v1_[ 4 ];
+    std::uint64_t mul0_[ 4 ];
+    std::uint64_t mul1_[ 4 ];
+
+    unsigned char buffer_[ N ];
+    std::size_t m_; // == n % 32
+
+private:
+
+    // the final partial packet, 0 < m_ < 32; the input is
+    // placed as in the reference implementation
+    void make_packet( unsigned char * packet ) const
+    {
+        std::size_t const m = m_;
+        std::size_t const m4 = m & ~static_cast<std::size_t>( 3 );
+
+        std::memset( packet, 0, N );
+        std::memcpy( packet, buffer_, m4 );
+
+        if( m & 16 )
+        {
+            // the last four bytes
+            std::memcpy( packet + 28, buffer_ + m - 4, 4 );
+        }
+        else if( m != m4 )
+        {
+            packet[ 16 ] = buffer_[ m4 ];
+            packet[ 17 ] = buffer_[ m4 + ( ( m - m4 ) >> 1 ) ];
+            packet[ 18 ] = buffer_[ m - 1 ];
+        }
+    }
+
+#if defined(BOOST_HASH2_HAS_AVX2)
+
+    // a fixed byte permutation within each 128 bit half
+
+    static __m256i zipper_merge( __m256i v )
+    {
+        __m256i const mask = _mm256_set_epi64x( 0x070806090D0A040Bll, 0x000F010E05020C03ll, 0x070806090D0A040Bll, 0x000F010E05020C03ll );
+        return _mm256_shuffle_epi8( v, mask );
+    }
+
+    static void update_( __m256i & v0, __m256i & v1, __m256i & mul0, __m256i & mul1, __m256i lanes )
+    {
+        v1 = _mm256_add_epi64( v1, _mm256_add_epi64( mul0, lanes ) );
+        mul0 = _mm256_xor_si256( mul0, _mm256_mul_epu32( v1, _mm256_srli_epi64( v0, 32 ) ) );
+
+        v0 = _mm256_add_epi64( v0, mul1 );
+        mul1 = _mm256_xor_si256( mul1, _mm256_mul_epu32( v0, _mm256_srli_epi64( v1, 32 ) ) );
+
+        v0 = _mm256_add_epi64( v0, zipper_merge( v1 ) );
+        v1 = _mm256_add_epi64( v1, zipper_merge( v0 ) );
+    }
+
+    void process( unsigned char const * p, std::size_t k )
+    {
+        __m256i v0 = _mm256_loadu_si256( reinterpret_cast<__m256i const*>( v0_ ) );
+        __m256i v1 = _mm256_loadu_si256( reinterpret_cast<__m256i const*>( v1_ ) );
+        __m256i mul0 = _mm256_loadu_si256( reinterpret_cast<__m256i const*>( mul0_ ) );
+        __m256i mul1 = _mm256_loadu_si256( reinterpret_cast<__m256i const*>( mul1_ ) );
+
+        for( std::size_t i = 0; i < k; ++i, p += N )
+        {
+            update_( v0, v1, mul0, mul1, _mm256_loadu_si256( reinterpret_cast<__m256i const*>( p ) ) );
+        }
+
+        _mm256_storeu_si256( reinterpret_cast<__m256i*>( v0_ ), v0 );
+        _mm256_storeu_si256( reinterpret_cast<__m256i*>( v1_ ), v1 );
+        _mm256_storeu_si256( reinterpret_cast<__m256i*>( mul0_ ), mul0 );
+        _mm256_storeu_si256( reinterpret_cast<__m256i*>( mul1_ ), mul1 );
+    }
+
+    // processes the final partial packet, if any, then runs k
+    // permutation rounds
+    void finalize_( int k )
+    {
+        __m256i v0 = _mm256_loadu_si256( reinterpret_cast<__m256i const*>( v0_ ) );
+        __m256i v1 = _mm256_loadu_si256( reinterpret_cast<__m256i const*>( v1_ ) );
+        __m256i mul0 = _mm256_loadu_si256( reinterpret_cast<__m256i const*>( mul0_ ) );
+        __m256i mul1 = _mm256_loadu_si256( reinterpret_cast<__m256i const*>( mul1_ ) );
+
+        if( m_ > 0 )
+        {
+            int m = static_cast<int>( m_ );
+
+            v0 = _mm256_add_epi64( v0, _mm256_set1_epi64x( ( static_cast<long long>( m ) << 32 ) + m ) );
+
+            // rotate the 32 bit halves of v1 left by m
+            v1 = _mm256_or_si256( _mm256_sll_epi32( v1, _mm_cvtsi32_si128( m ) ), _mm256_srl_epi32( v1, _mm_cvtsi32_si128( 32 - m ) ) );
+
+            unsigned char packet[ N ];
+            make_packet( packet );
+
+            update_( v0, v1, mul0, mul1, _mm256_loadu_si256( reinterpret_cast<__m256i const*>( packet ) ) );
+        }
+
+        for( int i = 0; i < k; ++i )
+        {
+            // swap the 128 bit halves, and the 32 bit halves of each lane
+            __m256i lanes = _mm256_shuffle_epi32( _mm256_permute4x64_epi64( v0, _MM_SHUFFLE( 1, 0, 3, 2 ) ), _MM_SHUFFLE( 2, 3, 0, 1 ) );
+
+            update_( v0, v1, mul0, mul1, lanes );
+        }
+
+        _mm256_storeu_si256( reinterpret_cast<__m256i*>( v0_ ), v0 );
+        _mm256_storeu_si256( reinterpret_cast<__m256i*>( v1_ ), v1 );
+        _mm256_storeu_si256( reinterpret_cast<__m256i*>( mul0_ ), mul0 );
+        _mm256_storeu_si256( reinterpret_cast<__m256i*>( mul1_ ), mul1 );
+    }
+
+#else
+
+    // the state is copied into a local, so that the compiler can keep it in registers
+
+    struct state
+    {
+        std::uint64_t v0[ 4 ];
+        std::uint64_t v1[ 4 ];
+        std::uint64_t mul0[ 4 ];
+        std::uint64_t mul1[ 4 ];
+    };
+
+    void load( state & s ) const
+    {
+        std::memcpy( s.v0, v0_, sizeof( v0_ ) );
+        std::memcpy( s.v1, v1_, sizeof( v1_ ) );
+        std::memcpy( s.mul0, mul0_, sizeof( mul0_ ) );
+        std::memcpy( s.mul1, mul1_, sizeof( mul1_ ) );
+    }
+
+    void store( state const & s )
+    {
+        std::memcpy( v0_, s.v0, sizeof( v0_ ) );
+        std::memcpy( v1_, s.v1, sizeof( v1_ ) );
+        std::memcpy( mul0_, s.mul0, sizeof( mul0_ ) );
+        std::memcpy( mul1_, s.mul1, sizeof( mul1_ ) );
+    }
+
+    static void zipper_merge_and_add( std::uint64_t v1, std::uint64_t v0, std::uint64_t & add1, std::uint64_t & add0 )
+    {
+        add0 += ( ( ( v0 & 0xFF000000ull ) | ( v1 & 0xFF00000000ull ) ) >> 24 ) |
+            ( ( ( v0 & 0xFF0000000000ull ) | ( v1 & 0xFF000000000000ull ) ) >> 16 ) |
+            ( v0 & 0xFF0000ull ) | ( ( v0 & 0xFF00ull ) << 32 ) |
+            ( ( v1 & 0xFF00000000000000ull ) >> 8 ) | ( v0 << 56 );
+
+        add1 += ( ( ( v1 & 0xFF000000ull ) | ( v0 & 0xFF00000000ull ) ) >> 24 ) |
+            ( v1 & 0xFF0000ull ) | ( ( v1 & 0xFF0000000000ull ) >> 16 ) |
+            ( ( v1 & 0xFF00ull ) << 24 ) | ( ( v0 & 0xFF000000000000ull ) >> 8 ) |
+            ( ( v1 & 0xFFull ) << 48 ) | ( v0 & 0xFF00000000000000ull );
+    }
+
+    static BOOST_FORCEINLINE void update_lane( std::uint64_t & v0, std::uint64_t & v1, std::uint64_t & mul0, std::uint64_t & mul1, std::uint64_t lane )
+    {
+        v1 += mul0 + lane;
+        mul0 ^= ( v1 & 0xFFFFFFFFu ) * ( v0 >> 32 );
+
+        v0 += mul1;
+        mul1 ^= ( v0 & 0xFFFFFFFFu ) * ( v1 >> 32 );
+    }
+
+    static BOOST_FORCEINLINE void update_( state & s, std::uint64_t const * lanes )
+    {
+        update_lane( s.v0[ 0 ], s.v1[ 0 ], s.mul0[ 0 ], s.mul1[ 0 ], lanes[ 0 ] );
+        update_lane( s.v0[ 1 ], s.v1[ 1 ], s.mul0[ 1 ], s.mul1[ 1 ], lanes[ 1 ] );
+        update_lane( s.v0[ 2 ], s.v1[ 2 ], s.mul0[ 2 ], s.mul1[ 2 ], lanes[ 2 ] );
+        update_lane( s.v0[ 3 ], s.v1[ 3 ], s.mul0[ 3 ], s.mul1[ 3 ], lanes[ 3 ] );
+
+        zipper_merge_and_add( s.v1[ 1 ], s.v1[ 0 ], s.v0[ 1 ], s.v0[ 0 ] );
+        zipper_merge_and_add( s.v1[ 3 ], s.v1[ 2 ], s.v0[ 3 ], s.v0[ 2 ] );
+
+        zipper_merge_and_add( s.v0[ 1 ], s.v0[ 0 ], s.v1[ 1 ], s.v1[ 0 ] );
+        zipper_merge_and_add( s.v0[ 3 ], s.v0[ 2 ], s.v1[ 3 ], s.v1[ 2 ] );
+    }
+
+    static BOOST_FORCEINLINE void update_( state & s, unsigned char const * p )
+    {
+        std::uint64_t lanes[ 4 ];
+
+        for( int j = 0; j < 4; ++j )
+        {
+            lanes[ j ] = detail::read64le( p + 8 * j );
+        }
+
+        update_( s, lanes );
+    }
+
+    void process( unsigned char const * p, std::size_t k )
+    {
+        state s;
+        load( s );
+
+        for( std::size_t i = 0; i < k; ++i, p += N )
+        {
+            update_( s, p );
+        }
+
+        store( s );
+    }
+
+    // processes the final partial packet, if any, then runs k
+    // permutation rounds
+    void finalize_( int k )
+    {
+        state s;
+        load( s );
+
+        if( m_ > 0 )
+        {
+            std::uint64_t const m = m_;
+
+            for( int i = 0; i < 4; ++i )
+            {
+                s.v0[ i ] += ( m << 32 ) + m;
+
+                // rotate both 32 bit halves left by m
+                std::uint32_t lo = static_cast<std::uint32_t>( s.v1[ i ] );
+                std::uint32_t hi = static_cast<std::uint32_t>( s.v1[ i ] >> 32 );
+
+                s.v1[ i ] = ( static_cast<std::uint64_t>( detail::rotl( hi, static_cast<int>( m ) ) ) << 32 ) | detail::rotl( lo, static_cast<int>( m ) );
+            }
+
+            unsigned char packet[ N ];
+            make_packet( packet );
+
+            update_( s, packet );
+        }
+
+        for( int i = 0; i < k; ++i )
+        {
+            std::uint64_t lanes[ 4 ];
+
+            lanes[ 0 ] = detail::rotl( s.v0[ 2 ], 32 );
+            lanes[ 1 ] = detail::rotl( s.v0[ 3 ], 32 );
+            lanes[ 2 ] = detail::rotl( s.v0[ 0 ], 32 );
+            lanes[ 3 ] = detail::rotl( s.v0[ 1 ], 32 );
+
+            update_( s, lanes );
+        }
+
+        store( s );
+    }
+
+#endif
+
+protected:
+
+    void init( std::uint64_t k0, std::uint64_t k1, std::uint64_t k2, std::uint64_t k3 )
+    {
+        mul0_[ 0 ] = 0xDBE6D5D5FE4CCE2Full;
+        mul0_[ 1 ] = 0xA4093822299F31D0ull;
+        mul0_[ 2 ] = 0x13198A2E03707344ull;
+        mul0_[ 3 ] = 0x243F6A8885A308D3ull;
+
+        mul1_[ 0 ] = 0x3BD39E10CB0EF593ull;
+        mul1_[ 1 ] = 0xC0ACF169B5F18A8Cull;
+        mul1_[ 2 ] = 0xBE5466CF34E90C6Cull;
+        mul1_[ 3 ] = 0x452821E638D01377ull;
+
+        std::uint64_t const k[ 4 ] = { k0, k1, k2, k3 };
+
+        for( int i = 0; i < 4; ++i )
+        {
+            v0_[ i ] = mul0_[ i ] ^ k[ i ];
+            v1_[ i ] = mul1_[ i ] ^ detail::rotl( k[ i ], 32 );
+        }
+
+        m_ = 0;
+    }
+
+    // the byte seed, up to 32 bytes, is the key, as in siphash_64;
+    // if longer, the rest is hashed
+    void init( unsigned char const * p, std::size_t n )
+    {
+        if( n == 0 )
+        {
+            init( 0, 0, 0, 0 );
+        }
+        else if( n <= 32 )
+        {
+            unsigned char q[ 32 ] = { 0 };
+            std::memcpy( q, p, n );
+
+            init( detail::read64le( q + 0 ), detail::read64le( q + 8 ), detail::read64le( q + 16 ), detail::read64le( q + 24 ) );
+        }
+        else
+        {
+            init( detail::read64le( p + 0 ), detail::read64le( p + 8 ), detail::read64le( p + 16 ), detail::read64le( p + 24 ) );
+
+            p += 32;
+            n -= 32;
+
+            update( p, n );
+
+            finalize( 4 );
+        }
+    }
+
+    // called from result(); processes the buffered input, then
+    // runs the permutation rounds of the finalization on the state
+    void finalize( int k )
+    {
+        finalize_( k );
+
+        if( m_ > 0 )
+        {
+            m_ = 0;
+
+            // clear buffered plaintext
+            std::memset( buffer_, 0, N );
+        }
+    }
+
+    std::uint64_t digest64() const
+    {
+        return v0_[ 0 ] + v1_[ 0 ] + mul0_[ 0 ] + mul1_[ 0 ];
+    }
+
+    void digest128( std::uint64_t * h ) const
+    {
+        h[ 0 ] = v0_[ 0 ] + mul0_[ 0 ] + v1_[ 2 ] + mul1_[ 2 ];
+        h[ 1 ] = v0_[ 1 ] + mul0_[ 1 ] + v1_[ 3 ] + mul1_[ 3 ];
+    }
+
+    static void modular_reduction( std::uint64_t a3, std::uint64_t a2, std::uint64_t a1, std::uint64_t a0, std::uint64_t & m1, std::uint64_t & m0 )
+    {
+        a3 &= 0x3FFFFFFFFFFFFFFFull;
+
+        m1 = a1 ^ ( ( a3 << 1 ) | ( a2 >> 63 ) ) ^ ( ( a3 << 2 ) | ( a2 >> 62 ) );
+        m0 = a0 ^ ( a2 << 1 ) ^ ( a2 << 2 );
+    }
+
+    void digest256( std::uint64_t * h ) const
+    {
+        modular_reduction( v1_[ 1 ] + mul1_[ 1 ], v1_[ 0 ] + mul1_[ 0 ], v0_[ 1 ] + mul0_[ 1 ], v0_[ 0 ] + mul0_[ 0 ], h[ 1 ], h[ 0 ] );
+        modular_reduction( v1_[ 3 ] + mul1_[ 3 ], v1_[ 2 ] + mul1_[ 2 ], v0_[ 3 ] + mul0_[ 3 ], v0_[ 2 ] + mul0_[ 2 ], h[ 3 ], h[ 2 ] );
+    }
+
+public:
+
+    typedef std::uint64_t size_type;
+
+    void update( void const * pv, std::size_t n )
+    {
+        unsigned char const* p = static_cast<unsigned char const*>( pv );
+
+        if( n == 0 ) return;
+
+        if( m_ > 0 )
+        {
+            std::size_t k = N - m_;
+
+            if( n < k )
+            {
+                k = n;
+            }
+
+            std::memcpy( buffer_ + m_, p, k );
+
+            p += k;
+            n -= k;
+            m_ += k;
+
+            if( m_ < N ) return;
+
+            BOOST_ASSERT( m_ == N );
+
+            process( buffer_, 1 );
+            m_ = 0;
+
+            // clear buffered plaintext
+            std::memset( buffer_, 0, N );
+        }
+
+        BOOST_ASSERT( m_ == 0 );
+
+        if( n >= N )
+        {
+            std::size_t k = n / N;
+
+            process( p, k );
+
+            p += k * N;
+            n -= k * N;
+        }
+
+        BOOST_ASSERT( n < N );
+
+        if( n > 0 )
+        {
+            std::memcpy( buffer_, p, n );
+            m_ = n;
+        }
+    }
+};
+
+} // namespace detail
+
+class highwayhash_64: public detail::highwayhash_base
+{
+public:
+
+    typedef std::uint64_t result_type;
+
+    explicit highwayhash_64( std::uint64_t k0 = 0, std::uint64_t k1 = 0, std::uint64_t k2 = 0, std::uint64_t k3 = 0 )
+    {
+        init( k0, k1, k2, k3 );
+    }
+
+    highwayhash_64( unsigned char const * p, std::size_t n )
+    {
+        init( p, n );
+    }
+
+    result_type result()
+    {
+        finalize( 4 );
+        return digest64();
+    }
+};
+
+class highwayhash_128: public detail::highwayhash_base
+{
+public:
+
+    typedef std::array<unsigned char, 16> result_type;
+
+    explicit highwayhash_128( std::uint64_t k0 = 0, std::uint64_t k1 = 0, std::uint64_t k2 = 0, std::uint64_t k3 = 0 )
+    {
+        init( k0, k1, k2, k3 );
+    }
+
+    highwayhash_128( unsigned char const * p, std::size_t n )
+    {
+        init( p, n );
+    }
+
+    result_type result()
+    {
+        finalize( 6 );
+
+        std::uint64_t h[ 2 ];
+        digest128( h );
+
+        result_type r;
+
+        detail::write64le( &r[ 0 ], h[ 0 ] );
+        detail::write64le( &r[ 8 ], h[ 1 ] );
+
+        return r;
+    }
+};
+
+class highwayhash_256: public detail::highwayhash_base
+{
+public:
+
+    typedef std::array<unsigned char, 32> result_type;
+
+    explicit highwayhash_256( std::uint64_t k0 = 0, std::uint64_t k1 = 0, std::uint64_t k2 = 0, std::uint64_t k3 = 0 )
+    {
+        init( k0, k1, k2, k3 );
+    }
+
+    highwayhash_256( unsigned char const * p, std::size_t n )
+    {
+        init( p, n );
+    }
+
+    result_type result()
+    {
+        finalize( 10 );
+
+        std::uint64_t h[ 4 ];
+        digest256( h );
+
+        result_type r;
+
+        for( int i = 0; i < 4; ++i )
+        {
+            detail::write64le( &r[ 8 * i ], h[ i ] );
+        }
+
+        return r;
+    }
+};
+
+} // namespace hash2
+} // namespace boost
+
+#endif // #ifndef BOOST_HASH2_HIGHWAYHASH_HPP_INCLUDED
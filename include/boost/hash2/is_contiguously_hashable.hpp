@@ -14,10 +14,19 @@ namespace boost
 namespace hash2
 {
 
-namespace detail
-{
-
 // is_trivially_equality_comparable
+//
+// Can be specialized for a class type whose values are equal if and
+// only if their object representations are; such a type has no padding,
+// and all its members are integers, enumerations, pointers or such types.
+// It's then hashed with a single update() call, and so are arrays and
+// vectors of it, bypassing any hash_append overload for it.
+//
+// This is never deduced for class types, as a user hash_append for the
+// type, which may hash only some of the members, or be specific to one
+// hash algorithm, can't reliably be detected. A specialization can derive
+// from std::has_unique_object_representations<T>, under C++17, to check
+// for padding.
 
 template<class T> struct is_trivially_equality_comparable:
     std::integral_constant< bool, std::is_integral<T>::value || std::is_enum<T>::value || std::is_pointer<T>::value >
@@ -29,6 +38,9 @@ template<class T> struct is_trivially_equality_comparable<T const>:
 {
 };
 
+namespace detail
+{
+
 // is_endian_independent
 
 template<class T> struct is_endian_independent:
@@ -46,7 +58,7 @@ template<class T> struct is_endian_independent<T const>:
 // is_contiguously_hashable
 
 template<class T, endian E> struct is_contiguously_hashable:
-    std::integral_constant<bool, detail::is_trivially_equality_comparable<T>::value && (E == endian::native || detail::is_endian_independent<T>::value)>
+    std::integral_constant<bool, is_trivially_equality_comparable<T>::value && (E == endian::native || detail::is_endian_independent<T>::value)>
 {
 };
 
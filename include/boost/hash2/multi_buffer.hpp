@@ -0,0 +1,606 @@
+#ifndef BOOST_HASH2_MULTI_BUFFER_HPP_INCLUDED
+#define BOOST_HASH2_MULTI_BUFFER_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// Multi-buffer MD5, SHA-1 and SHA-256: hash many independent messages at once,
+// running the compression function of eight of them in parallel lanes
+
+#include <boost/hash2/sha2.hpp>
+#include <boost/hash2/detail/u32x8.hpp>
+#include <boost/hash2/detail/read.hpp>
+#include <boost/hash2/detail/write.hpp>
+#include <boost/config.hpp>
+#include <cstdint>
+#include <array>
+#include <cstring>
+#include <cstddef>
+
+namespace boost
+{
+namespace hash2
+{
+namespace detail
+{
+
+// K describes the compression function:
+//
+//   static const int state_words;
+//   static const int digest_words;
+//   static const bool big_endian;
+//   static void init( std::uint32_t state[][ 8 ], int lane );
+//   static void transform( std::uint32_t state[][ 8 ], std::uint32_t const w[ 16 ][ 8 ] );
+
+template<class K> class multi_buffer
+{
+private:
+
+    static const int L = 8;
+    static const int N = 64;
+
+    struct lane
+    {
+        unsigned char const * p; // next full block of the message
+        std::size_t blocks;      // number of full blocks left
+
+        unsigned char const * q; // next block of the padded tail
+        std::size_t tail;        // number of tail blocks left
+
+        std::size_t index;       // index of the message, or -1 when idle
+
+        unsigned char buffer[ 2 * N ];
+    };
+
+    static void start( lane & ln, std::size_t index, void const * pv, std::size_t n )
+    {
+        unsigned char const* p = static_cast<unsigned char const*>( pv );
+
+        std::size_t m = n % N;
+
+        ln.p = p;
+        ln.blocks = n / N;
+
+        std::memset( ln.buffer, 0, sizeof( ln.buffer ) );
+
+        if( m != 0 )
+        {
+            std::memcpy( ln.buffer, p + ( n - m ), m );
+        }
+
+        ln.buffer[ m ] = 0x80;
+
+        std::size_t k = m < N - 8? N: 2 * N;
+
+        if( K::big_endian )
+        {
+            detail::write64be( ln.buffer + k - 8, static_cast<std::uint64_t>( n ) * 8 );
+        }
+        else
+        {
+            detail::write64le( ln.buffer + k - 8, static_cast<std::uint64_t>( n ) * 8 );
+        }
+
+        ln.q = ln.buffer;
+        ln.tail = k / N;
+
+        ln.index = index;
+    }
+
+public:
+
+    typedef std::array<unsigned char, K::digest_words * 4> result_type;
+
+    static const int lanes = L;
+
+    // computes r[ i ] as the digest of the n[ i ] bytes at p[ i ], i < k
+    static void hash( std::size_t k, void const * const p[], std::size_t const n[], result_type r[] )
+    {
+        std::uint32_t state[ K::state_words ][ L ];
+        std::uint32_t w[ 16 ][ L ];
+
+        lane slots[ L ];
+
+        std::size_t next = 0;
+        int active = 0;
+
+        for( int j = 0; j < L; ++j )
+        {
+            if( next < k )
+            {
+                start( slots[ j ], next, p[ next ], n[ next ] );
+                K::init( state, j );
+
+                ++next;
+                ++active;
+            }
+            else
+            {
+                // idle lanes process their (zeroed) buffer, and their state is ignored
+                std::memset( slots[ j ].buffer, 0, sizeof( slots[ j ].buffer ) );
+
+                slots[ j ].index = static_cast<std::size_t>( -1 );
+                K::init( state, j );
+            }
+        }
+
+        while( active > 0 )
+        {
+            for( int j = 0; j < L; ++j )
+            {
+                lane & ln = slots[ j ];
+
+                unsigned char const * block;
+
+                if( ln.index == static_cast<std::size_t>( -1 ) )
+                {
+                    block = ln.buffer;
+                }
+                else if( ln.blocks > 0 )
+                {
+                    block = ln.p;
+
+                    ln.p += N;
+                    --ln.blocks;
+                }
+                else
+                {
+                    block = ln.q;
+
+                    ln.q += N;
+                    --ln.tail;
+                }
+
+                for( int i = 0; i < 16; ++i )
+                {
+                    w[ i ][ j ] = K::big_endian? detail::read32be( block + i * 4 ): detail::read32le( block + i * 4 );
+                }
+            }
+
+            K::transform( state, w );
+
+            for( int j = 0; j < L; ++j )
+            {
+                lane & ln = slots[ j ];
+
+                if( ln.index == static_cast<std::size_t>( -1 ) || ln.blocks > 0 || ln.tail > 0 ) continue;
+
+                result_type & digest = r[ ln.index ];
+
+                for( int i = 0; i < K::digest_words; ++i )
+                {
+                    if( K::big_endian )
+                    {
+                        detail::write32be( &digest[ i * 4 ], state[ i ][ j ] );
+                    }
+                    else
+                    {
+                        detail::write32le( &digest[ i * 4 ], state[ i ][ j ] );
+                    }
+                }
+
+                if( next < k )
+                {
+                    start( ln, next, p[ next ], n[ next ] );
+                    K::init( state, j );
+
+                    ++next;
+                }
+                else
+                {
+                    std::memset( ln.buffer, 0, sizeof( ln.buffer ) );
+
+                    ln.index = static_cast<std::size_t>( -1 );
+                    --active;
+                }
+            }
+        }
+
+        std::memset( w, 0, sizeof( w ) );
+    }
+};
+
+struct md5_x8_kernel
+{
+    static const int state_words = 4;
+    static const int digest_words = 4;
+    static const bool big_endian = false;
+
+    static void init( std::uint32_t state[][ 8 ], int j )
+    {
+        state[ 0 ][ j ] = 0x67452301u;
+        state[ 1 ][ j ] = 0xefcdab89u;
+        state[ 2 ][ j ] = 0x98badcfeu;
+        state[ 3 ][ j ] = 0x10325476u;
+    }
+
+    template<int S> static BOOST_FORCEINLINE void FF( u32x8 & a, u32x8 b, u32x8 c, u32x8 d, u32x8 x, std::uint32_t ac )
+    {
+        a = a + select( b, c, d ) + x + set1_u32x8( ac );
+        a = rotl<S>( a ) + b;
+    }
+
+    template<int S> static BOOST_FORCEINLINE void GG( u32x8 & a, u32x8 b, u32x8 c, u32x8 d, u32x8 x, std::uint32_t ac )
+    {
+        a = a + select( d, b, c ) + x + set1_u32x8( ac );
+        a = rotl<S>( a ) + b;
+    }
+
+    template<int S> static BOOST_FORCEINLINE void HH( u32x8 & a, u32x8 b, u32x8 c, u32x8 d, u32x8 x, std::uint32_t ac )
+    {
+        a = a + xor3( b, c, d ) + x + set1_u32x8( ac );
+        a = rotl<S>( a ) + b;
+    }
+
+    template<int S> static BOOST_FORCEINLINE void II( u32x8 & a, u32x8 b, u32x8 c, u32x8 d, u32x8 x, std::uint32_t ac )
+    {
+        a = a + xor_or_not( b, c, d ) + x + set1_u32x8( ac );
+        a = rotl<S>( a ) + b;
+    }
+
+    static const int S11 = 7;
+    static const int S12 = 12;
+    static const int S13 = 17;
+    static const int S14 = 22;
+    static const int S21 = 5;
+    static const int S22 = 9;
+    static const int S23 = 14;
+    static const int S24 = 20;
+    static const int S31 = 4;
+    static const int S32 = 11;
+    static const int S33 = 16;
+    static const int S34 = 23;
+    static const int S41 = 6;
+    static const int S42 = 10;
+    static const int S43 = 15;
+    static const int S44 = 21;
+
+    static void transform( std::uint32_t state[][ 8 ], std::uint32_t const w[ 16 ][ 8 ] )
+    {
+        u32x8 a = load_u32x8( state[ 0 ] );
+        u32x8 b = load_u32x8( state[ 1 ] );
+        u32x8 c = load_u32x8( state[ 2 ] );
+        u32x8 d = load_u32x8( state[ 3 ] );
+
+        u32x8 x[ 16 ];
+
+        for( int i = 0; i < 16; ++i )
+        {
+            x[ i ] = load_u32x8( w[ i ] );
+        }
+
+        FF<S11>( a, b, c, d, x[ 0], 0xd76aa478 );
+        FF<S12>( d, a, b, c, x[ 1], 0xe8c7b756 );
+        FF<S13>( c, d, a, b, x[ 2], 0x242070db );
+        FF<S14>( b, c, d, a, x[ 3], 0xc1bdceee );
+        FF<S11>( a, b, c, d, x[ 4], 0xf57c0faf );
+        FF<S12>( d, a, b, c, x[ 5], 0x4787c62a );
+        FF<S13>( c, d, a, b, x[ 6], 0xa8304613 );
+        FF<S14>( b, c, d, a, x[ 7], 0xfd469501 );
+        FF<S11>( a, b, c, d, x[ 8], 0x698098d8 );
+        FF<S12>( d, a, b, c, x[ 9], 0x8b44f7af );
+        FF<S13>( c, d, a, b, x[10], 0xffff5bb1 );
+        FF<S14>( b, c, d, a, x[11], 0x895cd7be );
+        FF<S11>( a, b, c, d, x[12], 0x6b901122 );
+        FF<S12>( d, a, b, c, x[13], 0xfd987193 );
+        FF<S13>( c, d, a, b, x[14], 0xa679438e );
+        FF<S14>( b, c, d, a, x[15], 0x49b40821 );
+
+        GG<S21>( a, b, c, d, x[ 1], 0xf61e2562 );
+        GG<S22>( d, a, b, c, x[ 6], 0xc040b340 );
+        GG<S23>( c, d, a, b, x[11], 0x265e5a51 );
+        GG<S24>( b, c, d, a, x[ 0], 0xe9b6c7aa );
+        GG<S21>( a, b, c, d, x[ 5], 0xd62f105d );
+        GG<S22>( d, a, b, c, x[10],  0x2441453 );
+        GG<S23>( c, d, a, b, x[15], 0xd8a1e681 );
+        GG<S24>( b, c, d, a, x[ 4], 0xe7d3fbc8 );
+        GG<S21>( a, b, c, d, x[ 9], 0x21e1cde6 );
+        GG<S22>( d, a, b, c, x[14], 0xc33707d6 );
+        GG<S23>( c, d, a, b, x[ 3], 0xf4d50d87 );
+        GG<S24>( b, c, d, a, x[ 8], 0x455a14ed );
+        GG<S21>( a, b, c, d, x[13], 0xa9e3e905 );
+        GG<S22>( d, a, b, c, x[ 2], 0xfcefa3f8 );
+        GG<S23>( c, d, a, b, x[ 7], 0x676f02d9 );
+        GG<S24>( b, c, d, a, x[12], 0x8d2a4c8a );
+
+        HH<S31>( a, b, c, d, x[ 5], 0xfffa3942 );
+        HH<S32>( d, a, b, c, x[ 8], 0x8771f681 );
+        HH<S33>( c, d, a, b, x[11], 0x6d9d6122 );
+        HH<S34>( b, c, d, a, x[14], 0xfde5380c );
+        HH<S31>( a, b, c, d, x[ 1], 0xa4beea44 );
+        HH<S32>( d, a, b, c, x[ 4], 0x4bdecfa9 );
+        HH<S33>( c, d, a, b, x[ 7], 0xf6bb4b60 );
+        HH<S34>( b, c, d, a, x[10], 0xbebfbc70 );
+        HH<S31>( a, b, c, d, x[13], 0x289b7ec6 );
+        HH<S32>( d, a, b, c, x[ 0], 0xeaa127fa );
+        HH<S33>( c, d, a, b, x[ 3], 0xd4ef3085 );
+        HH<S34>( b, c, d, a, x[ 6],  0x4881d05 );
+        HH<S31>( a, b, c, d, x[ 9], 0xd9d4d039 );
+        HH<S32>( d, a, b, c, x[12], 0xe6db99e5 );
+        HH<S33>( c, d, a, b, x[15], 0x1fa27cf8 );
+        HH<S34>( b, c, d, a, x[ 2], 0xc4ac5665 );
+
+        II<S41>( a, b, c, d, x[ 0], 0xf4292244 );
+        II<S42>( d, a, b, c, x[ 7], 0x432aff97 );
+        II<S43>( c, d, a, b, x[14], 0xab9423a7 );
+        II<S44>( b, c, d, a, x[ 5], 0xfc93a039 );
+        II<S41>( a, b, c, d, x[12], 0x655b59c3 );
+        II<S42>( d, a, b, c, x[ 3], 0x8f0ccc92 );
+        II<S43>( c, d, a, b, x[10], 0xffeff47d );
+        II<S44>( b, c, d, a, x[ 1], 0x85845dd1 );
+        II<S41>( a, b, c, d, x[ 8], 0x6fa87e4f );
+        II<S42>( d, a, b, c, x[15], 0xfe2ce6e0 );
+        II<S43>( c, d, a, b, x[ 6], 0xa3014314 );
+        II<S44>( b, c, d, a, x[13], 0x4e0811a1 );
+        II<S41>( a, b, c, d, x[ 4], 0xf7537e82 );
+        II<S42>( d, a, b, c, x[11], 0xbd3af235 );
+        II<S43>( c, d, a, b, x[ 2], 0x2ad7d2bb );
+        II<S44>( b, c, d, a, x[ 9], 0xeb86d391 );
+
+        store_u32x8( state[ 0 ], load_u32x8( state[ 0 ] ) + a );
+        store_u32x8( state[ 1 ], load_u32x8( state[ 1 ] ) + b );
+        store_u32x8( state[ 2 ], load_u32x8( state[ 2 ] ) + c );
+        store_u32x8( state[ 3 ], load_u32x8( state[ 3 ] ) + d );
+    }
+};
+
+struct sha1_x8_kernel
+{
+    static const int state_words = 5;
+    static const int digest_words = 5;
+    static const bool big_endian = true;
+
+    static void init( std::uint32_t state[][ 8 ], int j )
+    {
+        state[ 0 ][ j ] = 0x67452301u;
+        state[ 1 ][ j ] = 0xefcdab89u;
+        state[ 2 ][ j ] = 0x98badcfeu;
+        state[ 3 ][ j ] = 0x10325476u;
+        state[ 4 ][ j ] = 0xc3d2e1f0u;
+    }
+
+    static BOOST_FORCEINLINE u32x8 W( u32x8 x[], int i )
+    {
+        if( i >= 16 )
+        {
+            x[ i & 15 ] = rotl<1>( x[ ( i - 3 ) & 15 ] ^ x[ ( i - 8 ) & 15 ] ^ x[ ( i - 14 ) & 15 ] ^ x[ i & 15 ] );
+        }
+
+        return x[ i & 15 ];
+    }
+
+    static BOOST_FORCEINLINE void R1( u32x8 a, u32x8 & b, u32x8 c, u32x8 d, u32x8 & e, u32x8 w )
+    {
+        e = e + rotl<5>( a ) + select( b, c, d ) + set1_u32x8( 0x5A827999 ) + w;
+        b = rotl<30>( b );
+    }
+
+    static BOOST_FORCEINLINE void R2( u32x8 a, u32x8 & b, u32x8 c, u32x8 d, u32x8 & e, u32x8 w )
+    {
+        e = e + rotl<5>( a ) + xor3( b, c, d ) + set1_u32x8( 0x6ED9EBA1 ) + w;
+        b = rotl<30>( b );
+    }
+
+    static BOOST_FORCEINLINE void R3( u32x8 a, u32x8 & b, u32x8 c, u32x8 d, u32x8 & e, u32x8 w )
+    {
+        e = e + rotl<5>( a ) + majority( b, c, d ) + set1_u32x8( 0x8F1BBCDC ) + w;
+        b = rotl<30>( b );
+    }
+
+    static BOOST_FORCEINLINE void R4( u32x8 a, u32x8 & b, u32x8 c, u32x8 d, u32x8 & e, u32x8 w )
+    {
+        e = e + rotl<5>( a ) + xor3( b, c, d ) + set1_u32x8( 0xCA62C1D6 ) + w;
+        b = rotl<30>( b );
+    }
+
+    static void transform( std::uint32_t state[][ 8 ], std::uint32_t const w[ 16 ][ 8 ] )
+    {
+        u32x8 a = load_u32x8( state[ 0 ] );
+        u32x8 b = load_u32x8( state[ 1 ] );
+        u32x8 c = load_u32x8( state[ 2 ] );
+        u32x8 d = load_u32x8( state[ 3 ] );
+        u32x8 e = load_u32x8( state[ 4 ] );
+
+        u32x8 x[ 16 ];
+
+        for( int i = 0; i < 16; ++i )
+        {
+            x[ i ] = load_u32x8( w[ i ] );
+        }
+
+        for( int i = 0; i < 20; i += 5 )
+        {
+            R1( a, b, c, d, e, W( x, i + 0 ) );
+            R1( e, a, b, c, d, W( x, i + 1 ) );
+            R1( d, e, a, b, c, W( x, i + 2 ) );
+            R1( c, d, e, a, b, W( x, i + 3 ) );
+            R1( b, c, d, e, a, W( x, i + 4 ) );
+        }
+
+        for( int i = 20; i < 40; i += 5 )
+        {
+            R2( a, b, c, d, e, W( x, i + 0 ) );
+            R2( e, a, b, c, d, W( x, i + 1 ) );
+            R2( d, e, a, b, c, W( x, i + 2 ) );
+            R2( c, d, e, a, b, W( x, i + 3 ) );
+            R2( b, c, d, e, a, W( x, i + 4 ) );
+        }
+
+        for( int i = 40; i < 60; i += 5 )
+        {
+            R3( a, b, c, d, e, W( x, i + 0 ) );
+            R3( e, a, b, c, d, W( x, i + 1 ) );
+            R3( d, e, a, b, c, W( x, i + 2 ) );
+            R3( c, d, e, a, b, W( x, i + 3 ) );
+            R3( b, c, d, e, a, W( x, i + 4 ) );
+        }
+
+        for( int i = 60; i < 80; i += 5 )
+        {
+            R4( a, b, c, d, e, W( x, i + 0 ) );
+            R4( e, a, b, c, d, W( x, i + 1 ) );
+            R4( d, e, a, b, c, W( x, i + 2 ) );
+            R4( c, d, e, a, b, W( x, i + 3 ) );
+            R4( b, c, d, e, a, W( x, i + 4 ) );
+        }
+
+        store_u32x8( state[ 0 ], load_u32x8( state[ 0 ] ) + a );
+        store_u32x8( state[ 1 ], load_u32x8( state[ 1 ] ) + b );
+        store_u32x8( state[ 2 ], load_u32x8( state[ 2 ] ) + c );
+        store_u32x8( state[ 3 ], load_u32x8( state[ 3 ] ) + d );
+        store_u32x8( state[ 4 ], load_u32x8( state[ 4 ] ) + e );
+    }
+};
+
+struct sha2_256_x8_kernel
+{
+    static const int state_words = 8;
+    static const int digest_words = 8;
+    static const bool big_endian = true;
+
+    static void init( std::uint32_t state[][ 8 ], int j )
+    {
+        state[ 0 ][ j ] = 0x6a09e667u;
+        state[ 1 ][ j ] = 0xbb67ae85u;
+        state[ 2 ][ j ] = 0x3c6ef372u;
+        state[ 3 ][ j ] = 0xa54ff53au;
+        state[ 4 ][ j ] = 0x510e527fu;
+        state[ 5 ][ j ] = 0x9b05688cu;
+        state[ 6 ][ j ] = 0x1f83d9abu;
+        state[ 7 ][ j ] = 0x5be0cd19u;
+    }
+
+    // rotr( x, k ) == rotl( x, 32 - k )
+
+    static BOOST_FORCEINLINE u32x8 Sigma0( u32x8 x )
+    {
+        return xor3( rotl<30>( x ), rotl<19>( x ), rotl<10>( x ) );
+    }
+
+    static BOOST_FORCEINLINE u32x8 Sigma1( u32x8 x )
+    {
+        return xor3( rotl<26>( x ), rotl<21>( x ), rotl<7>( x ) );
+    }
+
+    static BOOST_FORCEINLINE u32x8 sigma0( u32x8 x )
+    {
+        return xor3( rotl<25>( x ), rotl<14>( x ), shr<3>( x ) );
+    }
+
+    static BOOST_FORCEINLINE u32x8 sigma1( u32x8 x )
+    {
+        return xor3( rotl<15>( x ), rotl<13>( x ), shr<10>( x ) );
+    }
+
+    static BOOST_FORCEINLINE u32x8 W( u32x8 x[], int i )
+    {
+        if( i >= 16 )
+        {
+            x[ i & 15 ] = sigma1( x[ ( i - 2 ) & 15 ] ) + x[ ( i - 7 ) & 15 ] + sigma0( x[ ( i - 15 ) & 15 ] ) + x[ i & 15 ];
+        }
+
+        return x[ i & 15 ];
+    }
+
+    static BOOST_FORCEINLINE void R( u32x8 a, u32x8 b, u32x8 c, u32x8 & d, u32x8 e, u32x8 f, u32x8 g, u32x8 & h, u32x8 w, std::uint32_t k )
+    {
+        h = h + Sigma1( e ) + select( e, f, g ) + w + set1_u32x8( k );
+        d = d + h;
+        h = h + Sigma0( a ) + majority( a, b, c );
+    }
+
+    static void transform( std::uint32_t state[][ 8 ], std::uint32_t const w[ 16 ][ 8 ] )
+    {
+        std::uint32_t const * K = sha2_256_constants<>::K;
+
+        u32x8 a = load_u32x8( state[ 0 ] );
+        u32x8 b = load_u32x8( state[ 1 ] );
+        u32x8 c = load_u32x8( state[ 2 ] );
+        u32x8 d = load_u32x8( state[ 3 ] );
+        u32x8 e = load_u32x8( state[ 4 ] );
+        u32x8 f = load_u32x8( state[ 5 ] );
+        u32x8 g = load_u32x8( state[ 6 ] );
+        u32x8 h = load_u32x8( state[ 7 ] );
+
+        u32x8 x[ 16 ];
+
+        for( int i = 0; i < 16; ++i )
+        {
+            x[ i ] = load_u32x8( w[ i ] );
+        }
+
+        for( int i = 0; i < 64; i += 8 )
+        {
+            R( a, b, c, d, e, f, g, h, W( x, i + 0 ), K[ i + 0 ] );
+            R( h, a, b, c, d, e, f, g, W( x, i + 1 ), K[ i + 1 ] );
+            R( g, h, a, b, c, d, e, f, W( x, i + 2 ), K[ i + 2 ] );
+            R( f, g, h, a, b, c, d, e, W( x, i + 3 ), K[ i + 3 ] );
+            R( e, f, g, h, a, b, c, d, W( x, i + 4 ), K[ i + 4 ] );
+            R( d, e, f, g, h, a, b, c, W( x, i + 5 ), K[ i + 5 ] );
+            R( c, d, e, f, g, h, a, b, W( x, i + 6 ), K[ i + 6 ] );
+            R( b, c, d, e, f, g, h, a, W( x, i + 7 ), K[ i + 7 ] );
+        }
+
+        store_u32x8( state[ 0 ], load_u32x8( state[ 0 ] ) + a );
+        store_u32x8( state[ 1 ], load_u32x8( state[ 1 ] ) + b );
+        store_u32x8( state[ 2 ], load_u32x8( state[ 2 ] ) + c );
+        store_u32x8( state[ 3 ], load_u32x8( state[ 3 ] ) + d );
+        store_u32x8( state[ 4 ], load_u32x8( state[ 4 ] ) + e );
+        store_u32x8( state[ 5 ], load_u32x8( state[ 5 ] ) + f );
+        store_u32x8( state[ 6 ], load_u32x8( state[ 6 ] ) + g );
+        store_u32x8( state[ 7 ], load_u32x8( state[ 7 ] ) + h );
+    }
+};
+
+struct sha2_224_x8_kernel: sha2_256_x8_kernel
+{
+    static const int digest_words = 7;
+
+    static void init( std::uint32_t state[][ 8 ], int j )
+    {
+        state[ 0 ][ j ] = 0xc1059ed8u;
+        state[ 1 ][ j ] = 0x367cd507u;
+        state[ 2 ][ j ] = 0x3070dd17u;
+        state[ 3 ][ j ] = 0xf70e5939u;
+        state[ 4 ][ j ] = 0xffc00b31u;
+        state[ 5 ][ j ] = 0x68581511u;
+        state[ 6 ][ j ] = 0x64f98fa7u;
+        state[ 7 ][ j ] = 0xbefa4fa4u;
+    }
+};
+
+} // namespace detail
+
+// md5_128_x8::hash( k, p, n, r ) computes the same digests as
+// k separate md5_128 instances, eight messages at a time
+
+class md5_128_x8: public detail::multi_buffer<detail::md5_x8_kernel>
+{
+};
+
+// sha1_160_x8::hash( k, p, n, r ) computes the same digests as
+// k separate sha1_160 instances, eight messages at a time
+
+class sha1_160_x8: public detail::multi_buffer<detail::sha1_x8_kernel>
+{
+};
+
+// sha2_256_x8::hash( k, p, n, r ) computes the same digests as
+// k separate sha2_256 instances, eight messages at a time
+
+class sha2_256_x8: public detail::multi_buffer<detail::sha2_256_x8_kernel>
+{
+};
+
+// sha2_224_x8::hash( k, p, n, r ) computes the same digests as
+// k separate sha2_224 instances, eight messages at a time
+
+class sha2_224_x8: public detail::multi_buffer<detail::sha2_224_x8_kernel>
+{
+};
+
+} // namespace hash2
+} // namespace boost
+
+#endif // #ifndef BOOST_HASH2_MULTI_BUFFER_HPP_INCLUDED
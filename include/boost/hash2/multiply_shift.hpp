@@ -0,0 +1,100 @@
+#ifndef BOOST_HASH2_MULTIPLY_SHIFT_HPP_INCLUDED
+#define BOOST_HASH2_MULTIPLY_SHIFT_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// Multiply-shift hashing of 64 bit keys, https://arxiv.org/abs/1504.06804
+
+#include <boost/hash2/detail/integer_hash.hpp>
+#include <boost/hash2/detail/mul128.hpp>
+#include <boost/config.hpp>
+#include <cstdint>
+#include <cstddef>
+
+namespace boost
+{
+namespace hash2
+{
+
+// The high 64 bits of a x mod 2^128, for a random odd 128 bit a, which
+// is universal up to a factor of two: two distinct keys collide with
+// probability at most 2^-63.
+//
+// operator()( x ) hashes a single key directly; update() and result()
+// hash arbitrary input as described in detail/integer_hash.hpp
+
+class multiply_shift_64: public detail::integer_hash_base<multiply_shift_64>
+{
+private:
+
+    std::uint64_t a0_, a1_; // low, high
+
+    void init( std::uint64_t seed )
+    {
+        a0_ = detail::splitmix64( seed ) | 1;
+        a1_ = detail::splitmix64( seed );
+    }
+
+public:
+
+    explicit multiply_shift_64( std::uint64_t seed = 0 )
+    {
+        init( seed );
+    }
+
+    multiply_shift_64( unsigned char const * p, std::size_t n )
+    {
+        init( detail::integer_hash_seed( p, n ) );
+    }
+
+    BOOST_FORCEINLINE std::uint64_t operator()( std::uint64_t x ) const
+    {
+        return detail::mul128( a0_, x ).high + a1_ * x;
+    }
+};
+
+// The high 64 bits of a x + b mod 2^128, for random 128 bit a and b,
+// which is strongly universal (2-independent)
+
+class multiply_add_shift_64: public detail::integer_hash_base<multiply_add_shift_64>
+{
+private:
+
+    std::uint64_t a0_, a1_, b0_, b1_; // low, high
+
+    void init( std::uint64_t seed )
+    {
+        a0_ = detail::splitmix64( seed );
+        a1_ = detail::splitmix64( seed );
+        b0_ = detail::splitmix64( seed );
+        b1_ = detail::splitmix64( seed );
+    }
+
+public:
+
+    explicit multiply_add_shift_64( std::uint64_t seed = 0 )
+    {
+        init( seed );
+    }
+
+    multiply_add_shift_64( unsigned char const * p, std::size_t n )
+    {
+        init( detail::integer_hash_seed( p, n ) );
+    }
+
+    BOOST_FORCEINLINE std::uint64_t operator()( std::uint64_t x ) const
+    {
+        detail::uint128 r = detail::mul128( a0_, x );
+
+        std::uint64_t low = r.low + b0_;
+
+        return r.high + a1_ * x + b1_ + ( low < b0_ );
+    }
+};
+
+} // namespace hash2
+} // namespace boost
+
+#endif // #ifndef BOOST_HASH2_MULTIPLY_SHIFT_HPP_INCLUDED
@@ -63,6 +63,51 @@ private:
         h_ = h;
     }
 
+    // the tail of m bytes at p, for a total input length of n
+
+    std::uint32_t finalize( unsigned char const * p, std::size_t m, std::size_t n ) const
+    {
+        // std::memset( buffer_ + m_, 0, 4 - m_ );
+        // std::uint32_t k = detail::read32le( buffer_ );
+
+        std::uint32_t k = 0;
+
+        switch( m )
+        {
+        case 1:
+
+            k = p[0];
+            break;
+
+        case 2:
+
+            k = p[0] + (p[1] << 8);
+            break;
+
+        case 3:
+
+            k = p[0] + (p[1] << 8) + (p[2] << 16);
+            break;
+        }
+
+        k *= c1;
+        k = detail::rotl( k, 15 );
+        k *= c2;
+
+        std::uint32_t h = h_;
+
+        h ^= k;
+        h ^= static_cast<std::uint32_t>( n );
+
+        h ^= h >> 16; 
+        h *= 0x85ebca6b; 
+        h ^= h >> 13; 
+        h *= 0xc2b2ae35; 
+        h ^= h >> 16; 
+
+        return h;
+    }
+
 public:
 
     typedef std::uint32_t result_type;
@@ -70,6 +115,8 @@ public:
 
     explicit murmur3_32( std::uint64_t seed = 0 ): m_( 0 ), n_( 0 )
     {
+        std::memset( buffer_, 0, 4 );
+
         h_ = static_cast<std::uint32_t>( seed );
 
         std::uint32_t k = static_cast<std::uint32_t>( seed >> 32 );
@@ -82,6 +129,8 @@ public:
 
     murmur3_32( unsigned char const * p, std::size_t n ): m_( 0 ), n_( 0 )
     {
+        std::memset( buffer_, 0, 4 );
+
         if( n == 0 )
         {
             h_ = 0;
@@ -160,47 +209,35 @@ public:
         BOOST_ASSERT( m_ == n_ % 4 );
     }
 
-    std::uint32_t result()
+    // update( p, N ), with the length known at compile time
+
+    template<std::size_t N> void update_fixed( unsigned char const * p )
     {
         BOOST_ASSERT( m_ == n_ % 4 );
 
-        // std::memset( buffer_ + m_, 0, 4 - m_ );
-        // std::uint32_t k = detail::read32le( buffer_ );
-
-        std::uint32_t k = 0;
-
-        switch( m_ )
+        if( N % 4 == 0 && m_ == 0 )
         {
-        case 1:
-
-            k = buffer_[0];
-            break;
-
-        case 2:
-
-            k = buffer_[0] + (buffer_[1] << 8);
-            break;
-
-        case 3:
-
-            k = buffer_[0] + (buffer_[1] << 8) + (buffer_[2] << 16);
-            break;
+            update_( p, N / 4 );
+            n_ += N;
         }
+        else if( N < 4 && m_ < 4 - N )
+        {
+            std::memcpy( buffer_ + m_, p, N );
 
-        k *= c1;
-        k = detail::rotl( k, 15 );
-        k *= c2;
+            m_ += N;
+            n_ += N;
+        }
+        else
+        {
+            update( p, N );
+        }
+    }
 
-        std::uint32_t h = h_;
+    std::uint32_t result()
+    {
+        BOOST_ASSERT( m_ == n_ % 4 );
 
-        h ^= k;
-        h ^= static_cast<std::uint32_t>( n_ );
-
-        h ^= h >> 16; 
-        h *= 0x85ebca6b; 
-        h ^= h >> 13; 
-        h *= 0xc2b2ae35; 
-        h ^= h >> 16; 
+        std::uint32_t h = finalize( buffer_, m_, n_ );
 
         n_ += 4 - m_;
         m_ = 0;
@@ -210,6 +247,21 @@ public:
 
         return h;
     }
+
+    // hashes p[0..n) directly, without buffering; the result is the
+    // same as that of update( p, n ) and result() on murmur3_32( seed )
+
+    static std::uint32_t hash( void const * pv, std::size_t n, std::uint64_t seed = 0 )
+    {
+        unsigned char const* p = static_cast<unsigned char const*>( pv );
+
+        murmur3_32 h( seed );
+
+        std::size_t k = n / 4;
+        h.update_( p, k );
+
+        return h.finalize( p + 4 * k, n % 4, n );
+    }
 };
 
 class murmur3_128
@@ -267,6 +319,49 @@ public:
     typedef std::array<unsigned char, 16> result_type;
     typedef std::uint64_t size_type;
 
+private:
+
+    // the tail of m bytes at p, for a total input length of n
+
+    result_type finalize( unsigned char const * p, std::size_t m, std::size_t n ) const
+    {
+        unsigned char q[ 16 ] = {};
+
+        if( m > 0 )
+        {
+            std::memcpy( q, p, m );
+        }
+
+        std::uint64_t h1 = h1_, h2 = h2_;
+
+        std::uint64_t k1 = detail::read64le( q + 0 );
+        std::uint64_t k2 = detail::read64le( q + 8 );
+
+        k1 *= c1; k1 = detail::rotl( k1, 31 ); k1 *= c2; h1 ^= k1;
+        k2 *= c2; k2 = detail::rotl( k2, 33 ); k2 *= c1; h2 ^= k2;
+
+        h1 ^= n;
+        h2 ^= n;
+
+        h1 += h2;
+        h2 += h1;
+
+        h1 = fmix( h1 );
+        h2 = fmix( h2 );
+
+        h1 += h2;
+        h2 += h1;
+
+        result_type r;
+
+        detail::write64le( &r[ 0 ], h1 );
+        detail::write64le( &r[ 8 ], h2 );
+
+        return r;
+    }
+
+public:
+
     explicit murmur3_128( std::uint64_t seed = 0 ): m_( 0 ), n_( 0 )
     {
         h1_ = seed;
@@ -368,31 +463,30 @@ public:
         BOOST_ASSERT( m_ == n_ % 16 );
     }
 
-    result_type result()
+    // update( p, N ), with the length known at compile time
+
+    template<std::size_t N> void update_fixed( unsigned char const * p )
     {
         BOOST_ASSERT( m_ == n_ % 16 );
 
-        std::memset( buffer_ + m_, 0, 16 - m_ );
-
-        std::uint64_t h1 = h1_, h2 = h2_;
-
-        std::uint64_t k1 = detail::read64le( buffer_ + 0 );
-        std::uint64_t k2 = detail::read64le( buffer_ + 8 );
-
-        k1 *= c1; k1 = detail::rotl( k1, 31 ); k1 *= c2; h1 ^= k1;
-        k2 *= c2; k2 = detail::rotl( k2, 33 ); k2 *= c1; h2 ^= k2;
-
-        h1 ^= n_;
-        h2 ^= n_;
+        if( N < 16 && m_ < 16 - N )
+        {
+            std::memcpy( buffer_ + m_, p, N );
 
-        h1 += h2;
-        h2 += h1;
+            m_ += N;
+            n_ += N;
+        }
+        else
+        {
+            update( p, N );
+        }
+    }
 
-        h1 = fmix( h1 );
-        h2 = fmix( h2 );
+    result_type result()
+    {
+        BOOST_ASSERT( m_ == n_ % 16 );
 
-        h1 += h2;
-        h2 += h1;
+        result_type r = finalize( buffer_, m_, n_ );
 
         n_ += 16 - m_;
         m_ = 0;
@@ -400,12 +494,22 @@ public:
         // clear buffered plaintext
         std::memset( buffer_, 0, 16 );
 
-        result_type r;
+        return r;
+    }
 
-        detail::write64le( &r[ 0 ], h1 );
-        detail::write64le( &r[ 8 ], h2 );
+    // hashes p[0..n) directly, without buffering; the result is the
+    // same as that of update( p, n ) and result() on murmur3_128( seed )
 
-        return r;
+    static result_type hash( void const * pv, std::size_t n, std::uint64_t seed = 0 )
+    {
+        unsigned char const* p = static_cast<unsigned char const*>( pv );
+
+        murmur3_128 h( seed );
+
+        std::size_t k = n / 16;
+        h.update_( p, k );
+
+        return h.finalize( p + 16 * k, n % 16, n );
     }
 };
 
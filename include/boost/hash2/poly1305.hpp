@@ -0,0 +1,572 @@
+#ifndef BOOST_HASH2_POLY1305_HPP_INCLUDED
+#define BOOST_HASH2_POLY1305_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// Poly1305, https://tools.ietf.org/html/rfc8439
+
+#include <boost/hash2/detail/config.hpp>
+#include <boost/hash2/detail/intrin.hpp>
+#include <boost/hash2/detail/read.hpp>
+#include <boost/hash2/detail/write.hpp>
+#include <boost/hash2/detail/mul128.hpp>
+#include <boost/assert.hpp>
+#include <cstdint>
+#include <array>
+#include <cstring>
+#include <cstddef>
+
+namespace boost
+{
+namespace hash2
+{
+
+// Poly1305 is a one-time authenticator; a 32 byte seed is its key
+// (r, s), as in RFC 8439. Seeds of other lengths, and integral seeds,
+// are expanded into a key, for use as an ordinary seeded hash.
+//
+// The accumulator is kept in radix 2^44, in three limbs. With AVX-512
+// IFMA, long inputs are evaluated eight blocks at a time, one block per
+// 64 bit lane, using the powers r^1 .. r^8.
+
+class poly1305
+{
+private:
+
+    static const std::size_t N = 16;
+
+    static const std::uint64_t M44 = 0xFFFFFFFFFFFull;
+    static const std::uint64_t M42 = 0x3FFFFFFFFFFull;
+
+    std::uint64_t h_[ 3 ];
+
+    // r^1 .. r^8; only rn_[ 0 ] is computed on construction,
+    // the rest on first use
+    std::uint64_t rn_[ 8 ][ 3 ];
+    std::size_t k_; // number of computed powers of r
+
+    std::uint64_t pad_[ 2 ];
+
+    unsigned char buffer_[ N ];
+    std::size_t m_; // == n % 16
+
+private:
+
+#if defined(BOOST_HAS_INT128)
+
+    __extension__ typedef unsigned __int128 uint128_t;
+
+    static BOOST_FORCEINLINE uint128_t mul128( std::uint64_t x, std::uint64_t y )
+    {
+        return static_cast<uint128_t>( x ) * y;
+    }
+
+    static BOOST_FORCEINLINE void add( uint128_t & x, uint128_t y )
+    {
+        x += y;
+    }
+
+    static BOOST_FORCEINLINE std::uint64_t low( uint128_t x )
+    {
+        return static_cast<std::uint64_t>( x );
+    }
+
+    static BOOST_FORCEINLINE std::uint64_t shr( uint128_t x, int k )
+    {
+        return static_cast<std::uint64_t>( x >> k );
+    }
+
+#else
+
+    typedef detail::uint128 uint128_t;
+
+    static BOOST_FORCEINLINE uint128_t mul128( std::uint64_t x, std::uint64_t y )
+    {
+        return detail::mul128( x, y );
+    }
+
+    static BOOST_FORCEINLINE void add( uint128_t & x, uint128_t y )
+    {
+        x.low += y.low;
+        x.high += y.high + ( x.low < y.low );
+    }
+
+    static BOOST_FORCEINLINE void add( uint128_t & x, std::uint64_t y )
+    {
+        x.low += y;
+        x.high += ( x.low < y );
+    }
+
+    static BOOST_FORCEINLINE std::uint64_t low( uint128_t x )
+    {
+        return x.low;
+    }
+
+    static BOOST_FORCEINLINE std::uint64_t shr( uint128_t x, int k )
+    {
+        return ( x.low >> k ) | ( x.high << ( 64 - k ) );
+    }
+
+#endif
+
+    // h = h * r, partially reduced
+
+    static BOOST_FORCEINLINE void mul( std::uint64_t * h, std::uint64_t const * r )
+    {
+        std::uint64_t const r0 = r[ 0 ], r1 = r[ 1 ], r2 = r[ 2 ];
+
+        // 2^132 = 20 (mod 2^130 - 5)
+        std::uint64_t const s1 = r1 * 20, s2 = r2 * 20;
+
+        std::uint64_t const h0 = h[ 0 ], h1 = h[ 1 ], h2 = h[ 2 ];
+
+        uint128_t d0 = mul128( h0, r0 );
+        add( d0, mul128( h1, s2 ) );
+        add( d0, mul128( h2, s1 ) );
+
+        uint128_t d1 = mul128( h0, r1 );
+        add( d1, mul128( h1, r0 ) );
+        add( d1, mul128( h2, s2 ) );
+
+        uint128_t d2 = mul128( h0, r2 );
+        add( d2, mul128( h1, r1 ) );
+        add( d2, mul128( h2, r0 ) );
+
+        std::uint64_t c;
+
+        c = shr( d0, 44 ); h[ 0 ] = low( d0 ) & M44;
+        add( d1, c );
+        c = shr( d1, 44 ); h[ 1 ] = low( d1 ) & M44;
+        add( d2, c );
+        c = shr( d2, 42 ); h[ 2 ] = low( d2 ) & M42;
+
+        h[ 0 ] += c * 5;
+        c = h[ 0 ] >> 44; h[ 0 ] &= M44;
+        h[ 1 ] += c;
+    }
+
+    // hibit is 2^128 (1 << 40 in the top limb) for full blocks
+
+    static BOOST_FORCEINLINE void add_block( std::uint64_t * h, unsigned char const * p, std::uint64_t hibit )
+    {
+        std::uint64_t const t0 = detail::read64le( p + 0 );
+        std::uint64_t const t1 = detail::read64le( p + 8 );
+
+        h[ 0 ] += t0 & M44;
+        h[ 1 ] += ( ( t0 >> 44 ) | ( t1 << 20 ) ) & M44;
+        h[ 2 ] += ( ( t1 >> 24 ) & M42 ) | hibit;
+    }
+
+    void process_( unsigned char const * p, std::size_t k )
+    {
+        std::uint64_t h[ 3 ] = { h_[ 0 ], h_[ 1 ], h_[ 2 ] };
+        std::uint64_t const r[ 3 ] = { rn_[ 0 ][ 0 ], rn_[ 0 ][ 1 ], rn_[ 0 ][ 2 ] };
+
+        for( std::size_t i = 0; i < k; ++i, p += N )
+        {
+            add_block( h, p, 1ull << 40 );
+            mul( h, r );
+        }
+
+        h_[ 0 ] = h[ 0 ];
+        h_[ 1 ] = h[ 1 ];
+        h_[ 2 ] = h[ 2 ];
+    }
+
+#if defined(BOOST_HASH2_HAS_AVX512IFMA)
+
+    void compute_powers()
+    {
+        for( int i = 1; i < 8; ++i )
+        {
+            std::memcpy( rn_[ i ], rn_[ i - 1 ], sizeof( rn_[ i ] ) );
+            mul( rn_[ i ], rn_[ 0 ] );
+        }
+
+        k_ = 8;
+    }
+
+    // h = h * r, per lane, with the products split into their low
+    // and high 52 bits by vpmadd52luq and vpmadd52huq
+
+    static BOOST_FORCEINLINE void mul8( __m512i & h0, __m512i & h1, __m512i & h2, __m512i r0, __m512i r1, __m512i r2 )
+    {
+        __m512i const z = _mm512_setzero_si512();
+
+        __m512i const s1 = _mm512_add_epi64( _mm512_slli_epi64( r1, 4 ), _mm512_slli_epi64( r1, 2 ) );
+        __m512i const s2 = _mm512_add_epi64( _mm512_slli_epi64( r2, 4 ), _mm512_slli_epi64( r2, 2 ) );
+
+        __m512i d0 = _mm512_madd52lo_epu64( z, h0, r0 );
+        __m512i d1 = _mm512_madd52lo_epu64( z, h0, r1 );
+        __m512i d2 = _mm512_madd52lo_epu64( z, h0, r2 );
+
+        __m512i e0 = _mm512_madd52hi_epu64( z, h0, r0 );
+        __m512i e1 = _mm512_madd52hi_epu64( z, h0, r1 );
+        __m512i e2 = _mm512_madd52hi_epu64( z, h0, r2 );
+
+        d0 = _mm512_madd52lo_epu64( d0, h1, s2 );
+        d1 = _mm512_madd52lo_epu64( d1, h1, r0 );
+        d2 = _mm512_madd52lo_epu64( d2, h1, r1 );
+
+        e0 = _mm512_madd52hi_epu64( e0, h1, s2 );
+        e1 = _mm512_madd52hi_epu64( e1, h1, r0 );
+        e2 = _mm512_madd52hi_epu64( e2, h1, r1 );
+
+        d0 = _mm512_madd52lo_epu64( d0, h2, s1 );
+        d1 = _mm512_madd52lo_epu64( d1, h2, s2 );
+        d2 = _mm512_madd52lo_epu64( d2, h2, r0 );
+
+        e0 = _mm512_madd52hi_epu64( e0, h2, s1 );
+        e1 = _mm512_madd52hi_epu64( e1, h2, s2 );
+        e2 = _mm512_madd52hi_epu64( e2, h2, r0 );
+
+        // the high halves are 2^52 = 2^8 * 2^44 times the
+        // next limb; the one past the top limb wraps with 20
+
+        __m512i const m44 = _mm512_set1_epi64( M44 );
+        __m512i const m42 = _mm512_set1_epi64( M42 );
+
+        d1 = _mm512_add_epi64( d1, _mm512_slli_epi64( e0, 8 ) );
+        d2 = _mm512_add_epi64( d2, _mm512_slli_epi64( e1, 8 ) );
+        d0 = _mm512_add_epi64( d0, _mm512_add_epi64( _mm512_slli_epi64( e2, 12 ), _mm512_slli_epi64( e2, 10 ) ) );
+
+        __m512i c;
+
+        c = _mm512_srli_epi64( d0, 44 ); d0 = _mm512_and_si512( d0, m44 );
+        d1 = _mm512_add_epi64( d1, c );
+        c = _mm512_srli_epi64( d1, 44 ); d1 = _mm512_and_si512( d1, m44 );
+        d2 = _mm512_add_epi64( d2, c );
+        c = _mm512_srli_epi64( d2, 42 ); d2 = _mm512_and_si512( d2, m42 );
+
+        d0 = _mm512_add_epi64( d0, _mm512_add_epi64( c, _mm512_slli_epi64( c, 2 ) ) );
+        c = _mm512_srli_epi64( d0, 44 ); d0 = _mm512_and_si512( d0, m44 );
+        d1 = _mm512_add_epi64( d1, c );
+
+        h0 = d0;
+        h1 = d1;
+        h2 = d2;
+    }
+
+    // k is a multiple of 8; lane j accumulates the blocks j, j + 8, ...
+    // multiplying by r^8 between them, and by r^(8-j) after the last
+
+    void process8( unsigned char const * p, std::size_t k )
+    {
+        BOOST_ASSERT( k >= 8 && k % 8 == 0 );
+
+        if( k_ < 8 )
+        {
+            compute_powers();
+        }
+
+        __m512i const r80 = _mm512_set1_epi64( rn_[ 7 ][ 0 ] );
+        __m512i const r81 = _mm512_set1_epi64( rn_[ 7 ][ 1 ] );
+        __m512i const r82 = _mm512_set1_epi64( rn_[ 7 ][ 2 ] );
+
+        __m512i const m44 = _mm512_set1_epi64( M44 );
+        __m512i const hibit = _mm512_set1_epi64( 1ll << 40 );
+
+        __m512i const i0 = _mm512_set_epi64( 14, 12, 10, 8, 6, 4, 2, 0 );
+        __m512i const i1 = _mm512_set_epi64( 15, 13, 11, 9, 7, 5, 3, 1 );
+
+        __m512i h0 = _mm512_set_epi64( 0, 0, 0, 0, 0, 0, 0, static_cast<long long>( h_[ 0 ] ) );
+        __m512i h1 = _mm512_set_epi64( 0, 0, 0, 0, 0, 0, 0, static_cast<long long>( h_[ 1 ] ) );
+        __m512i h2 = _mm512_set_epi64( 0, 0, 0, 0, 0, 0, 0, static_cast<long long>( h_[ 2 ] ) );
+
+        for( std::size_t i = 0; i < k; i += 8, p += 8 * N )
+        {
+            __m512i a = _mm512_loadu_si512( p );
+            __m512i b = _mm512_loadu_si512( p + 64 );
+
+            __m512i t0 = _mm512_permutex2var_epi64( a, i0, b );
+            __m512i t1 = _mm512_permutex2var_epi64( a, i1, b );
+
+            h0 = _mm512_add_epi64( h0, _mm512_and_si512( t0, m44 ) );
+            h1 = _mm512_add_epi64( h1, _mm512_and_si512( _mm512_or_si512( _mm512_srli_epi64( t0, 44 ), _mm512_slli_epi64( t1, 20 ) ), m44 ) );
+            h2 = _mm512_add_epi64( h2, _mm512_or_si512( _mm512_srli_epi64( t1, 24 ), hibit ) );
+
+            if( i + 8 < k )
+            {
+                mul8( h0, h1, h2, r80, r81, r82 );
+            }
+            else
+            {
+                __m512i const r0 = _mm512_set_epi64(
+                    rn_[ 0 ][ 0 ], rn_[ 1 ][ 0 ], rn_[ 2 ][ 0 ], rn_[ 3 ][ 0 ], rn_[ 4 ][ 0 ], rn_[ 5 ][ 0 ], rn_[ 6 ][ 0 ], rn_[ 7 ][ 0 ] );
+
+                __m512i const r1 = _mm512_set_epi64(
+                    rn_[ 0 ][ 1 ], rn_[ 1 ][ 1 ], rn_[ 2 ][ 1 ], rn_[ 3 ][ 1 ], rn_[ 4 ][ 1 ], rn_[ 5 ][ 1 ], rn_[ 6 ][ 1 ], rn_[ 7 ][ 1 ] );
+
+                __m512i const r2 = _mm512_set_epi64(
+                    rn_[ 0 ][ 2 ], rn_[ 1 ][ 2 ], rn_[ 2 ][ 2 ], rn_[ 3 ][ 2 ], rn_[ 4 ][ 2 ], rn_[ 5 ][ 2 ], rn_[ 6 ][ 2 ], rn_[ 7 ][ 2 ] );
+
+                mul8( h0, h1, h2, r0, r1, r2 );
+            }
+        }
+
+        std::uint64_t s0 = _mm512_reduce_add_epi64( h0 );
+        std::uint64_t s1 = _mm512_reduce_add_epi64( h1 );
+        std::uint64_t s2 = _mm512_reduce_add_epi64( h2 );
+
+        std::uint64_t c;
+
+        c = s0 >> 44; s0 &= M44;
+        s1 += c;
+        c = s1 >> 44; s1 &= M44;
+        s2 += c;
+        c = s2 >> 42; s2 &= M42;
+        s0 += c * 5;
+        c = s0 >> 44; s0 &= M44;
+        s1 += c;
+
+        h_[ 0 ] = s0;
+        h_[ 1 ] = s1;
+        h_[ 2 ] = s2;
+    }
+
+    void process( unsigned char const * p, std::size_t k )
+    {
+        if( k >= 16 )
+        {
+            std::size_t k2 = k & ~static_cast<std::size_t>( 7 );
+
+            process8( p, k2 );
+
+            p += k2 * N;
+            k -= k2;
+        }
+
+        process_( p, k );
+    }
+
+#else
+
+    void process( unsigned char const * p, std::size_t k )
+    {
+        process_( p, k );
+    }
+
+#endif
+
+    void init_key( unsigned char const * key )
+    {
+        std::uint64_t const t0 = detail::read64le( key + 0 );
+        std::uint64_t const t1 = detail::read64le( key + 8 );
+
+        // clamped r
+        rn_[ 0 ][ 0 ] = t0 & 0xFFC0FFFFFFFull;
+        rn_[ 0 ][ 1 ] = ( ( t0 >> 44 ) | ( t1 << 20 ) ) & 0xFFFFFC0FFFFull;
+        rn_[ 0 ][ 2 ] = ( t1 >> 24 ) & 0x00FFFFFFC0Full;
+
+        k_ = 1;
+
+        pad_[ 0 ] = detail::read64le( key + 16 );
+        pad_[ 1 ] = detail::read64le( key + 24 );
+
+        h_[ 0 ] = h_[ 1 ] = h_[ 2 ] = 0;
+
+        std::memset( buffer_, 0, N );
+        m_ = 0;
+    }
+
+    // expands a seed into a key, by hashing it with two fixed keys
+
+    void init( unsigned char const * p, std::size_t n )
+    {
+        static const std::uint64_t K[ 8 ] =
+        {
+            0x243F6A8885A308D3ull, 0x13198A2E03707344ull, 0xA4093822299F31D0ull, 0x082EFA98EC4E6C89ull,
+            0x452821E638D01377ull, 0xBE5466CF34E90C6Cull, 0xC0AC29B7C97C50DDull, 0x3F84D5B5B5470917ull,
+        };
+
+        unsigned char key[ 32 ];
+        unsigned char q[ 32 ];
+
+        for( int i = 0; i < 4; ++i )
+        {
+            detail::write64le( key + 8 * i, K[ i ] );
+        }
+
+        init_key( key );
+        update( p, n );
+        finalize( q );
+
+        for( int i = 0; i < 4; ++i )
+        {
+            detail::write64le( key + 8 * i, K[ 4 + i ] );
+        }
+
+        init_key( key );
+        update( p, n );
+        finalize( q + 16 );
+
+        init_key( q );
+    }
+
+    void init( std::uint64_t seed )
+    {
+        unsigned char q[ 8 ];
+        detail::write64le( q, seed );
+
+        init( q, 8 );
+    }
+
+    // processes the final partial block, if any, and
+    // stores the tag (h + s) mod 2^128 in r
+
+    void finalize( unsigned char * r )
+    {
+        if( m_ > 0 )
+        {
+            buffer_[ m_ ] = 1;
+
+            add_block( h_, buffer_, 0 );
+            mul( h_, rn_[ 0 ] );
+
+            m_ = 0;
+
+            // clear buffered plaintext
+            std::memset( buffer_, 0, N );
+        }
+
+        std::uint64_t h0 = h_[ 0 ], h1 = h_[ 1 ], h2 = h_[ 2 ];
+        std::uint64_t c;
+
+        // fully carry h
+
+        c = h1 >> 44; h1 &= M44;
+        h2 += c; c = h2 >> 42; h2 &= M42;
+        h0 += c * 5; c = h0 >> 44; h0 &= M44;
+        h1 += c; c = h1 >> 44; h1 &= M44;
+        h2 += c; c = h2 >> 42; h2 &= M42;
+        h0 += c * 5; c = h0 >> 44; h0 &= M44;
+        h1 += c;
+
+        // g = h - p = h + 5 - 2^130
+
+        std::uint64_t g0 = h0 + 5; c = g0 >> 44; g0 &= M44;
+        std::uint64_t g1 = h1 + c; c = g1 >> 44; g1 &= M44;
+        std::uint64_t g2 = h2 + c - ( 1ull << 42 );
+
+        // select h if g < 0, g otherwise
+
+        c = ( g2 >> 63 ) - 1;
+
+        h0 = ( h0 & ~c ) | ( g0 & c );
+        h1 = ( h1 & ~c ) | ( g1 & c );
+        h2 = ( h2 & ~c ) | ( g2 & c & M42 );
+
+        h_[ 0 ] = h0;
+        h_[ 1 ] = h1;
+        h_[ 2 ] = h2;
+
+        // h + s
+
+        std::uint64_t const t0 = pad_[ 0 ], t1 = pad_[ 1 ];
+
+        h0 += t0 & M44; c = h0 >> 44; h0 &= M44;
+        h1 += ( ( ( t0 >> 44 ) | ( t1 << 20 ) ) & M44 ) + c; c = h1 >> 44; h1 &= M44;
+        h2 += ( t1 >> 24 ) + c;
+
+        detail::write64le( r + 0, h0 | ( h1 << 44 ) );
+        detail::write64le( r + 8, ( h1 >> 20 ) | ( h2 << 24 ) );
+    }
+
+public:
+
+    typedef std::array<unsigned char, 16> result_type;
+    typedef std::uint64_t size_type;
+
+    explicit poly1305( std::uint64_t seed = 0 )
+    {
+        init( seed );
+    }
+
+    poly1305( unsigned char const * p, std::size_t n )
+    {
+        if( n == 0 )
+        {
+            init( 0 );
+        }
+        else if( n == 32 )
+        {
+            init_key( p );
+        }
+        else
+        {
+            init( p, n );
+        }
+    }
+
+    void update( void const * pv, std::size_t n )
+    {
+        unsigned char const* p = static_cast<unsigned char const*>( pv );
+
+        if( n == 0 ) return;
+
+        if( m_ > 0 )
+        {
+            std::size_t k = N - m_;
+
+            if( n < k )
+            {
+                k = n;
+            }
+
+            std::memcpy( buffer_ + m_, p, k );
+
+            p += k;
+            n -= k;
+            m_ += k;
+
+            if( m_ < N ) return;
+
+            BOOST_ASSERT( m_ == N );
+
+            process_( buffer_, 1 );
+            m_ = 0;
+
+            // clear buffered plaintext
+            std::memset( buffer_, 0, N );
+        }
+
+        BOOST_ASSERT( m_ == 0 );
+
+        if( n >= N )
+        {
+            std::size_t k = n / N;
+
+            process( p, k );
+
+            p += k * N;
+            n -= k * N;
+        }
+
+        BOOST_ASSERT( n < N );
+
+        if( n > 0 )
+        {
+            std::memcpy( buffer_, p, n );
+            m_ = n;
+        }
+    }
+
+    result_type result()
+    {
+        result_type r;
+        finalize( &r[ 0 ] );
+
+        // absorb the tag as a block, so that the
+        // next result() returns a different value
+        process_( &r[ 0 ], 1 );
+
+        return r;
+    }
+};
+
+} // namespace hash2
+} // namespace boost
+
+#endif // #ifndef BOOST_HASH2_POLY1305_HPP_INCLUDED
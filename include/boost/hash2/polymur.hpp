@@ -0,0 +1,444 @@
+#ifndef BOOST_HASH2_POLYMUR_HPP_INCLUDED
+#define BOOST_HASH2_POLYMUR_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// A polymur-style hash, after PolymurHash by Orson Peters,
+// https://github.com/orlp/polymur-hash. It follows the design of
+// version 2.0, but hasn't been checked against that implementation
+// and isn't claimed to give the same results.
+//
+// A polynomial hash modulo 2^61-1, evaluated at a secret point k
+// derived from the seed; for two distinct inputs of at most n bytes,
+// the probability of a collision over the choice of the seed is at
+// most n * 2^-60.2
+
+#include <boost/hash2/detail/read.hpp>
+#include <boost/hash2/detail/mul128.hpp>
+#include <boost/assert.hpp>
+#include <cstdint>
+#include <cstring>
+#include <cstddef>
+
+namespace boost
+{
+namespace hash2
+{
+
+class polymur_64
+{
+private:
+
+    static const std::uint64_t P611 = ( 1ull << 61 ) - 1;
+
+    static const std::uint64_t A1 = 0x6a09e667f3bcc908ull;
+    static const std::uint64_t A2 = 0xbb67ae8584caa73bull;
+    static const std::uint64_t A3 = 0x3c6ef372fe94f82bull;
+    static const std::uint64_t A4 = 0xa54ff53a5f1d36f1ull;
+
+    static const std::uint64_t M56 = 0x00ffffffffffffffull;
+
+private:
+
+    // the key schedule, computed once by the seed constructors; k3r_
+    // and k4r_, k3_ and k4_ fully reduced, replace them for long inputs
+    std::uint64_t k_, k2_, k3_, k4_, k3r_, k4r_, k5_, k6_, k7_, k14_;
+    std::uint64_t s_;
+
+    std::uint64_t tweak_;
+    std::uint64_t h_;
+
+    // the tweak after construction, for hash()
+    std::uint64_t tweak0_;
+
+    // the unprocessed input; a 49 byte block is only processed once
+    // more input follows it, as the last block goes through the tail
+    // path. The extra byte allows eight byte loads of the seventh word
+    unsigned char buffer_[ 50 ];
+    std::size_t m_; // <= 49
+
+    std::uint64_t n_;
+
+private:
+
+#if defined(BOOST_HAS_INT128)
+
+    __extension__ typedef unsigned __int128 uint128_t;
+
+    static BOOST_FORCEINLINE uint128_t mul128( std::uint64_t x, std::uint64_t y )
+    {
+        return static_cast<uint128_t>( x ) * y;
+    }
+
+    static BOOST_FORCEINLINE uint128_t add128( uint128_t x, uint128_t y )
+    {
+        return x + y;
+    }
+
+    static BOOST_FORCEINLINE std::uint64_t red611( uint128_t x )
+    {
+        std::uint64_t const low = static_cast<std::uint64_t>( x );
+        std::uint64_t const high = static_cast<std::uint64_t>( x >> 64 );
+
+        return ( low & P611 ) + ( ( low >> 61 ) | ( high << 3 ) );
+    }
+
+#else
+
+    typedef detail::uint128 uint128_t;
+
+    static BOOST_FORCEINLINE uint128_t mul128( std::uint64_t x, std::uint64_t y )
+    {
+        return detail::mul128( x, y );
+    }
+
+    static BOOST_FORCEINLINE uint128_t add128( uint128_t x, uint128_t y )
+    {
+        uint128_t r;
+
+        r.low = x.low + y.low;
+        r.high = x.high + y.high + ( r.low < x.low );
+
+        return r;
+    }
+
+    static BOOST_FORCEINLINE std::uint64_t red611( uint128_t x )
+    {
+        return ( x.low & P611 ) + ( ( x.low >> 61 ) | ( x.high << 3 ) );
+    }
+
+#endif
+
+    static BOOST_FORCEINLINE std::uint64_t extrared611( std::uint64_t x )
+    {
+        return ( x & P611 ) + ( x >> 61 );
+    }
+
+    static std::uint64_t mulmod( std::uint64_t x, std::uint64_t y )
+    {
+        return extrared611( red611( mul128( x, y ) ) );
+    }
+
+    static std::uint64_t mix( std::uint64_t x )
+    {
+        x ^= x >> 32;
+        x *= 0xe9846af9b1a615dull;
+        x ^= x >> 32;
+        x *= 0xe9846af9b1a615dull;
+        x ^= x >> 28;
+
+        return x;
+    }
+
+    void init( std::uint64_t k_seed, std::uint64_t s_seed )
+    {
+        s_ = s_seed ^ A1;
+
+        // pow37[ i ] = 37^(2^i) mod 2^61-1
+
+        std::uint64_t pow37[ 64 ];
+
+        pow37[  0 ] = 37;
+        pow37[ 32 ] = 559096694736811184ull;
+
+        for( int i = 0; i < 31; ++i )
+        {
+            pow37[ i +  1 ] = mulmod( pow37[ i ], pow37[ i ] );
+            pow37[ i + 33 ] = mulmod( pow37[ i + 32 ], pow37[ i + 32 ] );
+        }
+
+        for( ;; )
+        {
+            // an exponent coprime to 2^61-2 makes 37^e another generator
+
+            k_seed += A2;
+
+            std::uint64_t e = ( k_seed >> 3 ) | 1;
+
+            if( e % 3 == 0 ) continue;
+            if( e % 5 == 0 || e % 7 == 0 ) continue;
+            if( e % 11 == 0 || e % 13 == 0 || e % 31 == 0 ) continue;
+            if( e % 41 == 0 || e % 61 == 0 || e % 151 == 0 || e % 331 == 0 || e % 1321 == 0 ) continue;
+
+            std::uint64_t ka = 1, kb = 1;
+
+            for( int i = 0; e; i += 2, e >>= 2 )
+            {
+                if( e & 1 ) ka = mulmod( ka, pow37[ i ] );
+                if( e & 2 ) kb = mulmod( kb, pow37[ i + 1 ] );
+            }
+
+            std::uint64_t k = extrared611( mulmod( ka, kb ) );
+
+            std::uint64_t k2 = mulmod( k, k );
+            std::uint64_t k3 = red611( mul128( k, k2 ) );
+            std::uint64_t k4 = red611( mul128( k2, k2 ) );
+            std::uint64_t k7 = mulmod( k3, k4 );
+
+            // the bound on k^7 keeps the sums in update_ from overflowing
+
+            if( k7 < ( 1ull << 60 ) - ( 1ull << 56 ) )
+            {
+                k_ = k;
+                k2_ = k2;
+                k3_ = k3;
+                k4_ = k4;
+                k3r_ = extrared611( k3 );
+                k4r_ = extrared611( k4 );
+                k5_ = mulmod( k, k4 );
+                k6_ = mulmod( k2, k4 );
+                k7_ = k7;
+                k14_ = red611( mul128( k7, k7 ) );
+
+                break;
+            }
+        }
+    }
+
+    void init( std::uint64_t seed )
+    {
+        init( mix( seed + A3 ), mix( seed + A4 ) );
+    }
+
+    void reset( std::uint64_t tweak )
+    {
+        tweak_ = tweak;
+        h_ = 0;
+
+        std::memset( buffer_, 0, 50 );
+        m_ = 0;
+
+        n_ = 0;
+    }
+
+    // p must be readable for 50 bytes
+
+    std::uint64_t update_( std::uint64_t h, unsigned char const * p ) const
+    {
+        std::uint64_t m0 = detail::read64le( p +  0 ) & M56;
+        std::uint64_t m1 = detail::read64le( p +  7 ) & M56;
+        std::uint64_t m2 = detail::read64le( p + 14 ) & M56;
+        std::uint64_t m3 = detail::read64le( p + 21 ) & M56;
+        std::uint64_t m4 = detail::read64le( p + 28 ) & M56;
+        std::uint64_t m5 = detail::read64le( p + 35 ) & M56;
+        std::uint64_t m6 = detail::read64le( p + 42 ) & M56;
+
+        uint128_t t0 = mul128( k_ + m0, k6_ + m1 );
+        uint128_t t1 = mul128( k2_ + m2, k5_ + m3 );
+        uint128_t t2 = mul128( k3r_ + m4, k4r_ + m5 );
+        uint128_t t3 = mul128( h + m6, k7_ );
+
+        return red611( add128( add128( t0, t1 ), add128( t2, t3 ) ) );
+    }
+
+    // the last n bytes at p, for a total input length of n0, with h0 the
+    // value accumulated over the preceding blocks. For n < 8, p must be
+    // readable for 8 bytes
+
+    std::uint64_t finalize( std::uint64_t tweak, std::uint64_t h0, unsigned char const * p, std::size_t n, std::uint64_t n0 ) const
+    {
+        std::uint64_t acc = tweak;
+
+        std::uint64_t k3 = k3_;
+        std::uint64_t k4 = k4_;
+
+        if( n0 > 49 )
+        {
+            acc += extrared611( red611( mul128( extrared611( h0 ), k14_ ) ) );
+
+            k3 = k3r_;
+            k4 = k4r_;
+        }
+
+        std::uint64_t h;
+
+        if( n >= 8 )
+        {
+            // the 7 byte words cover the input, overlapping as needed
+
+            std::uint64_t m0 = detail::read64le( p ) & M56;
+            std::uint64_t m1 = detail::read64le( p + ( n - 7 ) / 2 ) & M56;
+            std::uint64_t m2 = detail::read64le( p + n - 8 ) >> 8;
+
+            uint128_t t0 = mul128( k2_ + m0, k7_ + m1 );
+            uint128_t t1 = mul128( k_ + m2, k3 + n );
+
+            if( n <= 21 )
+            {
+                h = acc + red611( add128( t0, t1 ) );
+            }
+            else
+            {
+                std::uint64_t m3 = detail::read64le( p + 7 ) & M56;
+                std::uint64_t m4 = detail::read64le( p + 14 ) & M56;
+                std::uint64_t m5 = detail::read64le( p + n - 21 ) & M56;
+                std::uint64_t m6 = detail::read64le( p + n - 14 ) & M56;
+
+                uint128_t t2 = mul128( k2_ + m3, k7_ + m4 );
+                uint128_t t3 = mul128( red611( t0 ) + m5, k4 + m6 );
+
+                h = acc + red611( add128( add128( t1, t2 ), t3 ) );
+            }
+        }
+        else
+        {
+            // p is readable past the input
+
+            std::uint64_t m0 = detail::read64le( p ) & ( ( 1ull << ( n * 8 ) ) - 1 );
+
+            h = acc + red611( mul128( k_ + m0, k2_ + n ) );
+        }
+
+        return mix( h ) + s_;
+    }
+
+public:
+
+    typedef std::uint64_t result_type;
+    typedef std::uint64_t size_type;
+
+    explicit polymur_64( std::uint64_t seed = 0 )
+    {
+        init( seed );
+        reset( 0 );
+
+        tweak0_ = tweak_;
+    }
+
+    // a byte seed of up to 8 bytes is read as a little-endian integer;
+    // of a longer one, the first 16 bytes, zero padded, are the two seeds
+    // of the key schedule, and the rest are hashed into the tweak
+
+    polymur_64( unsigned char const * p, std::size_t n )
+    {
+        if( n == 0 )
+        {
+            init( 0 );
+            reset( 0 );
+        }
+        else if( n <= 8 )
+        {
+            unsigned char q[ 8 ] = {};
+            std::memcpy( q, p, n );
+
+            init( detail::read64le( q ) );
+            reset( 0 );
+        }
+        else
+        {
+            unsigned char q[ 16 ] = {};
+            std::memcpy( q, p, n < 16? n: 16 );
+
+            init( detail::read64le( q + 0 ), detail::read64le( q + 8 ) );
+            reset( 0 );
+
+            if( n > 16 )
+            {
+                update( p + 16, n - 16 );
+                result();
+            }
+        }
+
+        tweak0_ = tweak_;
+    }
+
+    void update( void const * pv, std::size_t n )
+    {
+        unsigned char const* p = static_cast<unsigned char const*>( pv );
+
+        if( n == 0 ) return;
+
+        n_ += n;
+
+        if( n <= 49 - m_ )
+        {
+            std::memcpy( buffer_ + m_, p, n );
+            m_ += n;
+
+            return;
+        }
+
+        if( m_ > 0 )
+        {
+            std::size_t k = 49 - m_;
+
+            std::memcpy( buffer_ + m_, p, k );
+
+            p += k;
+            n -= k;
+
+            BOOST_ASSERT( n > 0 );
+
+            h_ = update_( h_, buffer_ );
+            m_ = 0;
+        }
+
+        while( n > 49 )
+        {
+            h_ = update_( h_, p );
+
+            p += 49;
+            n -= 49;
+        }
+
+        BOOST_ASSERT( n > 0 && n <= 49 );
+
+        std::memcpy( buffer_, p, n );
+        m_ = n;
+    }
+
+    std::uint64_t result()
+    {
+        std::uint64_t h = finalize( tweak_, h_, buffer_, m_, n_ );
+
+        // restart with the result as the tweak; this also
+        // clears the buffered plaintext
+
+        reset( h );
+
+        return h;
+    }
+
+    // hashes p[0..n) directly, without buffering, using the key schedule
+    // of *this; the result is the same as that of update( p, n ) and
+    // result() on an object freshly constructed with the same seed. Unlike
+    // the other algorithms, this is not static, as computing the key
+    // schedule is expensive
+
+    std::uint64_t hash( void const * pv, std::size_t n ) const
+    {
+        unsigned char const* p = static_cast<unsigned char const*>( pv );
+
+        std::uint64_t h = 0;
+        std::size_t i = n;
+
+        while( i > 49 )
+        {
+            h = update_( h, p );
+
+            p += 49;
+            i -= 49;
+        }
+
+        if( i < 8 )
+        {
+            unsigned char q[ 8 ] = {};
+
+            if( i > 0 )
+            {
+                std::memcpy( q, p, i );
+            }
+
+            return finalize( tweak0_, h, q, i, n );
+        }
+
+        return finalize( tweak0_, h, p, i, n );
+    }
+};
+
+} // namespace hash2
+} // namespace boost
+
+#endif // #ifndef BOOST_HASH2_POLYMUR_HPP_INCLUDED
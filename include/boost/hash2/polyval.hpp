@@ -0,0 +1,561 @@
+#ifndef BOOST_HASH2_POLYVAL_HPP_INCLUDED
+#define BOOST_HASH2_POLYVAL_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// POLYVAL, https://tools.ietf.org/html/rfc8452
+// GHASH, https://csrc.nist.gov/pubs/sp/800/38/d/final
+
+#include <boost/hash2/detail/config.hpp>
+#include <boost/hash2/detail/intrin.hpp>
+#include <boost/hash2/detail/read.hpp>
+#include <boost/hash2/detail/write.hpp>
+#include <boost/assert.hpp>
+#include <cstdint>
+#include <array>
+#include <cstring>
+#include <cstddef>
+
+namespace boost
+{
+namespace hash2
+{
+
+namespace detail
+{
+
+// POLYVAL and GHASH are the same universal hash over GF(2^128), with
+// the bits of each block in opposite order; GHASH is computed as POLYVAL
+// on byte-reversed blocks, with the key multiplied by x (RFC 8452,
+// appendix A.)
+//
+// As in GCM and AES-GCM-SIV, the message is zero padded to a multiple
+// of 16 bytes and followed by a block holding its length in bits, in
+// the second half; so ghash computes the GHASH of GCM with no additional
+// data, and polyval that of AES-GCM-SIV.
+//
+// A 16 byte seed is the key H; a 32 byte seed is H followed by a mask
+// that is xor-ed into the result, which makes it a one-time MAC. Seeds
+// of other lengths, and integral seeds, are expanded into a key and a
+// mask, for use as an ordinary seeded hash.
+
+template<bool Ghash> class polyval_base
+{
+private:
+
+    static const std::size_t N = 16;
+
+    // the accumulator and the powers of the key H^1 .. H^4, as pairs
+    // of low and high 64 bit halves; the portable implementation only
+    // uses H^1
+
+    std::uint64_t acc_[ 2 ];
+    std::uint64_t hn_[ 4 ][ 2 ];
+
+    unsigned char mask_[ N ];
+
+    unsigned char buffer_[ N ];
+    std::size_t m_; // == n_ % 16
+
+    std::uint64_t n_;
+
+private:
+
+    static BOOST_FORCEINLINE void read_block( unsigned char const * p, std::uint64_t & lo, std::uint64_t & hi )
+    {
+        if( Ghash )
+        {
+            lo = detail::read64be( p + 8 );
+            hi = detail::read64be( p + 0 );
+        }
+        else
+        {
+            lo = detail::read64le( p + 0 );
+            hi = detail::read64le( p + 8 );
+        }
+    }
+
+    static BOOST_FORCEINLINE void write_block( unsigned char * p, std::uint64_t lo, std::uint64_t hi )
+    {
+        if( Ghash )
+        {
+            detail::write64be( p + 0, hi );
+            detail::write64be( p + 8, lo );
+        }
+        else
+        {
+            detail::write64le( p + 0, lo );
+            detail::write64le( p + 8, hi );
+        }
+    }
+
+#if defined(BOOST_HASH2_HAS_PCLMUL)
+
+    static BOOST_FORCEINLINE __m128i load_block( unsigned char const * p )
+    {
+        __m128i x = _mm_loadu_si128( reinterpret_cast<__m128i const*>( p ) );
+
+        if( Ghash )
+        {
+#if defined(BOOST_HASH2_HAS_SSSE3)
+
+            x = _mm_shuffle_epi8( x, _mm_set_epi64x( 0x0001020304050607ll, 0x08090A0B0C0D0E0Fll ) );
+
+#else
+
+            x = _mm_shuffle_epi32( x, _MM_SHUFFLE( 0, 1, 2, 3 ) );
+            x = _mm_or_si128( _mm_slli_epi32( x, 16 ), _mm_srli_epi32( x, 16 ) );
+            x = _mm_or_si128( _mm_slli_epi16( x, 8 ), _mm_srli_epi16( x, 8 ) );
+
+#endif
+        }
+
+        return x;
+    }
+
+    // the unreduced 256 bit product, as its low, middle and high parts
+
+    static BOOST_FORCEINLINE void mul_add( __m128i x, __m128i y, __m128i & lo, __m128i & mid, __m128i & hi )
+    {
+        lo = _mm_xor_si128( lo, _mm_clmulepi64_si128( x, y, 0x00 ) );
+        hi = _mm_xor_si128( hi, _mm_clmulepi64_si128( x, y, 0x11 ) );
+
+        mid = _mm_xor_si128( mid, _mm_clmulepi64_si128( x, y, 0x01 ) );
+        mid = _mm_xor_si128( mid, _mm_clmulepi64_si128( x, y, 0x10 ) );
+    }
+
+    // multiplies the product by x^-128, modulo x^128 + x^127 + x^126 + x^121 + 1
+
+    static BOOST_FORCEINLINE __m128i reduce( __m128i lo, __m128i mid, __m128i hi )
+    {
+        __m128i const poly = _mm_set_epi64x( static_cast<long long>( 0xC200000000000000ull ), 0 );
+
+        lo = _mm_xor_si128( lo, _mm_slli_si128( mid, 8 ) );
+        hi = _mm_xor_si128( hi, _mm_srli_si128( mid, 8 ) );
+
+        lo = _mm_xor_si128( _mm_shuffle_epi32( lo, _MM_SHUFFLE( 1, 0, 3, 2 ) ), _mm_clmulepi64_si128( lo, poly, 0x10 ) );
+        lo = _mm_xor_si128( _mm_shuffle_epi32( lo, _MM_SHUFFLE( 1, 0, 3, 2 ) ), _mm_clmulepi64_si128( lo, poly, 0x10 ) );
+
+        return _mm_xor_si128( lo, hi );
+    }
+
+    static BOOST_FORCEINLINE __m128i mul( __m128i x, __m128i y )
+    {
+        __m128i lo = _mm_setzero_si128(), mid = lo, hi = lo;
+        mul_add( x, y, lo, mid, hi );
+
+        return reduce( lo, mid, hi );
+    }
+
+    void compute_powers()
+    {
+        __m128i const h = _mm_loadu_si128( reinterpret_cast<__m128i const*>( hn_[ 0 ] ) );
+        __m128i x = h;
+
+        for( int i = 1; i < 4; ++i )
+        {
+            x = mul( x, h );
+            _mm_storeu_si128( reinterpret_cast<__m128i*>( hn_[ i ] ), x );
+        }
+    }
+
+    // four blocks are multiplied by H^4 .. H^1 and reduced once
+
+    void process( unsigned char const * p, std::size_t k )
+    {
+        __m128i const h1 = _mm_loadu_si128( reinterpret_cast<__m128i const*>( hn_[ 0 ] ) );
+        __m128i const h2 = _mm_loadu_si128( reinterpret_cast<__m128i const*>( hn_[ 1 ] ) );
+        __m128i const h3 = _mm_loadu_si128( reinterpret_cast<__m128i const*>( hn_[ 2 ] ) );
+        __m128i const h4 = _mm_loadu_si128( reinterpret_cast<__m128i const*>( hn_[ 3 ] ) );
+
+        __m128i acc = _mm_loadu_si128( reinterpret_cast<__m128i const*>( acc_ ) );
+
+        for( ; k >= 4; k -= 4, p += 4 * N )
+        {
+            __m128i lo = _mm_setzero_si128(), mid = lo, hi = lo;
+
+            mul_add( _mm_xor_si128( acc, load_block( p ) ), h4, lo, mid, hi );
+            mul_add( load_block( p + 16 ), h3, lo, mid, hi );
+            mul_add( load_block( p + 32 ), h2, lo, mid, hi );
+            mul_add( load_block( p + 48 ), h1, lo, mid, hi );
+
+            acc = reduce( lo, mid, hi );
+        }
+
+        for( ; k > 0; --k, p += N )
+        {
+            acc = mul( _mm_xor_si128( acc, load_block( p ) ), h1 );
+        }
+
+        _mm_storeu_si128( reinterpret_cast<__m128i*>( acc_ ), acc );
+    }
+
+#else
+
+    // the low half of the carry-less product, computed with integer
+    // multiplications in constant time; the "holes" of three zero bits
+    // between the used ones absorb the carries
+
+    static BOOST_FORCEINLINE std::uint64_t bmul64( std::uint64_t x, std::uint64_t y )
+    {
+        std::uint64_t const m1 = 0x1111111111111111ull;
+        std::uint64_t const m2 = 0x2222222222222222ull;
+        std::uint64_t const m4 = 0x4444444444444444ull;
+        std::uint64_t const m8 = 0x8888888888888888ull;
+
+        std::uint64_t const x0 = x & m1, x1 = x & m2, x2 = x & m4, x3 = x & m8;
+        std::uint64_t const y0 = y & m1, y1 = y & m2, y2 = y & m4, y3 = y & m8;
+
+        std::uint64_t z0 = ( x0 * y0 ) ^ ( x1 * y3 ) ^ ( x2 * y2 ) ^ ( x3 * y1 );
+        std::uint64_t z1 = ( x0 * y1 ) ^ ( x1 * y0 ) ^ ( x2 * y3 ) ^ ( x3 * y2 );
+        std::uint64_t z2 = ( x0 * y2 ) ^ ( x1 * y1 ) ^ ( x2 * y0 ) ^ ( x3 * y3 );
+        std::uint64_t z3 = ( x0 * y3 ) ^ ( x1 * y2 ) ^ ( x2 * y1 ) ^ ( x3 * y0 );
+
+        return ( z0 & m1 ) | ( z1 & m2 ) | ( z2 & m4 ) | ( z3 & m8 );
+    }
+
+    static BOOST_FORCEINLINE std::uint64_t rev64( std::uint64_t x )
+    {
+        x = ( ( x & 0x5555555555555555ull ) << 1 ) | ( ( x >> 1 ) & 0x5555555555555555ull );
+        x = ( ( x & 0x3333333333333333ull ) << 2 ) | ( ( x >> 2 ) & 0x3333333333333333ull );
+        x = ( ( x & 0x0F0F0F0F0F0F0F0Full ) << 4 ) | ( ( x >> 4 ) & 0x0F0F0F0F0F0F0F0Full );
+        x = ( ( x & 0x00FF00FF00FF00FFull ) << 8 ) | ( ( x >> 8 ) & 0x00FF00FF00FF00FFull );
+        x = ( ( x & 0x0000FFFF0000FFFFull ) << 16 ) | ( ( x >> 16 ) & 0x0000FFFF0000FFFFull );
+
+        return ( x << 32 ) | ( x >> 32 );
+    }
+
+    // x * y * x^-128; the high halves of the partial products are the
+    // low halves of the products of the bit-reversed operands, reversed,
+    // and the three partial products are combined as in Karatsuba
+
+    static BOOST_FORCEINLINE void mul( std::uint64_t & x0, std::uint64_t & x1, std::uint64_t y0, std::uint64_t y1, std::uint64_t y0r, std::uint64_t y1r )
+    {
+        std::uint64_t const y2 = y0 ^ y1;
+        std::uint64_t const y2r = y0r ^ y1r;
+
+        std::uint64_t const x2 = x0 ^ x1;
+
+        std::uint64_t const x0r = rev64( x0 );
+        std::uint64_t const x1r = rev64( x1 );
+        std::uint64_t const x2r = x0r ^ x1r;
+
+        std::uint64_t z0 = bmul64( x0, y0 );
+        std::uint64_t z1 = bmul64( x1, y1 );
+        std::uint64_t z2 = bmul64( x2, y2 );
+
+        std::uint64_t z0h = bmul64( x0r, y0r );
+        std::uint64_t z1h = bmul64( x1r, y1r );
+        std::uint64_t z2h = bmul64( x2r, y2r );
+
+        z2 ^= z0 ^ z1;
+        z2h ^= z0h ^ z1h;
+
+        z0h = rev64( z0h ) >> 1;
+        z1h = rev64( z1h ) >> 1;
+        z2h = rev64( z2h ) >> 1;
+
+        // the 256 bit product
+
+        std::uint64_t w0 = z0;
+        std::uint64_t w1 = z0h ^ z2;
+        std::uint64_t const w2 = z1 ^ z2h;
+        std::uint64_t const w3 = z1h;
+
+        // two steps of Montgomery reduction, each multiplying the low
+        // 64 bits by x^63 + x^62 + x^57, and shifting them out
+
+        for( int i = 0; i < 2; ++i )
+        {
+            std::uint64_t const t0 = w1 ^ ( w0 << 63 ) ^ ( w0 << 62 ) ^ ( w0 << 57 );
+            std::uint64_t const t1 = w0 ^ ( w0 >> 1 ) ^ ( w0 >> 2 ) ^ ( w0 >> 7 );
+
+            w0 = t0;
+            w1 = t1;
+        }
+
+        x0 = w0 ^ w2;
+        x1 = w1 ^ w3;
+    }
+
+    void compute_powers()
+    {
+    }
+
+    void process( unsigned char const * p, std::size_t k )
+    {
+        std::uint64_t const y0 = hn_[ 0 ][ 0 ];
+        std::uint64_t const y1 = hn_[ 0 ][ 1 ];
+
+        std::uint64_t const y0r = rev64( y0 );
+        std::uint64_t const y1r = rev64( y1 );
+
+        std::uint64_t x0 = acc_[ 0 ];
+        std::uint64_t x1 = acc_[ 1 ];
+
+        for( std::size_t i = 0; i < k; ++i, p += N )
+        {
+            std::uint64_t lo, hi;
+            read_block( p, lo, hi );
+
+            x0 ^= lo;
+            x1 ^= hi;
+
+            mul( x0, x1, y0, y1, y0r, y1r );
+        }
+
+        acc_[ 0 ] = x0;
+        acc_[ 1 ] = x1;
+    }
+
+#endif
+
+    // mask may be null
+
+    void init_key( unsigned char const * key, unsigned char const * mask )
+    {
+        std::uint64_t lo, hi;
+        read_block( key, lo, hi );
+
+        if( Ghash )
+        {
+            // multiply by x
+
+            std::uint64_t const c = hi >> 63;
+
+            hi = ( hi << 1 ) | ( lo >> 63 );
+            lo = lo << 1;
+
+            hi ^= ( 0 - c ) & 0xC200000000000000ull;
+            lo ^= c;
+        }
+
+        hn_[ 0 ][ 0 ] = lo;
+        hn_[ 0 ][ 1 ] = hi;
+
+        std::memset( hn_[ 1 ], 0, sizeof( hn_ ) - sizeof( hn_[ 0 ] ) );
+
+        compute_powers();
+
+        if( mask )
+        {
+            std::memcpy( mask_, mask, N );
+        }
+        else
+        {
+            std::memset( mask_, 0, N );
+        }
+
+        acc_[ 0 ] = acc_[ 1 ] = 0;
+
+        std::memset( buffer_, 0, N );
+        m_ = 0;
+
+        n_ = 0;
+    }
+
+    // expands a seed into a key and a mask, by hashing it with two fixed keys
+
+    void init( unsigned char const * p, std::size_t n )
+    {
+        static const std::uint64_t K[ 4 ] =
+        {
+            0x243F6A8885A308D3ull, 0x13198A2E03707344ull, 0xA4093822299F31D0ull, 0x082EFA98EC4E6C89ull,
+        };
+
+        unsigned char key[ N ];
+        unsigned char q[ 2 * N ];
+
+        for( int i = 0; i < 2; ++i )
+        {
+            detail::write64le( key + 0, K[ 2 * i + 0 ] );
+            detail::write64le( key + 8, K[ 2 * i + 1 ] );
+
+            init_key( key, 0 );
+            update( p, n );
+            finalize( q + N * i );
+        }
+
+        init_key( q, q + N );
+    }
+
+    void init( std::uint64_t seed )
+    {
+        unsigned char q[ 8 ];
+        detail::write64le( q, seed );
+
+        init( q, 8 );
+    }
+
+    // processes the final partial block, if any, zero padded,
+    // and the length block
+
+    void finalize( unsigned char * r )
+    {
+        if( m_ > 0 )
+        {
+            process( buffer_, 1 );
+            m_ = 0;
+
+            // clear buffered plaintext
+            std::memset( buffer_, 0, N );
+        }
+
+        unsigned char length[ N ] = {};
+
+        if( Ghash )
+        {
+            detail::write64be( length + 8, n_ * 8 );
+        }
+        else
+        {
+            detail::write64le( length + 8, n_ * 8 );
+        }
+
+        process( length, 1 );
+
+        write_block( r, acc_[ 0 ], acc_[ 1 ] );
+
+        for( std::size_t i = 0; i < N; ++i )
+        {
+            r[ i ] ^= mask_[ i ];
+        }
+    }
+
+public:
+
+    typedef std::array<unsigned char, 16> result_type;
+    typedef std::uint64_t size_type;
+
+    explicit polyval_base( std::uint64_t seed = 0 )
+    {
+        init( seed );
+    }
+
+    polyval_base( unsigned char const * p, std::size_t n )
+    {
+        if( n == 0 )
+        {
+            init( 0 );
+        }
+        else if( n == N )
+        {
+            init_key( p, 0 );
+        }
+        else if( n == 2 * N )
+        {
+            init_key( p, p + N );
+        }
+        else
+        {
+            init( p, n );
+        }
+    }
+
+    void update( void const * pv, std::size_t n )
+    {
+        unsigned char const* p = static_cast<unsigned char const*>( pv );
+
+        if( n == 0 ) return;
+
+        n_ += n;
+
+        if( m_ > 0 )
+        {
+            std::size_t k = N - m_;
+
+            if( n < k )
+            {
+                k = n;
+            }
+
+            std::memcpy( buffer_ + m_, p, k );
+
+            p += k;
+            n -= k;
+            m_ += k;
+
+            if( m_ < N ) return;
+
+            BOOST_ASSERT( m_ == N );
+
+            process( buffer_, 1 );
+            m_ = 0;
+
+            // clear buffered plaintext
+            std::memset( buffer_, 0, N );
+        }
+
+        BOOST_ASSERT( m_ == 0 );
+
+        if( n >= N )
+        {
+            std::size_t k = n / N;
+
+            process( p, k );
+
+            p += k * N;
+            n -= k * N;
+        }
+
+        BOOST_ASSERT( n < N );
+
+        if( n > 0 )
+        {
+            std::memcpy( buffer_, p, n );
+            m_ = n;
+        }
+    }
+
+    result_type result()
+    {
+        result_type r;
+        finalize( &r[ 0 ] );
+
+        // absorb a zero block followed by the result, so that the
+        // next result() returns a different value; the zero block
+        // keeps the result from cancelling the accumulator
+
+        unsigned char q[ 2 * N ] = {};
+        std::memcpy( q + N, &r[ 0 ], N );
+
+        update( q, 2 * N );
+
+        return r;
+    }
+};
+
+} // namespace detail
+
+class polyval: public detail::polyval_base<false>
+{
+public:
+
+    explicit polyval( std::uint64_t seed = 0 ): detail::polyval_base<false>( seed )
+    {
+    }
+
+    polyval( unsigned char const * p, std::size_t n ): detail::polyval_base<false>( p, n )
+    {
+    }
+};
+
+class ghash: public detail::polyval_base<true>
+{
+public:
+
+    explicit ghash( std::uint64_t seed = 0 ): detail::polyval_base<true>( seed )
+    {
+    }
+
+    ghash( unsigned char const * p, std::size_t n ): detail::polyval_base<true>( p, n )
+    {
+    }
+};
+
+} // namespace hash2
+} // namespace boost
+
+#endif // #ifndef BOOST_HASH2_POLYVAL_HPP_INCLUDED
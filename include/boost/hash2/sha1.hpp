@@ -11,6 +11,8 @@
 #include <boost/hash2/detail/read.hpp>
 #include <boost/hash2/detail/write.hpp>
 #include <boost/hash2/detail/rot.hpp>
+#include <boost/hash2/detail/intrin.hpp>
+#include <boost/hash2/detail/cpuid.hpp>
 #include <boost/assert.hpp>
 #include <boost/config.hpp>
 #include <cstdint>
@@ -94,7 +96,7 @@ private:
         b = detail::rotl( b, 30 );
     }
 
-    void transform( unsigned char const block[ 64 ] )
+    void transform_scalar( unsigned char const block[ 64 ] )
     {
         std::uint32_t a = state_[ 0 ];
         std::uint32_t b = state_[ 1 ];
@@ -196,6 +198,264 @@ private:
         state_[ 4 ] += e;
     }
 
+#if defined(BOOST_HASH2_HAS_SSSE3)
+
+    // rounds taking a precomputed W[i] + K[i]
+
+    static BOOST_FORCEINLINE void Q1( std::uint32_t a, std::uint32_t & b, std::uint32_t c, std::uint32_t d, std::uint32_t & e, std::uint32_t wk )
+    {
+        e += detail::rotl( a, 5 ) + ( (b & c) | (~b & d) ) + wk;
+        b = detail::rotl( b, 30 );
+    }
+
+    static BOOST_FORCEINLINE void Q2( std::uint32_t a, std::uint32_t & b, std::uint32_t c, std::uint32_t d, std::uint32_t & e, std::uint32_t wk )
+    {
+        e += detail::rotl( a, 5 ) + ( b ^ c ^ d ) + wk;
+        b = detail::rotl( b, 30 );
+    }
+
+    static BOOST_FORCEINLINE void Q3( std::uint32_t a, std::uint32_t & b, std::uint32_t c, std::uint32_t d, std::uint32_t & e, std::uint32_t wk )
+    {
+        e += detail::rotl( a, 5 ) + ( (b & c) | (b & d) | (c & d) ) + wk;
+        b = detail::rotl( b, 30 );
+    }
+
+    static BOOST_FORCEINLINE __m128i rotl_epi32( __m128i x, int k )
+    {
+        return _mm_or_si128( _mm_slli_epi32( x, k ), _mm_srli_epi32( x, 32 - k ) );
+    }
+
+    // message schedule computed four words at a time, rounds scalar
+
+    void transform_ssse3( unsigned char const block[ 64 ] )
+    {
+        __m128i const bswap = _mm_set_epi8( 12, 13, 14, 15, 8, 9, 10, 11, 4, 5, 6, 7, 0, 1, 2, 3 );
+
+        __m128i w[ 20 ];
+
+        for( int i = 0; i < 4; ++i )
+        {
+            w[ i ] = _mm_shuffle_epi8( _mm_loadu_si128( reinterpret_cast<__m128i const*>( block + i * 16 ) ), bswap );
+        }
+
+        // W[i] = rotl( W[i-3] ^ W[i-8] ^ W[i-14] ^ W[i-16], 1 )
+        //
+        // W[i+3] depends on W[i], which is computed in the same vector;
+        // its contribution is added afterwards
+
+        for( int i = 4; i < 8; ++i )
+        {
+            __m128i x = _mm_srli_si128( w[ i - 1 ], 4 );
+
+            x = _mm_xor_si128( x, w[ i - 2 ] );
+            x = _mm_xor_si128( x, _mm_alignr_epi8( w[ i - 3 ], w[ i - 4 ], 8 ) );
+            x = _mm_xor_si128( x, w[ i - 4 ] );
+
+            x = rotl_epi32( x, 1 );
+            x = _mm_xor_si128( x, rotl_epi32( _mm_slli_si128( x, 12 ), 1 ) );
+
+            w[ i ] = x;
+        }
+
+        // for i >= 32, equivalently
+        // W[i] = rotl( W[i-6] ^ W[i-16] ^ W[i-28] ^ W[i-32], 2 )
+
+        for( int i = 8; i < 20; ++i )
+        {
+            __m128i x = _mm_alignr_epi8( w[ i - 1 ], w[ i - 2 ], 8 );
+
+            x = _mm_xor_si128( x, w[ i - 4 ] );
+            x = _mm_xor_si128( x, w[ i - 7 ] );
+            x = _mm_xor_si128( x, w[ i - 8 ] );
+
+            w[ i ] = rotl_epi32( x, 2 );
+        }
+
+        std::uint32_t wk[ 80 ];
+
+        {
+            __m128i const k1 = _mm_set1_epi32( 0x5A827999 );
+            __m128i const k2 = _mm_set1_epi32( 0x6ED9EBA1 );
+            __m128i const k3 = _mm_set1_epi32( static_cast<int>( 0x8F1BBCDC ) );
+            __m128i const k4 = _mm_set1_epi32( static_cast<int>( 0xCA62C1D6 ) );
+
+            for( int i = 0; i < 5; ++i )
+            {
+                _mm_storeu_si128( reinterpret_cast<__m128i*>( wk + i * 4 + 0 ), _mm_add_epi32( w[ i + 0 ], k1 ) );
+                _mm_storeu_si128( reinterpret_cast<__m128i*>( wk + i * 4 + 20 ), _mm_add_epi32( w[ i + 5 ], k2 ) );
+                _mm_storeu_si128( reinterpret_cast<__m128i*>( wk + i * 4 + 40 ), _mm_add_epi32( w[ i + 10 ], k3 ) );
+                _mm_storeu_si128( reinterpret_cast<__m128i*>( wk + i * 4 + 60 ), _mm_add_epi32( w[ i + 15 ], k4 ) );
+            }
+        }
+
+        std::uint32_t a = state_[ 0 ];
+        std::uint32_t b = state_[ 1 ];
+        std::uint32_t c = state_[ 2 ];
+        std::uint32_t d = state_[ 3 ];
+        std::uint32_t e = state_[ 4 ];
+
+        for( int i = 0; i < 20; i += 5 )
+        {
+            Q1( a, b, c, d, e, wk[ i + 0 ] );
+            Q1( e, a, b, c, d, wk[ i + 1 ] );
+            Q1( d, e, a, b, c, wk[ i + 2 ] );
+            Q1( c, d, e, a, b, wk[ i + 3 ] );
+            Q1( b, c, d, e, a, wk[ i + 4 ] );
+        }
+
+        for( int i = 20; i < 40; i += 5 )
+        {
+            Q2( a, b, c, d, e, wk[ i + 0 ] );
+            Q2( e, a, b, c, d, wk[ i + 1 ] );
+            Q2( d, e, a, b, c, wk[ i + 2 ] );
+            Q2( c, d, e, a, b, wk[ i + 3 ] );
+            Q2( b, c, d, e, a, wk[ i + 4 ] );
+        }
+
+        for( int i = 40; i < 60; i += 5 )
+        {
+            Q3( a, b, c, d, e, wk[ i + 0 ] );
+            Q3( e, a, b, c, d, wk[ i + 1 ] );
+            Q3( d, e, a, b, c, wk[ i + 2 ] );
+            Q3( c, d, e, a, b, wk[ i + 3 ] );
+            Q3( b, c, d, e, a, wk[ i + 4 ] );
+        }
+
+        for( int i = 60; i < 80; i += 5 )
+        {
+            Q2( a, b, c, d, e, wk[ i + 0 ] );
+            Q2( e, a, b, c, d, wk[ i + 1 ] );
+            Q2( d, e, a, b, c, wk[ i + 2 ] );
+            Q2( c, d, e, a, b, wk[ i + 3 ] );
+            Q2( b, c, d, e, a, wk[ i + 4 ] );
+        }
+
+        state_[ 0 ] += a;
+        state_[ 1 ] += b;
+        state_[ 2 ] += c;
+        state_[ 3 ] += d;
+        state_[ 4 ] += e;
+    }
+
+#endif // #if defined(BOOST_HASH2_HAS_SSSE3)
+
+#if defined(BOOST_HASH2_HAS_SHA) || defined(BOOST_HASH2_SHA_DISPATCH)
+
+    // four rounds with function F
+    //
+    // e holds the value of abcd from before the previous four rounds,
+    // from which sha1nexte derives the current e
+
+    template<int F> static BOOST_FORCEINLINE BOOST_HASH2_TARGET_SHA void rounds_sha( __m128i & abcd, __m128i & e, __m128i w )
+    {
+        __m128i e1 = _mm_sha1nexte_epu32( e, w );
+
+        e = abcd;
+        abcd = _mm_sha1rnds4_epu32( abcd, e1, F );
+    }
+
+    // advances the message schedule after w3 has been consumed
+
+    static BOOST_FORCEINLINE BOOST_HASH2_TARGET_SHA void schedule_sha( __m128i & w0, __m128i & w1, __m128i & w2, __m128i w3 )
+    {
+        w0 = _mm_sha1msg2_epu32( w0, w3 );
+        w1 = _mm_xor_si128( w1, w3 );
+        w2 = _mm_sha1msg1_epu32( w2, w3 );
+    }
+
+    BOOST_HASH2_TARGET_SHA void transform_sha( unsigned char const block[ 64 ] )
+    {
+        __m128i const bswap = _mm_set_epi8( 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15 );
+
+        __m128i abcd = _mm_shuffle_epi32( _mm_loadu_si128( reinterpret_cast<__m128i const*>( state_ ) ), 0x1B );
+        __m128i const abcd0 = abcd;
+
+        __m128i const e0 = _mm_set_epi32( static_cast<int>( state_[ 4 ] ), 0, 0, 0 );
+
+        // sha1nexte rotates its first argument by 30; compensate
+        __m128i e = _mm_set_epi32( static_cast<int>( detail::rotl( state_[ 4 ], 2 ) ), 0, 0, 0 );
+
+        __m128i w0 = _mm_shuffle_epi8( _mm_loadu_si128( reinterpret_cast<__m128i const*>( block +  0 ) ), bswap );
+        __m128i w1 = _mm_shuffle_epi8( _mm_loadu_si128( reinterpret_cast<__m128i const*>( block + 16 ) ), bswap );
+        __m128i w2 = _mm_shuffle_epi8( _mm_loadu_si128( reinterpret_cast<__m128i const*>( block + 32 ) ), bswap );
+        __m128i w3 = _mm_shuffle_epi8( _mm_loadu_si128( reinterpret_cast<__m128i const*>( block + 48 ) ), bswap );
+
+        rounds_sha<0>( abcd, e, w0 );
+
+        rounds_sha<0>( abcd, e, w1 );
+        w0 = _mm_sha1msg1_epu32( w0, w1 );
+
+        rounds_sha<0>( abcd, e, w2 );
+        w1 = _mm_sha1msg1_epu32( w1, w2 );
+        w0 = _mm_xor_si128( w0, w2 );
+
+        rounds_sha<0>( abcd, e, w3 ); schedule_sha( w0, w1, w2, w3 );
+        rounds_sha<0>( abcd, e, w0 ); schedule_sha( w1, w2, w3, w0 );
+
+        rounds_sha<1>( abcd, e, w1 ); schedule_sha( w2, w3, w0, w1 );
+        rounds_sha<1>( abcd, e, w2 ); schedule_sha( w3, w0, w1, w2 );
+        rounds_sha<1>( abcd, e, w3 ); schedule_sha( w0, w1, w2, w3 );
+        rounds_sha<1>( abcd, e, w0 ); schedule_sha( w1, w2, w3, w0 );
+        rounds_sha<1>( abcd, e, w1 ); schedule_sha( w2, w3, w0, w1 );
+
+        rounds_sha<2>( abcd, e, w2 ); schedule_sha( w3, w0, w1, w2 );
+        rounds_sha<2>( abcd, e, w3 ); schedule_sha( w0, w1, w2, w3 );
+        rounds_sha<2>( abcd, e, w0 ); schedule_sha( w1, w2, w3, w0 );
+        rounds_sha<2>( abcd, e, w1 ); schedule_sha( w2, w3, w0, w1 );
+        rounds_sha<2>( abcd, e, w2 ); schedule_sha( w3, w0, w1, w2 );
+
+        rounds_sha<3>( abcd, e, w3 ); schedule_sha( w0, w1, w2, w3 );
+        rounds_sha<3>( abcd, e, w0 ); schedule_sha( w1, w2, w3, w0 );
+
+        rounds_sha<3>( abcd, e, w1 );
+        w2 = _mm_sha1msg2_epu32( w2, w1 );
+        w3 = _mm_xor_si128( w3, w1 );
+
+        rounds_sha<3>( abcd, e, w2 );
+        w3 = _mm_sha1msg2_epu32( w3, w2 );
+
+        rounds_sha<3>( abcd, e, w3 );
+
+        abcd = _mm_add_epi32( abcd, abcd0 );
+        e = _mm_sha1nexte_epu32( e, e0 );
+
+        _mm_storeu_si128( reinterpret_cast<__m128i*>( state_ ), _mm_shuffle_epi32( abcd, 0x1B ) );
+        state_[ 4 ] = static_cast<std::uint32_t>( _mm_cvtsi128_si32( _mm_srli_si128( e, 12 ) ) );
+    }
+
+#endif // #if defined(BOOST_HASH2_HAS_SHA) || defined(BOOST_HASH2_SHA_DISPATCH)
+
+    void transform( unsigned char const block[ 64 ] )
+    {
+#if defined(BOOST_HASH2_HAS_SHA)
+
+        transform_sha( block );
+
+#else
+
+#if defined(BOOST_HASH2_SHA_DISPATCH)
+
+        if( detail::cpu_has_sha() )
+        {
+            transform_sha( block );
+            return;
+        }
+
+#endif
+
+#if defined(BOOST_HASH2_HAS_SSSE3)
+
+        transform_ssse3( block );
+
+#else
+
+        transform_scalar( block );
+
+#endif
+
+#endif
+    }
+
 public:
 
     typedef std::array<unsigned char, 20> result_type;
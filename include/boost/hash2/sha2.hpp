@@ -0,0 +1,1065 @@
+#ifndef BOOST_HASH2_SHA2_HPP_INCLUDED
+#define BOOST_HASH2_SHA2_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// SHA2 message digest algorithms, https://csrc.nist.gov/pubs/fips/180-4/upd1/final
+
+#include <boost/hash2/hmac.hpp>
+#include <boost/hash2/detail/read.hpp>
+#include <boost/hash2/detail/write.hpp>
+#include <boost/hash2/detail/rot.hpp>
+#include <boost/hash2/detail/intrin.hpp>
+#include <boost/assert.hpp>
+#include <boost/config.hpp>
+#include <cstdint>
+#include <array>
+#include <cstring>
+#include <cstddef>
+
+namespace boost
+{
+namespace hash2
+{
+namespace detail
+{
+
+template<class = void> struct sha2_256_constants
+{
+    static const std::uint32_t K[ 64 ];
+};
+
+template<class T> const std::uint32_t sha2_256_constants<T>::K[ 64 ] =
+{
+    0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+    0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+    0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+    0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+    0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+    0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+    0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+    0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
+};
+
+class sha2_256_base
+{
+protected:
+
+    std::uint32_t state_[ 8 ];
+
+    static const int N = 64;
+
+    unsigned char buffer_[ N ];
+    std::size_t m_; // == n_ % N
+
+    std::uint64_t n_;
+
+protected:
+
+    sha2_256_base(): m_( 0 ), n_( 0 )
+    {
+    }
+
+    static BOOST_FORCEINLINE std::uint32_t Sigma0( std::uint32_t x )
+    {
+        return detail::rotr( x, 2 ) ^ detail::rotr( x, 13 ) ^ detail::rotr( x, 22 );
+    }
+
+    static BOOST_FORCEINLINE std::uint32_t Sigma1( std::uint32_t x )
+    {
+        return detail::rotr( x, 6 ) ^ detail::rotr( x, 11 ) ^ detail::rotr( x, 25 );
+    }
+
+    static BOOST_FORCEINLINE std::uint32_t sigma0( std::uint32_t x )
+    {
+        return detail::rotr( x, 7 ) ^ detail::rotr( x, 18 ) ^ ( x >> 3 );
+    }
+
+    static BOOST_FORCEINLINE std::uint32_t sigma1( std::uint32_t x )
+    {
+        return detail::rotr( x, 17 ) ^ detail::rotr( x, 19 ) ^ ( x >> 10 );
+    }
+
+    static BOOST_FORCEINLINE void R( std::uint32_t a, std::uint32_t b, std::uint32_t c, std::uint32_t & d, std::uint32_t e, std::uint32_t f, std::uint32_t g, std::uint32_t & h, std::uint32_t wk )
+    {
+        h += Sigma1( e ) + ( g ^ ( e & ( f ^ g ) ) ) + wk;
+        d += h;
+        h += Sigma0( a ) + ( ( a & b ) | ( c & ( a | b ) ) );
+    }
+
+    void transform_scalar( unsigned char const block[ 64 ] )
+    {
+        std::uint32_t const * K = sha2_256_constants<>::K;
+
+        std::uint32_t w[ 64 ];
+
+        for( int i = 0; i < 16; ++i )
+        {
+            w[ i ] = detail::read32be( block + i * 4 );
+        }
+
+        for( int i = 16; i < 64; ++i )
+        {
+            w[ i ] = sigma1( w[ i - 2 ] ) + w[ i - 7 ] + sigma0( w[ i - 15 ] ) + w[ i - 16 ];
+        }
+
+        std::uint32_t a = state_[ 0 ];
+        std::uint32_t b = state_[ 1 ];
+        std::uint32_t c = state_[ 2 ];
+        std::uint32_t d = state_[ 3 ];
+        std::uint32_t e = state_[ 4 ];
+        std::uint32_t f = state_[ 5 ];
+        std::uint32_t g = state_[ 6 ];
+        std::uint32_t h = state_[ 7 ];
+
+        for( int i = 0; i < 64; i += 8 )
+        {
+            R( a, b, c, d, e, f, g, h, K[ i + 0 ] + w[ i + 0 ] );
+            R( h, a, b, c, d, e, f, g, K[ i + 1 ] + w[ i + 1 ] );
+            R( g, h, a, b, c, d, e, f, K[ i + 2 ] + w[ i + 2 ] );
+            R( f, g, h, a, b, c, d, e, K[ i + 3 ] + w[ i + 3 ] );
+            R( e, f, g, h, a, b, c, d, K[ i + 4 ] + w[ i + 4 ] );
+            R( d, e, f, g, h, a, b, c, K[ i + 5 ] + w[ i + 5 ] );
+            R( c, d, e, f, g, h, a, b, K[ i + 6 ] + w[ i + 6 ] );
+            R( b, c, d, e, f, g, h, a, K[ i + 7 ] + w[ i + 7 ] );
+        }
+
+        state_[ 0 ] += a;
+        state_[ 1 ] += b;
+        state_[ 2 ] += c;
+        state_[ 3 ] += d;
+        state_[ 4 ] += e;
+        state_[ 5 ] += f;
+        state_[ 6 ] += g;
+        state_[ 7 ] += h;
+    }
+
+#if defined(BOOST_HASH2_HAS_SHA)
+
+    // four rounds; the state is kept as ABEF and CDGH, as sha256rnds2 expects
+
+    static BOOST_FORCEINLINE void rounds_sha( __m128i & abef, __m128i & cdgh, __m128i w, int i )
+    {
+        __m128i wk = _mm_add_epi32( w, _mm_loadu_si128( reinterpret_cast<__m128i const*>( sha2_256_constants<>::K + i * 4 ) ) );
+
+        cdgh = _mm_sha256rnds2_epu32( cdgh, abef, wk );
+        abef = _mm_sha256rnds2_epu32( abef, cdgh, _mm_shuffle_epi32( wk, 0x0E ) );
+    }
+
+    // computes the next four message words into w0, from w0..w3 (w3 newest)
+
+    static BOOST_FORCEINLINE void schedule_sha( __m128i & w0, __m128i w2, __m128i w3 )
+    {
+        w0 = _mm_sha256msg2_epu32( _mm_add_epi32( w0, _mm_alignr_epi8( w3, w2, 4 ) ), w3 );
+    }
+
+    void transform_sha( unsigned char const block[ 64 ] )
+    {
+        __m128i const bswap = _mm_set_epi8( 12, 13, 14, 15, 8, 9, 10, 11, 4, 5, 6, 7, 0, 1, 2, 3 );
+
+        __m128i abcd = _mm_loadu_si128( reinterpret_cast<__m128i const*>( state_ + 0 ) );
+        __m128i efgh = _mm_loadu_si128( reinterpret_cast<__m128i const*>( state_ + 4 ) );
+
+        __m128i abef = _mm_shuffle_epi32( _mm_unpacklo_epi64( efgh, abcd ), 0xB1 ); // F E B A
+        __m128i cdgh = _mm_shuffle_epi32( _mm_unpackhi_epi64( efgh, abcd ), 0xB1 ); // H G D C
+
+        __m128i const abef0 = abef;
+        __m128i const cdgh0 = cdgh;
+
+        __m128i w0 = _mm_shuffle_epi8( _mm_loadu_si128( reinterpret_cast<__m128i const*>( block +  0 ) ), bswap );
+        __m128i w1 = _mm_shuffle_epi8( _mm_loadu_si128( reinterpret_cast<__m128i const*>( block + 16 ) ), bswap );
+        __m128i w2 = _mm_shuffle_epi8( _mm_loadu_si128( reinterpret_cast<__m128i const*>( block + 32 ) ), bswap );
+        __m128i w3 = _mm_shuffle_epi8( _mm_loadu_si128( reinterpret_cast<__m128i const*>( block + 48 ) ), bswap );
+
+        rounds_sha( abef, cdgh, w0, 0 );
+
+        rounds_sha( abef, cdgh, w1, 1 );
+        w0 = _mm_sha256msg1_epu32( w0, w1 );
+
+        rounds_sha( abef, cdgh, w2, 2 );
+        w1 = _mm_sha256msg1_epu32( w1, w2 );
+
+        for( int i = 3; i < 11; i += 4 )
+        {
+            rounds_sha( abef, cdgh, w3, i + 0 );
+            schedule_sha( w0, w2, w3 );
+            w2 = _mm_sha256msg1_epu32( w2, w3 );
+
+            rounds_sha( abef, cdgh, w0, i + 1 );
+            schedule_sha( w1, w3, w0 );
+            w3 = _mm_sha256msg1_epu32( w3, w0 );
+
+            rounds_sha( abef, cdgh, w1, i + 2 );
+            schedule_sha( w2, w0, w1 );
+            w0 = _mm_sha256msg1_epu32( w0, w1 );
+
+            rounds_sha( abef, cdgh, w2, i + 3 );
+            schedule_sha( w3, w1, w2 );
+            w1 = _mm_sha256msg1_epu32( w1, w2 );
+        }
+
+        rounds_sha( abef, cdgh, w3, 11 );
+        schedule_sha( w0, w2, w3 );
+        w2 = _mm_sha256msg1_epu32( w2, w3 );
+
+        rounds_sha( abef, cdgh, w0, 12 );
+        schedule_sha( w1, w3, w0 );
+        w3 = _mm_sha256msg1_epu32( w3, w0 );
+
+        rounds_sha( abef, cdgh, w1, 13 );
+        schedule_sha( w2, w0, w1 );
+
+        rounds_sha( abef, cdgh, w2, 14 );
+        schedule_sha( w3, w1, w2 );
+
+        rounds_sha( abef, cdgh, w3, 15 );
+
+        abef = _mm_add_epi32( abef, abef0 );
+        cdgh = _mm_add_epi32( cdgh, cdgh0 );
+
+        abcd = _mm_shuffle_epi32( _mm_unpackhi_epi64( abef, cdgh ), 0xB1 );
+        efgh = _mm_shuffle_epi32( _mm_unpacklo_epi64( abef, cdgh ), 0xB1 );
+
+        _mm_storeu_si128( reinterpret_cast<__m128i*>( state_ + 0 ), abcd );
+        _mm_storeu_si128( reinterpret_cast<__m128i*>( state_ + 4 ), efgh );
+    }
+
+#endif // #if defined(BOOST_HASH2_HAS_SHA)
+
+    void transform( unsigned char const block[ 64 ] )
+    {
+#if defined(BOOST_HASH2_HAS_SHA)
+
+        transform_sha( block );
+
+#else
+
+        transform_scalar( block );
+
+#endif
+    }
+
+    void finalize()
+    {
+        BOOST_ASSERT( m_ == n_ % N );
+
+        unsigned char bits[ 8 ];
+
+        detail::write64be( bits, n_ * 8 );
+
+        std::size_t k = m_ < 56? 56 - m_: 120 - m_;
+
+        unsigned char padding[ 64 ] = { 0x80 };
+
+        update( padding, k );
+
+        update( bits, 8 );
+
+        BOOST_ASSERT( m_ == 0 );
+    }
+
+public:
+
+    typedef std::uint64_t size_type;
+
+    static const int block_size = 64;
+
+    void update( void const * pv, std::size_t n )
+    {
+        unsigned char const* p = static_cast<unsigned char const*>( pv );
+
+        BOOST_ASSERT( m_ == n_ % N );
+
+        if( n == 0 ) return;
+
+        n_ += n;
+
+        if( m_ > 0 )
+        {
+            std::size_t k = N - m_;
+
+            if( n < k )
+            {
+                k = n;
+            }
+
+            std::memcpy( buffer_ + m_, p, k );
+
+            p += k;
+            n -= k;
+            m_ += k;
+
+            if( m_ < N ) return;
+
+            BOOST_ASSERT( m_ == N );
+
+            transform( buffer_ );
+            m_ = 0;
+
+            std::memset( buffer_, 0, N );
+        }
+
+        BOOST_ASSERT( m_ == 0 );
+
+        while( n >= N )
+        {
+            transform( p );
+
+            p += N;
+            n -= N;
+        }
+
+        BOOST_ASSERT( n < N );
+
+        if( n > 0 )
+        {
+            std::memcpy( buffer_, p, n );
+            m_ = n;
+        }
+
+        BOOST_ASSERT( m_ == n_ % N );
+    }
+};
+
+template<class = void> struct sha2_512_constants
+{
+    static const std::uint64_t K[ 80 ];
+};
+
+template<class T> const std::uint64_t sha2_512_constants<T>::K[ 80 ] =
+{
+    0x428a2f98d728ae22ULL, 0x7137449123ef65cdULL, 0xb5c0fbcfec4d3b2fULL, 0xe9b5dba58189dbbcULL,
+    0x3956c25bf348b538ULL, 0x59f111f1b605d019ULL, 0x923f82a4af194f9bULL, 0xab1c5ed5da6d8118ULL,
+    0xd807aa98a3030242ULL, 0x12835b0145706fbeULL, 0x243185be4ee4b28cULL, 0x550c7dc3d5ffb4e2ULL,
+    0x72be5d74f27b896fULL, 0x80deb1fe3b1696b1ULL, 0x9bdc06a725c71235ULL, 0xc19bf174cf692694ULL,
+    0xe49b69c19ef14ad2ULL, 0xefbe4786384f25e3ULL, 0x0fc19dc68b8cd5b5ULL, 0x240ca1cc77ac9c65ULL,
+    0x2de92c6f592b0275ULL, 0x4a7484aa6ea6e483ULL, 0x5cb0a9dcbd41fbd4ULL, 0x76f988da831153b5ULL,
+    0x983e5152ee66dfabULL, 0xa831c66d2db43210ULL, 0xb00327c898fb213fULL, 0xbf597fc7beef0ee4ULL,
+    0xc6e00bf33da88fc2ULL, 0xd5a79147930aa725ULL, 0x06ca6351e003826fULL, 0x142929670a0e6e70ULL,
+    0x27b70a8546d22ffcULL, 0x2e1b21385c26c926ULL, 0x4d2c6dfc5ac42aedULL, 0x53380d139d95b3dfULL,
+    0x650a73548baf63deULL, 0x766a0abb3c77b2a8ULL, 0x81c2c92e47edaee6ULL, 0x92722c851482353bULL,
+    0xa2bfe8a14cf10364ULL, 0xa81a664bbc423001ULL, 0xc24b8b70d0f89791ULL, 0xc76c51a30654be30ULL,
+    0xd192e819d6ef5218ULL, 0xd69906245565a910ULL, 0xf40e35855771202aULL, 0x106aa07032bbd1b8ULL,
+    0x19a4c116b8d2d0c8ULL, 0x1e376c085141ab53ULL, 0x2748774cdf8eeb99ULL, 0x34b0bcb5e19b48a8ULL,
+    0x391c0cb3c5c95a63ULL, 0x4ed8aa4ae3418acbULL, 0x5b9cca4f7763e373ULL, 0x682e6ff3d6b2b8a3ULL,
+    0x748f82ee5defb2fcULL, 0x78a5636f43172f60ULL, 0x84c87814a1f0ab72ULL, 0x8cc702081a6439ecULL,
+    0x90befffa23631e28ULL, 0xa4506cebde82bde9ULL, 0xbef9a3f7b2c67915ULL, 0xc67178f2e372532bULL,
+    0xca273eceea26619cULL, 0xd186b8c721c0c207ULL, 0xeada7dd6cde0eb1eULL, 0xf57d4f7fee6ed178ULL,
+    0x06f067aa72176fbaULL, 0x0a637dc5a2c898a6ULL, 0x113f9804bef90daeULL, 0x1b710b35131c471bULL,
+    0x28db77f523047d84ULL, 0x32caab7b40c72493ULL, 0x3c9ebe0a15c9bebcULL, 0x431d67c49c100d4cULL,
+    0x4cc5d4becb3e42b6ULL, 0x597f299cfc657e2aULL, 0x5fcb6fab3ad6faecULL, 0x6c44198c4a475817ULL
+};
+
+class sha2_512_base
+{
+protected:
+
+    std::uint64_t state_[ 8 ];
+
+    static const int N = 128;
+
+    unsigned char buffer_[ N ];
+    std::size_t m_; // == n_ % N
+
+    std::uint64_t n_;
+
+protected:
+
+    sha2_512_base(): m_( 0 ), n_( 0 )
+    {
+    }
+
+    static BOOST_FORCEINLINE std::uint64_t Sigma0( std::uint64_t x )
+    {
+        return detail::rotr( x, 28 ) ^ detail::rotr( x, 34 ) ^ detail::rotr( x, 39 );
+    }
+
+    static BOOST_FORCEINLINE std::uint64_t Sigma1( std::uint64_t x )
+    {
+        return detail::rotr( x, 14 ) ^ detail::rotr( x, 18 ) ^ detail::rotr( x, 41 );
+    }
+
+    static BOOST_FORCEINLINE std::uint64_t sigma0( std::uint64_t x )
+    {
+        return detail::rotr( x, 1 ) ^ detail::rotr( x, 8 ) ^ ( x >> 7 );
+    }
+
+    static BOOST_FORCEINLINE std::uint64_t sigma1( std::uint64_t x )
+    {
+        return detail::rotr( x, 19 ) ^ detail::rotr( x, 61 ) ^ ( x >> 6 );
+    }
+
+    static BOOST_FORCEINLINE void R( std::uint64_t a, std::uint64_t b, std::uint64_t c, std::uint64_t & d, std::uint64_t e, std::uint64_t f, std::uint64_t g, std::uint64_t & h, std::uint64_t wk )
+    {
+        h += Sigma1( e ) + ( g ^ ( e & ( f ^ g ) ) ) + wk;
+        d += h;
+        h += Sigma0( a ) + ( ( a & b ) | ( c & ( a | b ) ) );
+    }
+
+    // wk[ i ] = W[ i ] + K[ i ]
+
+    static void schedule_scalar( unsigned char const block[ 128 ], std::uint64_t wk[ 80 ] )
+    {
+        std::uint64_t const * K = sha2_512_constants<>::K;
+
+        std::uint64_t w[ 80 ];
+
+        for( int i = 0; i < 16; ++i )
+        {
+            w[ i ] = detail::read64be( block + i * 8 );
+        }
+
+        for( int i = 16; i < 80; ++i )
+        {
+            w[ i ] = sigma1( w[ i - 2 ] ) + w[ i - 7 ] + sigma0( w[ i - 15 ] ) + w[ i - 16 ];
+        }
+
+        for( int i = 0; i < 80; ++i )
+        {
+            wk[ i ] = w[ i ] + K[ i ];
+        }
+    }
+
+#if defined(BOOST_HASH2_HAS_AVX2)
+
+#if defined(BOOST_HASH2_HAS_AVX512)
+
+    template<int k> static BOOST_FORCEINLINE __m256i rotr_epi64( __m256i x )
+    {
+        return _mm256_ror_epi64( x, k );
+    }
+
+    static BOOST_FORCEINLINE __m256i xor3_epi64( __m256i x, __m256i y, __m256i z )
+    {
+        return _mm256_ternarylogic_epi64( x, y, z, 0x96 );
+    }
+
+    // x[ 1 ], x[ 2 ], x[ 3 ], y[ 0 ]
+    static BOOST_FORCEINLINE __m256i align1_epi64( __m256i x, __m256i y )
+    {
+        return _mm256_alignr_epi64( y, x, 1 );
+    }
+
+#else
+
+    template<int k> static BOOST_FORCEINLINE __m256i rotr_epi64( __m256i x )
+    {
+        return _mm256_or_si256( _mm256_srli_epi64( x, k ), _mm256_slli_epi64( x, 64 - k ) );
+    }
+
+    static BOOST_FORCEINLINE __m256i xor3_epi64( __m256i x, __m256i y, __m256i z )
+    {
+        return _mm256_xor_si256( _mm256_xor_si256( x, y ), z );
+    }
+
+    // x[ 1 ], x[ 2 ], x[ 3 ], y[ 0 ]
+    static BOOST_FORCEINLINE __m256i align1_epi64( __m256i x, __m256i y )
+    {
+        return _mm256_alignr_epi8( _mm256_permute2x128_si256( x, y, 0x21 ), x, 8 );
+    }
+
+#endif
+
+    static BOOST_FORCEINLINE __m256i sigma0( __m256i x )
+    {
+        return xor3_epi64( rotr_epi64<1>( x ), rotr_epi64<8>( x ), _mm256_srli_epi64( x, 7 ) );
+    }
+
+    static BOOST_FORCEINLINE __m256i sigma1( __m256i x )
+    {
+        return xor3_epi64( rotr_epi64<19>( x ), rotr_epi64<61>( x ), _mm256_srli_epi64( x, 6 ) );
+    }
+
+    // the message schedule, computed four words at a time
+
+    static void schedule_avx2( unsigned char const block[ 128 ], std::uint64_t wk[ 80 ] )
+    {
+        std::uint64_t const * K = sha2_512_constants<>::K;
+
+        __m256i const bswap = _mm256_set_epi8(
+            8, 9, 10, 11, 12, 13, 14, 15, 0, 1, 2, 3, 4, 5, 6, 7,
+            8, 9, 10, 11, 12, 13, 14, 15, 0, 1, 2, 3, 4, 5, 6, 7 );
+
+        // W[ i - 16 .. i - 1 ]
+
+        __m256i w0 = _mm256_shuffle_epi8( _mm256_loadu_si256( reinterpret_cast<__m256i const*>( block +  0 ) ), bswap );
+        __m256i w1 = _mm256_shuffle_epi8( _mm256_loadu_si256( reinterpret_cast<__m256i const*>( block + 32 ) ), bswap );
+        __m256i w2 = _mm256_shuffle_epi8( _mm256_loadu_si256( reinterpret_cast<__m256i const*>( block + 64 ) ), bswap );
+        __m256i w3 = _mm256_shuffle_epi8( _mm256_loadu_si256( reinterpret_cast<__m256i const*>( block + 96 ) ), bswap );
+
+        _mm256_storeu_si256( reinterpret_cast<__m256i*>( wk +  0 ), _mm256_add_epi64( w0, _mm256_loadu_si256( reinterpret_cast<__m256i const*>( K +  0 ) ) ) );
+        _mm256_storeu_si256( reinterpret_cast<__m256i*>( wk +  4 ), _mm256_add_epi64( w1, _mm256_loadu_si256( reinterpret_cast<__m256i const*>( K +  4 ) ) ) );
+        _mm256_storeu_si256( reinterpret_cast<__m256i*>( wk +  8 ), _mm256_add_epi64( w2, _mm256_loadu_si256( reinterpret_cast<__m256i const*>( K +  8 ) ) ) );
+        _mm256_storeu_si256( reinterpret_cast<__m256i*>( wk + 12 ), _mm256_add_epi64( w3, _mm256_loadu_si256( reinterpret_cast<__m256i const*>( K + 12 ) ) ) );
+
+        for( int i = 16; i < 80; i += 4 )
+        {
+            // W[ i ] = sigma1( W[ i - 2 ] ) + W[ i - 7 ] + sigma0( W[ i - 15 ] ) + W[ i - 16 ]
+
+            __m256i x = _mm256_add_epi64( w0, sigma0( align1_epi64( w0, w1 ) ) );
+            x = _mm256_add_epi64( x, align1_epi64( w2, w3 ) );
+
+            // W[ i - 2 ], W[ i - 1 ], 0, 0
+            x = _mm256_add_epi64( x, sigma1( _mm256_permute2x128_si256( w3, w3, 0x81 ) ) );
+
+            // W[ i + 2 ] and W[ i + 3 ] depend on W[ i ] and W[ i + 1 ]
+            x = _mm256_add_epi64( x, sigma1( _mm256_permute2x128_si256( x, x, 0x08 ) ) );
+
+            _mm256_storeu_si256( reinterpret_cast<__m256i*>( wk + i ), _mm256_add_epi64( x, _mm256_loadu_si256( reinterpret_cast<__m256i const*>( K + i ) ) ) );
+
+            w0 = w1;
+            w1 = w2;
+            w2 = w3;
+            w3 = x;
+        }
+    }
+
+#endif // #if defined(BOOST_HASH2_HAS_AVX2)
+
+    void transform( unsigned char const block[ 128 ] )
+    {
+        std::uint64_t wk[ 80 ];
+
+#if defined(BOOST_HASH2_HAS_AVX2)
+
+        schedule_avx2( block, wk );
+
+#else
+
+        schedule_scalar( block, wk );
+
+#endif
+
+        std::uint64_t a = state_[ 0 ];
+        std::uint64_t b = state_[ 1 ];
+        std::uint64_t c = state_[ 2 ];
+        std::uint64_t d = state_[ 3 ];
+        std::uint64_t e = state_[ 4 ];
+        std::uint64_t f = state_[ 5 ];
+        std::uint64_t g = state_[ 6 ];
+        std::uint64_t h = state_[ 7 ];
+
+        for( int i = 0; i < 80; i += 8 )
+        {
+            R( a, b, c, d, e, f, g, h, wk[ i + 0 ] );
+            R( h, a, b, c, d, e, f, g, wk[ i + 1 ] );
+            R( g, h, a, b, c, d, e, f, wk[ i + 2 ] );
+            R( f, g, h, a, b, c, d, e, wk[ i + 3 ] );
+            R( e, f, g, h, a, b, c, d, wk[ i + 4 ] );
+            R( d, e, f, g, h, a, b, c, wk[ i + 5 ] );
+            R( c, d, e, f, g, h, a, b, wk[ i + 6 ] );
+            R( b, c, d, e, f, g, h, a, wk[ i + 7 ] );
+        }
+
+        state_[ 0 ] += a;
+        state_[ 1 ] += b;
+        state_[ 2 ] += c;
+        state_[ 3 ] += d;
+        state_[ 4 ] += e;
+        state_[ 5 ] += f;
+        state_[ 6 ] += g;
+        state_[ 7 ] += h;
+    }
+
+    void finalize()
+    {
+        BOOST_ASSERT( m_ == n_ % N );
+
+        unsigned char bits[ 16 ];
+
+        // the length in bits is a 128 bit quantity
+        detail::write64be( bits + 0, n_ >> 61 );
+        detail::write64be( bits + 8, n_ << 3 );
+
+        std::size_t k = m_ < 112? 112 - m_: 240 - m_;
+
+        unsigned char padding[ 128 ] = { 0x80 };
+
+        update( padding, k );
+
+        update( bits, 16 );
+
+        BOOST_ASSERT( m_ == 0 );
+    }
+
+public:
+
+    typedef std::uint64_t size_type;
+
+    static const int block_size = 128;
+
+    void update( void const * pv, std::size_t n )
+    {
+        unsigned char const* p = static_cast<unsigned char const*>( pv );
+
+        BOOST_ASSERT( m_ == n_ % N );
+
+        if( n == 0 ) return;
+
+        n_ += n;
+
+        if( m_ > 0 )
+        {
+            std::size_t k = N - m_;
+
+            if( n < k )
+            {
+                k = n;
+            }
+
+            std::memcpy( buffer_ + m_, p, k );
+
+            p += k;
+            n -= k;
+            m_ += k;
+
+            if( m_ < N ) return;
+
+            BOOST_ASSERT( m_ == N );
+
+            transform( buffer_ );
+            m_ = 0;
+
+            std::memset( buffer_, 0, N );
+        }
+
+        BOOST_ASSERT( m_ == 0 );
+
+        while( n >= N )
+        {
+            transform( p );
+
+            p += N;
+            n -= N;
+        }
+
+        BOOST_ASSERT( n < N );
+
+        if( n > 0 )
+        {
+            std::memcpy( buffer_, p, n );
+            m_ = n;
+        }
+
+        BOOST_ASSERT( m_ == n_ % N );
+    }
+};
+
+} // namespace detail
+
+class sha2_256: public detail::sha2_256_base
+{
+private:
+
+    void init()
+    {
+        state_[ 0 ] = 0x6a09e667u;
+        state_[ 1 ] = 0xbb67ae85u;
+        state_[ 2 ] = 0x3c6ef372u;
+        state_[ 3 ] = 0xa54ff53au;
+        state_[ 4 ] = 0x510e527fu;
+        state_[ 5 ] = 0x9b05688cu;
+        state_[ 6 ] = 0x1f83d9abu;
+        state_[ 7 ] = 0x5be0cd19u;
+    }
+
+public:
+
+    typedef std::array<unsigned char, 32> result_type;
+
+    sha2_256()
+    {
+        init();
+    }
+
+    explicit sha2_256( std::uint64_t seed )
+    {
+        init();
+
+        if( seed != 0 )
+        {
+            unsigned char tmp[ 8 ];
+            detail::write64le( tmp, seed );
+
+            update( tmp, 8 );
+            result();
+        }
+    }
+
+    sha2_256( unsigned char const * p, std::size_t n )
+    {
+        init();
+
+        if( n != 0 )
+        {
+            update( p, n );
+            result();
+        }
+    }
+
+    result_type result()
+    {
+        finalize();
+
+        result_type digest;
+
+        for( int i = 0; i < 8; ++i )
+        {
+            detail::write32be( &digest[ i * 4 ], state_[ i ] );
+        }
+
+        return digest;
+    }
+};
+
+class sha2_224: public detail::sha2_256_base
+{
+private:
+
+    void init()
+    {
+        state_[ 0 ] = 0xc1059ed8u;
+        state_[ 1 ] = 0x367cd507u;
+        state_[ 2 ] = 0x3070dd17u;
+        state_[ 3 ] = 0xf70e5939u;
+        state_[ 4 ] = 0xffc00b31u;
+        state_[ 5 ] = 0x68581511u;
+        state_[ 6 ] = 0x64f98fa7u;
+        state_[ 7 ] = 0xbefa4fa4u;
+    }
+
+public:
+
+    typedef std::array<unsigned char, 28> result_type;
+
+    sha2_224()
+    {
+        init();
+    }
+
+    explicit sha2_224( std::uint64_t seed )
+    {
+        init();
+
+        if( seed != 0 )
+        {
+            unsigned char tmp[ 8 ];
+            detail::write64le( tmp, seed );
+
+            update( tmp, 8 );
+            result();
+        }
+    }
+
+    sha2_224( unsigned char const * p, std::size_t n )
+    {
+        init();
+
+        if( n != 0 )
+        {
+            update( p, n );
+            result();
+        }
+    }
+
+    result_type result()
+    {
+        finalize();
+
+        result_type digest;
+
+        for( int i = 0; i < 7; ++i )
+        {
+            detail::write32be( &digest[ i * 4 ], state_[ i ] );
+        }
+
+        return digest;
+    }
+};
+
+class sha2_512: public detail::sha2_512_base
+{
+private:
+
+    void init()
+    {
+        state_[ 0 ] = 0x6a09e667f3bcc908ULL;
+        state_[ 1 ] = 0xbb67ae8584caa73bULL;
+        state_[ 2 ] = 0x3c6ef372fe94f82bULL;
+        state_[ 3 ] = 0xa54ff53a5f1d36f1ULL;
+        state_[ 4 ] = 0x510e527fade682d1ULL;
+        state_[ 5 ] = 0x9b05688c2b3e6c1fULL;
+        state_[ 6 ] = 0x1f83d9abfb41bd6bULL;
+        state_[ 7 ] = 0x5be0cd19137e2179ULL;
+    }
+
+public:
+
+    typedef std::array<unsigned char, 64> result_type;
+
+    sha2_512()
+    {
+        init();
+    }
+
+    explicit sha2_512( std::uint64_t seed )
+    {
+        init();
+
+        if( seed != 0 )
+        {
+            unsigned char tmp[ 8 ];
+            detail::write64le( tmp, seed );
+
+            update( tmp, 8 );
+            result();
+        }
+    }
+
+    sha2_512( unsigned char const * p, std::size_t n )
+    {
+        init();
+
+        if( n != 0 )
+        {
+            update( p, n );
+            result();
+        }
+    }
+
+    result_type result()
+    {
+        finalize();
+
+        result_type digest;
+
+        for( int i = 0; i < 8; ++i )
+        {
+            detail::write64be( &digest[ i * 8 ], state_[ i ] );
+        }
+
+        return digest;
+    }
+};
+
+class sha2_384: public detail::sha2_512_base
+{
+private:
+
+    void init()
+    {
+        state_[ 0 ] = 0xcbbb9d5dc1059ed8ULL;
+        state_[ 1 ] = 0x629a292a367cd507ULL;
+        state_[ 2 ] = 0x9159015a3070dd17ULL;
+        state_[ 3 ] = 0x152fecd8f70e5939ULL;
+        state_[ 4 ] = 0x67332667ffc00b31ULL;
+        state_[ 5 ] = 0x8eb44a8768581511ULL;
+        state_[ 6 ] = 0xdb0c2e0d64f98fa7ULL;
+        state_[ 7 ] = 0x47b5481dbefa4fa4ULL;
+    }
+
+public:
+
+    typedef std::array<unsigned char, 48> result_type;
+
+    sha2_384()
+    {
+        init();
+    }
+
+    explicit sha2_384( std::uint64_t seed )
+    {
+        init();
+
+        if( seed != 0 )
+        {
+            unsigned char tmp[ 8 ];
+            detail::write64le( tmp, seed );
+
+            update( tmp, 8 );
+            result();
+        }
+    }
+
+    sha2_384( unsigned char const * p, std::size_t n )
+    {
+        init();
+
+        if( n != 0 )
+        {
+            update( p, n );
+            result();
+        }
+    }
+
+    result_type result()
+    {
+        finalize();
+
+        result_type digest;
+
+        for( int i = 0; i < 6; ++i )
+        {
+            detail::write64be( &digest[ i * 8 ], state_[ i ] );
+        }
+
+        return digest;
+    }
+};
+
+class sha2_512_256: public detail::sha2_512_base
+{
+private:
+
+    void init()
+    {
+        state_[ 0 ] = 0x22312194fc2bf72cULL;
+        state_[ 1 ] = 0x9f555fa3c84c64c2ULL;
+        state_[ 2 ] = 0x2393b86b6f53b151ULL;
+        state_[ 3 ] = 0x963877195940eabdULL;
+        state_[ 4 ] = 0x96283ee2a88effe3ULL;
+        state_[ 5 ] = 0xbe5e1e2553863992ULL;
+        state_[ 6 ] = 0x2b0199fc2c85b8aaULL;
+        state_[ 7 ] = 0x0eb72ddc81c52ca2ULL;
+    }
+
+public:
+
+    typedef std::array<unsigned char, 32> result_type;
+
+    sha2_512_256()
+    {
+        init();
+    }
+
+    explicit sha2_512_256( std::uint64_t seed )
+    {
+        init();
+
+        if( seed != 0 )
+        {
+            unsigned char tmp[ 8 ];
+            detail::write64le( tmp, seed );
+
+            update( tmp, 8 );
+            result();
+        }
+    }
+
+    sha2_512_256( unsigned char const * p, std::size_t n )
+    {
+        init();
+
+        if( n != 0 )
+        {
+            update( p, n );
+            result();
+        }
+    }
+
+    result_type result()
+    {
+        finalize();
+
+        result_type digest;
+
+        for( int i = 0; i < 4; ++i )
+        {
+            detail::write64be( &digest[ i * 8 ], state_[ i ] );
+        }
+
+        return digest;
+    }
+};
+
+class hmac_sha2_256: public hmac<sha2_256>
+{
+public:
+
+    hmac_sha2_256()
+    {
+    }
+
+    explicit hmac_sha2_256( std::uint64_t seed ): hmac<sha2_256>( seed )
+    {
+    }
+
+    hmac_sha2_256( unsigned char const * p, std::size_t n ): hmac<sha2_256>( p, n )
+    {
+    }
+};
+
+class hmac_sha2_224: public hmac<sha2_224>
+{
+public:
+
+    hmac_sha2_224()
+    {
+    }
+
+    explicit hmac_sha2_224( std::uint64_t seed ): hmac<sha2_224>( seed )
+    {
+    }
+
+    hmac_sha2_224( unsigned char const * p, std::size_t n ): hmac<sha2_224>( p, n )
+    {
+    }
+};
+
+class hmac_sha2_512: public hmac<sha2_512>
+{
+public:
+
+    hmac_sha2_512()
+    {
+    }
+
+    explicit hmac_sha2_512( std::uint64_t seed ): hmac<sha2_512>( seed )
+    {
+    }
+
+    hmac_sha2_512( unsigned char const * p, std::size_t n ): hmac<sha2_512>( p, n )
+    {
+    }
+};
+
+class hmac_sha2_384: public hmac<sha2_384>
+{
+public:
+
+    hmac_sha2_384()
+    {
+    }
+
+    explicit hmac_sha2_384( std::uint64_t seed ): hmac<sha2_384>( seed )
+    {
+    }
+
+    hmac_sha2_384( unsigned char const * p, std::size_t n ): hmac<sha2_384>( p, n )
+    {
+    }
+};
+
+class hmac_sha2_512_256: public hmac<sha2_512_256>
+{
+public:
+
+    hmac_sha2_512_256()
+    {
+    }
+
+    explicit hmac_sha2_512_256( std::uint64_t seed ): hmac<sha2_512_256>( seed )
+    {
+    }
+
+    hmac_sha2_512_256( unsigned char const * p, std::size_t n ): hmac<sha2_512_256>( p, n )
+    {
+    }
+};
+
+} // namespace hash2
+} // namespace boost
+
+#endif // #ifndef BOOST_HASH2_SHA2_HPP_INCLUDED
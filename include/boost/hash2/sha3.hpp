@@ -0,0 +1,825 @@
+#ifndef BOOST_HASH2_SHA3_HPP_INCLUDED
+#define BOOST_HASH2_SHA3_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// SHA-3 and SHAKE, https://csrc.nist.gov/pubs/fips/202/final
+
+#include <boost/hash2/detail/intrin.hpp>
+#include <boost/hash2/detail/read.hpp>
+#include <boost/hash2/detail/write.hpp>
+#include <boost/hash2/detail/rot.hpp>
+#include <boost/hash2/detail/config.hpp>
+#include <boost/assert.hpp>
+#include <boost/config.hpp>
+#include <cstdint>
+#include <array>
+#include <cstring>
+#include <cstddef>
+
+namespace boost
+{
+namespace hash2
+{
+namespace detail
+{
+
+template<class = void> struct keccak_constants
+{
+    static const std::uint64_t RC[ 24 ];
+};
+
+template<class T> const std::uint64_t keccak_constants<T>::RC[ 24 ] =
+{
+    0x0000000000000001ull, 0x0000000000008082ull, 0x800000000000808Aull, 0x8000000080008000ull,
+    0x000000000000808Bull, 0x0000000080000001ull, 0x8000000080008081ull, 0x8000000000008009ull,
+    0x000000000000008Aull, 0x0000000000000088ull, 0x0000000080008009ull, 0x000000008000000Aull,
+    0x000000008000808Bull, 0x800000000000008Bull, 0x8000000000008089ull, 0x8000000000008003ull,
+    0x8000000000008002ull, 0x8000000000000080ull, 0x000000000000800Aull, 0x800000008000000Aull,
+    0x8000000080008081ull, 0x8000000000008080ull, 0x0000000080000001ull, 0x8000000080008008ull
+};
+
+// Keccak-f[1600]
+//
+// The single state permutation keeps lanes 1, 2, 8, 12, 17 and 20
+// complemented, which replaces most of the NOT operations of chi
+// with ORs. (See "Keccak implementation overview", section 2.2.)
+
+struct keccak
+{
+    static bool is_complemented( int i )
+    {
+        return i == 1 || i == 2 || i == 8 || i == 12 || i == 17 || i == 20;
+    }
+
+    // converts between the standard and the lane complemented state
+    static void complement( std::uint64_t a[ 25 ] )
+    {
+        a[  1 ] = ~a[  1 ];
+        a[  2 ] = ~a[  2 ];
+        a[  8 ] = ~a[  8 ];
+        a[ 12 ] = ~a[ 12 ];
+        a[ 17 ] = ~a[ 17 ];
+        a[ 20 ] = ~a[ 20 ];
+    }
+
+    static BOOST_FORCEINLINE void round( std::uint64_t const a[ 25 ], std::uint64_t e[ 25 ], std::uint64_t rc )
+    {
+        std::uint64_t const c0 = a[ 0 ] ^ a[ 5 ] ^ a[ 10 ] ^ a[ 15 ] ^ a[ 20 ];
+        std::uint64_t const c1 = a[ 1 ] ^ a[ 6 ] ^ a[ 11 ] ^ a[ 16 ] ^ a[ 21 ];
+        std::uint64_t const c2 = a[ 2 ] ^ a[ 7 ] ^ a[ 12 ] ^ a[ 17 ] ^ a[ 22 ];
+        std::uint64_t const c3 = a[ 3 ] ^ a[ 8 ] ^ a[ 13 ] ^ a[ 18 ] ^ a[ 23 ];
+        std::uint64_t const c4 = a[ 4 ] ^ a[ 9 ] ^ a[ 14 ] ^ a[ 19 ] ^ a[ 24 ];
+
+        std::uint64_t const d0 = c4 ^ detail::rotl( c1, 1 );
+        std::uint64_t const d1 = c0 ^ detail::rotl( c2, 1 );
+        std::uint64_t const d2 = c1 ^ detail::rotl( c3, 1 );
+        std::uint64_t const d3 = c2 ^ detail::rotl( c4, 1 );
+        std::uint64_t const d4 = c3 ^ detail::rotl( c0, 1 );
+
+        std::uint64_t b0, b1, b2, b3, b4;
+
+        b0 = a[  0 ] ^ d0;
+        b1 = detail::rotl( a[  6 ] ^ d1, 44 );
+        b2 = detail::rotl( a[ 12 ] ^ d2, 43 );
+        b3 = detail::rotl( a[ 18 ] ^ d3, 21 );
+        b4 = detail::rotl( a[ 24 ] ^ d4, 14 );
+
+        e[  0 ] = b0 ^ ( b1 | b2 ) ^ rc;
+        e[  1 ] = b1 ^ ( ~b2 | b3 );
+        e[  2 ] = b2 ^ ( b3 & b4 );
+        e[  3 ] = b3 ^ ( b4 | b0 );
+        e[  4 ] = b4 ^ ( b0 & b1 );
+
+        b0 = detail::rotl( a[  3 ] ^ d3, 28 );
+        b1 = detail::rotl( a[  9 ] ^ d4, 20 );
+        b2 = detail::rotl( a[ 10 ] ^ d0,  3 );
+        b3 = detail::rotl( a[ 16 ] ^ d1, 45 );
+        b4 = detail::rotl( a[ 22 ] ^ d2, 61 );
+
+        e[  5 ] = b0 ^ ( b1 | b2 );
+        e[  6 ] = b1 ^ ( b2 & b3 );
+        e[  7 ] = b2 ^ ( b3 | ~b4 );
+        e[  8 ] = b3 ^ ( b4 | b0 );
+        e[  9 ] = b4 ^ ( b0 & b1 );
+
+        b0 = detail::rotl( a[  1 ] ^ d1,  1 );
+        b1 = detail::rotl( a[  7 ] ^ d2,  6 );
+        b2 = detail::rotl( a[ 13 ] ^ d3, 25 );
+        b3 = detail::rotl( a[ 19 ] ^ d4,  8 );
+        b4 = detail::rotl( a[ 20 ] ^ d0, 18 );
+
+        e[ 10 ] = b0 ^ ( b1 | b2 );
+        e[ 11 ] = b1 ^ ( b2 & b3 );
+        e[ 12 ] = b2 ^ ( ~b3 & b4 );
+        e[ 13 ] = ~b3 ^ ( b4 | b0 );
+        e[ 14 ] = b4 ^ ( b0 & b1 );
+
+        b0 = detail::rotl( a[  4 ] ^ d4, 27 );
+        b1 = detail::rotl( a[  5 ] ^ d0, 36 );
+        b2 = detail::rotl( a[ 11 ] ^ d1, 10 );
+        b3 = detail::rotl( a[ 17 ] ^ d2, 15 );
+        b4 = detail::rotl( a[ 23 ] ^ d3, 56 );
+
+        e[ 15 ] = b0 ^ ( b1 & b2 );
+        e[ 16 ] = b1 ^ ( b2 | b3 );
+        e[ 17 ] = b2 ^ ( ~b3 | b4 );
+        e[ 18 ] = ~b3 ^ ( b4 & b0 );
+        e[ 19 ] = b4 ^ ( b0 | b1 );
+
+        b0 = detail::rotl( a[  2 ] ^ d2, 62 );
+        b1 = detail::rotl( a[  8 ] ^ d3, 55 );
+        b2 = detail::rotl( a[ 14 ] ^ d4, 39 );
+        b3 = detail::rotl( a[ 15 ] ^ d0, 41 );
+        b4 = detail::rotl( a[ 21 ] ^ d1,  2 );
+
+        e[ 20 ] = b0 ^ ( ~b1 & b2 );
+        e[ 21 ] = ~b1 ^ ( b2 | b3 );
+        e[ 22 ] = b2 ^ ( b3 & b4 );
+        e[ 23 ] = b3 ^ ( b4 | b0 );
+        e[ 24 ] = b4 ^ ( b0 & b1 );
+    }
+
+    // permutes a lane complemented state
+    static void permute( std::uint64_t a[ 25 ] )
+    {
+        std::uint64_t const * RC = keccak_constants<>::RC;
+
+        std::uint64_t e[ 25 ];
+
+        for( int i = 0; i < 24; i += 2 )
+        {
+            round( a, e, RC[ i + 0 ] );
+            round( e, a, RC[ i + 1 ] );
+        }
+    }
+
+#if defined(BOOST_HASH2_HAS_AVX2)
+
+#if defined(BOOST_HASH2_HAS_AVX512)
+
+    template<int K> static BOOST_FORCEINLINE __m256i rotl( __m256i x )
+    {
+        return _mm256_rol_epi64( x, K );
+    }
+
+    static BOOST_FORCEINLINE __m256i xor5( __m256i a, __m256i b, __m256i c, __m256i d, __m256i e )
+    {
+        return _mm256_ternarylogic_epi64( _mm256_ternarylogic_epi64( a, b, c, 0x96 ), d, e, 0x96 );
+    }
+
+    // x ^ ( ~y & z )
+    static BOOST_FORCEINLINE __m256i chi( __m256i x, __m256i y, __m256i z )
+    {
+        return _mm256_ternarylogic_epi64( x, y, z, 0xD2 );
+    }
+
+#else
+
+    template<int K> static BOOST_FORCEINLINE __m256i rotl( __m256i x )
+    {
+        return _mm256_or_si256( _mm256_slli_epi64( x, K ), _mm256_srli_epi64( x, 64 - K ) );
+    }
+
+    static BOOST_FORCEINLINE __m256i xor5( __m256i a, __m256i b, __m256i c, __m256i d, __m256i e )
+    {
+        return _mm256_xor_si256( _mm256_xor_si256( _mm256_xor_si256( a, b ), _mm256_xor_si256( c, d ) ), e );
+    }
+
+    static BOOST_FORCEINLINE __m256i chi( __m256i x, __m256i y, __m256i z )
+    {
+        return _mm256_xor_si256( x, _mm256_andnot_si256( y, z ) );
+    }
+
+#endif
+
+    static BOOST_FORCEINLINE void round_x4( __m256i const a[ 25 ], __m256i e[ 25 ], __m256i rc )
+    {
+        __m256i const c0 = xor5( a[ 0 ], a[ 5 ], a[ 10 ], a[ 15 ], a[ 20 ] );
+        __m256i const c1 = xor5( a[ 1 ], a[ 6 ], a[ 11 ], a[ 16 ], a[ 21 ] );
+        __m256i const c2 = xor5( a[ 2 ], a[ 7 ], a[ 12 ], a[ 17 ], a[ 22 ] );
+        __m256i const c3 = xor5( a[ 3 ], a[ 8 ], a[ 13 ], a[ 18 ], a[ 23 ] );
+        __m256i const c4 = xor5( a[ 4 ], a[ 9 ], a[ 14 ], a[ 19 ], a[ 24 ] );
+
+        __m256i const d0 = _mm256_xor_si256( c4, rotl<1>( c1 ) );
+        __m256i const d1 = _mm256_xor_si256( c0, rotl<1>( c2 ) );
+        __m256i const d2 = _mm256_xor_si256( c1, rotl<1>( c3 ) );
+        __m256i const d3 = _mm256_xor_si256( c2, rotl<1>( c4 ) );
+        __m256i const d4 = _mm256_xor_si256( c3, rotl<1>( c0 ) );
+
+        __m256i b0, b1, b2, b3, b4;
+
+        b0 = _mm256_xor_si256( a[  0 ], d0 );
+        b1 = rotl<44>( _mm256_xor_si256( a[  6 ], d1 ) );
+        b2 = rotl<43>( _mm256_xor_si256( a[ 12 ], d2 ) );
+        b3 = rotl<21>( _mm256_xor_si256( a[ 18 ], d3 ) );
+        b4 = rotl<14>( _mm256_xor_si256( a[ 24 ], d4 ) );
+
+        e[  0 ] = chi( b0, b1, b2 );
+        e[  1 ] = chi( b1, b2, b3 );
+        e[  2 ] = chi( b2, b3, b4 );
+        e[  3 ] = chi( b3, b4, b0 );
+        e[  4 ] = chi( b4, b0, b1 );
+
+        e[  0 ] = _mm256_xor_si256( e[ 0 ], rc );
+
+        b0 = rotl<28>( _mm256_xor_si256( a[  3 ], d3 ) );
+        b1 = rotl<20>( _mm256_xor_si256( a[  9 ], d4 ) );
+        b2 = rotl<3>( _mm256_xor_si256( a[ 10 ], d0 ) );
+        b3 = rotl<45>( _mm256_xor_si256( a[ 16 ], d1 ) );
+        b4 = rotl<61>( _mm256_xor_si256( a[ 22 ], d2 ) );
+
+        e[  5 ] = chi( b0, b1, b2 );
+        e[  6 ] = chi( b1, b2, b3 );
+        e[  7 ] = chi( b2, b3, b4 );
+        e[  8 ] = chi( b3, b4, b0 );
+        e[  9 ] = chi( b4, b0, b1 );
+
+        b0 = rotl<1>( _mm256_xor_si256( a[  1 ], d1 ) );
+        b1 = rotl<6>( _mm256_xor_si256( a[  7 ], d2 ) );
+        b2 = rotl<25>( _mm256_xor_si256( a[ 13 ], d3 ) );
+        b3 = rotl<8>( _mm256_xor_si256( a[ 19 ], d4 ) );
+        b4 = rotl<18>( _mm256_xor_si256( a[ 20 ], d0 ) );
+
+        e[ 10 ] = chi( b0, b1, b2 );
+        e[ 11 ] = chi( b1, b2, b3 );
+        e[ 12 ] = chi( b2, b3, b4 );
+        e[ 13 ] = chi( b3, b4, b0 );
+        e[ 14 ] = chi( b4, b0, b1 );
+
+        b0 = rotl<27>( _mm256_xor_si256( a[  4 ], d4 ) );
+        b1 = rotl<36>( _mm256_xor_si256( a[  5 ], d0 ) );
+        b2 = rotl<10>( _mm256_xor_si256( a[ 11 ], d1 ) );
+        b3 = rotl<15>( _mm256_xor_si256( a[ 17 ], d2 ) );
+        b4 = rotl<56>( _mm256_xor_si256( a[ 23 ], d3 ) );
+
+        e[ 15 ] = chi( b0, b1, b2 );
+        e[ 16 ] = chi( b1, b2, b3 );
+        e[ 17 ] = chi( b2, b3, b4 );
+        e[ 18 ] = chi( b3, b4, b0 );
+        e[ 19 ] = chi( b4, b0, b1 );
+
+        b0 = rotl<62>( _mm256_xor_si256( a[  2 ], d2 ) );
+        b1 = rotl<55>( _mm256_xor_si256( a[  8 ], d3 ) );
+        b2 = rotl<39>( _mm256_xor_si256( a[ 14 ], d4 ) );
+        b3 = rotl<41>( _mm256_xor_si256( a[ 15 ], d0 ) );
+        b4 = rotl<2>( _mm256_xor_si256( a[ 21 ], d1 ) );
+
+        e[ 20 ] = chi( b0, b1, b2 );
+        e[ 21 ] = chi( b1, b2, b3 );
+        e[ 22 ] = chi( b2, b3, b4 );
+        e[ 23 ] = chi( b3, b4, b0 );
+        e[ 24 ] = chi( b4, b0, b1 );
+    }
+
+    // permutes four standard states at once; lane i of state j is a[ i ][ j ]
+    static void permute_x4( std::uint64_t a[ 25 ][ 4 ] )
+    {
+        std::uint64_t const * RC = keccak_constants<>::RC;
+
+        __m256i x[ 25 ], y[ 25 ];
+
+        for( int i = 0; i < 25; ++i )
+        {
+            x[ i ] = _mm256_loadu_si256( reinterpret_cast<__m256i const*>( a[ i ] ) );
+        }
+
+        for( int i = 0; i < 24; i += 2 )
+        {
+            round_x4( x, y, _mm256_set1_epi64x( static_cast<long long>( RC[ i + 0 ] ) ) );
+            round_x4( y, x, _mm256_set1_epi64x( static_cast<long long>( RC[ i + 1 ] ) ) );
+        }
+
+        for( int i = 0; i < 25; ++i )
+        {
+            _mm256_storeu_si256( reinterpret_cast<__m256i*>( a[ i ] ), x[ i ] );
+        }
+    }
+
+#else
+
+    static void permute_x4( std::uint64_t a[ 25 ][ 4 ] )
+    {
+        for( int j = 0; j < 4; ++j )
+        {
+            std::uint64_t s[ 25 ];
+
+            for( int i = 0; i < 25; ++i ) s[ i ] = a[ i ][ j ];
+
+            complement( s );
+            permute( s );
+            complement( s );
+
+            for( int i = 0; i < 25; ++i ) a[ i ][ j ] = s[ i ];
+        }
+    }
+
+#endif // #if defined(BOOST_HASH2_HAS_AVX2)
+};
+
+// R is the rate in bytes, D the domain separation and padding bits
+
+template<int R, unsigned char D> class keccak_base
+{
+protected:
+
+    std::uint64_t state_[ 25 ]; // lane complemented
+
+    static const int N = R;
+
+    unsigned char buffer_[ N ];
+    std::size_t m_;
+
+protected:
+
+    keccak_base(): m_( 0 )
+    {
+        std::memset( state_, 0, sizeof( state_ ) );
+        keccak::complement( state_ );
+
+        std::memset( buffer_, 0, N );
+    }
+
+    void absorb( unsigned char const * p )
+    {
+        for( int i = 0; i < R / 8; ++i )
+        {
+            state_[ i ] ^= detail::read64le( p + i * 8 );
+        }
+
+        keccak::permute( state_ );
+    }
+
+    void finalize()
+    {
+        buffer_[ m_ ] ^= D;
+        buffer_[ N - 1 ] ^= 0x80;
+
+        absorb( buffer_ );
+
+        std::memset( buffer_, 0, N );
+        m_ = 0;
+    }
+
+    // copies n bytes of the rate portion of the state, starting at offset k
+    void extract( std::size_t k, unsigned char * p, std::size_t n ) const
+    {
+        BOOST_ASSERT( k + n <= static_cast<std::size_t>( N ) );
+
+        unsigned char tmp[ N ];
+
+        for( int i = 0; i < R / 8; ++i )
+        {
+            std::uint64_t w = state_[ i ];
+
+            if( keccak::is_complemented( i ) )
+            {
+                w = ~w;
+            }
+
+            detail::write64le( tmp + i * 8, w );
+        }
+
+        std::memcpy( p, tmp + k, n );
+    }
+
+public:
+
+    typedef std::uint64_t size_type;
+
+    static const int block_size = N;
+
+    void update( void const * pv, std::size_t n )
+    {
+        unsigned char const* p = static_cast<unsigned char const*>( pv );
+
+        if( n == 0 ) return;
+
+        if( m_ > 0 )
+        {
+            std::size_t k = N - m_;
+
+            if( n < k )
+            {
+                k = n;
+            }
+
+            std::memcpy( buffer_ + m_, p, k );
+
+            p += k;
+            n -= k;
+            m_ += k;
+
+            if( m_ < N ) return;
+
+            BOOST_ASSERT( m_ == N );
+
+            absorb( buffer_ );
+            m_ = 0;
+
+            std::memset( buffer_, 0, N );
+        }
+
+        BOOST_ASSERT( m_ == 0 );
+
+        while( n >= N )
+        {
+            absorb( p );
+
+            p += N;
+            n -= N;
+        }
+
+        BOOST_ASSERT( n < N );
+
+        if( n > 0 )
+        {
+            std::memcpy( buffer_, p, n );
+            m_ = n;
+        }
+    }
+};
+
+// SHA-3 with a digest of M bytes
+
+template<int M> class sha3_base: public keccak_base<200 - 2 * M, 0x06>
+{
+public:
+
+    typedef std::array<unsigned char, M> result_type;
+
+protected:
+
+    void init( unsigned char const * p, std::size_t n )
+    {
+        if( n != 0 )
+        {
+            this->update( p, n );
+            result();
+        }
+    }
+
+public:
+
+    result_type result()
+    {
+        this->finalize();
+
+        result_type digest;
+        this->extract( 0, &digest[ 0 ], M );
+
+        return digest;
+    }
+};
+
+// SHAKE; consecutive calls to result() return consecutive parts
+// of the output
+
+template<int R, int M> class shake_base: public keccak_base<R, 0x1F>
+{
+private:
+
+    bool squeezing_;
+    std::size_t k_; // bytes of the current output block already returned
+
+public:
+
+    typedef std::array<unsigned char, M> result_type;
+
+protected:
+
+    shake_base(): squeezing_( false ), k_( 0 )
+    {
+    }
+
+    void init( unsigned char const * p, std::size_t n )
+    {
+        if( n != 0 )
+        {
+            update( p, n );
+            result();
+        }
+    }
+
+public:
+
+    void update( void const * p, std::size_t n )
+    {
+        if( n == 0 ) return;
+
+        if( squeezing_ )
+        {
+            // continue absorbing into the current state
+
+            squeezing_ = false;
+            k_ = 0;
+        }
+
+        keccak_base<R, 0x1F>::update( p, n );
+    }
+
+    result_type result()
+    {
+        if( !squeezing_ )
+        {
+            this->finalize();
+
+            squeezing_ = true;
+            k_ = 0;
+        }
+
+        result_type r;
+
+        std::size_t i = 0;
+
+        while( i < M )
+        {
+            if( k_ == R )
+            {
+                keccak::permute( this->state_ );
+                k_ = 0;
+            }
+
+            std::size_t n = R - k_;
+
+            if( n > M - i )
+            {
+                n = M - i;
+            }
+
+            this->extract( k_, &r[ i ], n );
+
+            i += n;
+            k_ += n;
+        }
+
+        return r;
+    }
+};
+
+// Hashes many independent messages, four at a time
+
+template<int R, unsigned char D, int M> class keccak_x4
+{
+private:
+
+    static const int L = 4;
+    static const int N = R;
+
+    struct lane
+    {
+        unsigned char const * p; // next full block of the message
+        std::size_t blocks;      // number of full blocks left
+
+        std::size_t index;       // index of the message, or -1 when idle
+
+        unsigned char buffer[ N ]; // the padded last block
+    };
+
+    static void start( lane & ln, std::size_t index, void const * pv, std::size_t n )
+    {
+        unsigned char const* p = static_cast<unsigned char const*>( pv );
+
+        std::size_t m = n % N;
+
+        ln.p = p;
+        ln.blocks = n / N;
+
+        std::memset( ln.buffer, 0, N );
+
+        if( m != 0 )
+        {
+            std::memcpy( ln.buffer, p + ( n - m ), m );
+        }
+
+        ln.buffer[ m ] ^= D;
+        ln.buffer[ N - 1 ] ^= 0x80;
+
+        ln.index = index;
+    }
+
+public:
+
+    typedef std::array<unsigned char, M> result_type;
+
+    static const int lanes = L;
+
+    // computes r[ i ] as the digest of the n[ i ] bytes at p[ i ], i < k
+    static void hash( std::size_t k, void const * const p[], std::size_t const n[], result_type r[] )
+    {
+        std::uint64_t state[ 25 ][ L ] = {};
+
+        lane slots[ L ];
+
+        std::size_t next = 0;
+        int active = 0;
+
+        for( int j = 0; j < L; ++j )
+        {
+            if( next < k )
+            {
+                start( slots[ j ], next, p[ next ], n[ next ] );
+
+                ++next;
+                ++active;
+            }
+            else
+            {
+                slots[ j ].index = static_cast<std::size_t>( -1 );
+            }
+        }
+
+        while( active > 0 )
+        {
+            bool done[ L ] = {};
+
+            for( int j = 0; j < L; ++j )
+            {
+                lane & ln = slots[ j ];
+
+                if( ln.index == static_cast<std::size_t>( -1 ) ) continue;
+
+                unsigned char const * block;
+
+                if( ln.blocks > 0 )
+                {
+                    block = ln.p;
+
+                    ln.p += N;
+                    --ln.blocks;
+                }
+                else
+                {
+                    block = ln.buffer;
+                    done[ j ] = true;
+                }
+
+                for( int i = 0; i < R / 8; ++i )
+                {
+                    state[ i ][ j ] ^= detail::read64le( block + i * 8 );
+                }
+            }
+
+            keccak::permute_x4( state );
+
+            for( int j = 0; j < L; ++j )
+            {
+                if( !done[ j ] ) continue;
+
+                lane & ln = slots[ j ];
+
+                unsigned char tmp[ ( M + 7 ) / 8 * 8 ];
+
+                for( int i = 0; i < ( M + 7 ) / 8; ++i )
+                {
+                    detail::write64le( tmp + i * 8, state[ i ][ j ] );
+                }
+
+                std::memcpy( &r[ ln.index ][ 0 ], tmp, M );
+
+                for( int i = 0; i < 25; ++i )
+                {
+                    state[ i ][ j ] = 0;
+                }
+
+                if( next < k )
+                {
+                    start( ln, next, p[ next ], n[ next ] );
+                    ++next;
+                }
+                else
+                {
+                    ln.index = static_cast<std::size_t>( -1 );
+                    --active;
+                }
+            }
+        }
+    }
+};
+
+} // namespace detail
+
+class sha3_256: public detail::sha3_base<32>
+{
+public:
+
+    sha3_256()
+    {
+    }
+
+    explicit sha3_256( std::uint64_t seed )
+    {
+        if( seed != 0 )
+        {
+            unsigned char tmp[ 8 ];
+            detail::write64le( tmp, seed );
+
+            init( tmp, 8 );
+        }
+    }
+
+    sha3_256( unsigned char const * p, std::size_t n )
+    {
+        init( p, n );
+    }
+};
+
+class sha3_512: public detail::sha3_base<64>
+{
+public:
+
+    sha3_512()
+    {
+    }
+
+    explicit sha3_512( std::uint64_t seed )
+    {
+        if( seed != 0 )
+        {
+            unsigned char tmp[ 8 ];
+            detail::write64le( tmp, seed );
+
+            init( tmp, 8 );
+        }
+    }
+
+    sha3_512( unsigned char const * p, std::size_t n )
+    {
+        init( p, n );
+    }
+};
+
+// shake_128 returns 32 bytes of output per result() call
+
+class shake_128: public detail::shake_base<168, 32>
+{
+public:
+
+    shake_128()
+    {
+    }
+
+    explicit shake_128( std::uint64_t seed )
+    {
+        if( seed != 0 )
+        {
+            unsigned char tmp[ 8 ];
+            detail::write64le( tmp, seed );
+
+            init( tmp, 8 );
+        }
+    }
+
+    shake_128( unsigned char const * p, std::size_t n )
+    {
+        init( p, n );
+    }
+};
+
+// shake_256 returns 64 bytes of output per result() call
+
+class shake_256: public detail::shake_base<136, 64>
+{
+public:
+
+    shake_256()
+    {
+    }
+
+    explicit shake_256( std::uint64_t seed )
+    {
+        if( seed != 0 )
+        {
+            unsigned char tmp[ 8 ];
+            detail::write64le( tmp, seed );
+
+            init( tmp, 8 );
+        }
+    }
+
+    shake_256( unsigned char const * p, std::size_t n )
+    {
+        init( p, n );
+    }
+};
+
+// sha3_256_x4::hash( k, p, n, r ) computes the same digests as
+// k separate sha3_256 instances, four messages at a time
+
+class sha3_256_x4: public detail::keccak_x4<136, 0x06, 32>
+{
+};
+
+// sha3_512_x4::hash( k, p, n, r ) computes the same digests as
+// k separate sha3_512 instances, four messages at a time
+
+class sha3_512_x4: public detail::keccak_x4<72, 0x06, 64>
+{
+};
+
+} // namespace hash2
+} // namespace boost
+
+#endif // #ifndef BOOST_HASH2_SHA3_HPP_INCLUDED
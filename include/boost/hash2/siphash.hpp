@@ -19,7 +19,9 @@ namespace boost
 namespace hash2
 {
 
-class siphash_64
+// SipHash-c-d, with C rounds per message block and D finalization rounds
+
+template<int C, int D> class basic_siphash_64
 {
 private:
 
@@ -56,8 +58,10 @@ private:
 
         v3 ^= m;
 
-        sipround();
-        sipround();
+        for( int i = 0; i < C; ++i )
+        {
+            sipround();
+        }
 
         v0 ^= m;
     }
@@ -75,17 +79,42 @@ private:
         v0 ^= k0;
     }
 
+    // the tail of m bytes at p, for a total input length of n
+
+    std::uint64_t finalize( unsigned char const * p, std::size_t m, std::uint64_t n )
+    {
+        unsigned char q[ 8 ] = { 0 };
+
+        if( m > 0 )
+        {
+            std::memcpy( q, p, m );
+        }
+
+        q[ 7 ] = static_cast<unsigned char>( n & 0xFF );
+
+        update_( q );
+
+        v2 ^= 0xFF;
+
+        for( int i = 0; i < D; ++i )
+        {
+            sipround();
+        }
+
+        return v0 ^ v1 ^ v2 ^ v3;
+    }
+
 public:
 
     typedef std::uint64_t result_type;
     typedef std::uint64_t size_type;
 
-    explicit siphash_64( std::uint64_t k0 = 0, std::uint64_t k1 = 0 ): m_( 0 ), n_( 0 )
+    explicit basic_siphash_64( std::uint64_t k0 = 0, std::uint64_t k1 = 0 ): m_( 0 ), n_( 0 )
     {
         init( k0, k1 );
     }
 
-    siphash_64( unsigned char const * p, std::size_t n ): m_( 0 ), n_( 0 )
+    basic_siphash_64( unsigned char const * p, std::size_t n ): m_( 0 ), n_( 0 )
     {
         if( n == 0 )
         {
@@ -174,22 +203,39 @@ public:
         BOOST_ASSERT( m_ == n_ % 8 );
     }
 
-    std::uint64_t result()
+    // update( p, N ), with the length known at compile time
+
+    template<std::size_t N> void update_fixed( unsigned char const * p )
     {
         BOOST_ASSERT( m_ == n_ % 8 );
 
-        std::memset( buffer_ + m_, 0, 8 - m_ );
+        if( N % 8 == 0 && m_ == 0 )
+        {
+            for( std::size_t i = 0; i < N / 8; ++i )
+            {
+                update_( p + 8 * i );
+            }
 
-        buffer_[ 7 ] = static_cast<unsigned char>( n_ & 0xFF );
+            n_ += N;
+        }
+        else if( N < 8 && m_ < 8 - N )
+        {
+            std::memcpy( buffer_ + m_, p, N );
 
-        update_( buffer_ );
+            m_ += N;
+            n_ += N;
+        }
+        else
+        {
+            update( p, N );
+        }
+    }
 
-        v2 ^= 0xFF;
+    std::uint64_t result()
+    {
+        BOOST_ASSERT( m_ == n_ % 8 );
 
-        sipround();
-        sipround();
-        sipround();
-        sipround();
+        std::uint64_t r = finalize( buffer_, m_, n_ );
 
         n_ += 8 - m_;
         m_ = 0;
@@ -197,11 +243,38 @@ public:
         // clear buffered plaintext
         std::memset( buffer_, 0, 8 );
 
-        return v0 ^ v1 ^ v2 ^ v3;
+        return r;
+    }
+
+    // hashes p[0..n) directly, without buffering; the result is the
+    // same as that of update( p, n ) and result() on basic_siphash_64( k0, k1 )
+
+    static std::uint64_t hash( void const * pv, std::size_t n, std::uint64_t k0 = 0, std::uint64_t k1 = 0 )
+    {
+        unsigned char const* p = static_cast<unsigned char const*>( pv );
+
+        basic_siphash_64 h( k0, k1 );
+
+        std::size_t k = n / 8;
+
+        for( std::size_t i = 0; i < k; ++i, p += 8 )
+        {
+            h.update_( p );
+        }
+
+        return h.finalize( p, n % 8, static_cast<std::uint64_t>( n ) );
     }
 };
 
-class siphash_32
+// SipHash-2-4
+typedef basic_siphash_64<2, 4> siphash_64;
+
+// SipHash-1-3, as used by hash tables in Rust, Python and Linux
+typedef basic_siphash_64<1, 3> siphash13_64;
+
+// HalfSipHash-c-d, the 32 bit variant
+
+template<int C, int D> class basic_siphash_32
 {
 private:
 
@@ -238,8 +311,10 @@ private:
 
         v3 ^= m;
 
-        sipround();
-        sipround();
+        for( int i = 0; i < C; ++i )
+        {
+            sipround();
+        }
 
         v0 ^= m;
     }
@@ -257,12 +332,37 @@ private:
         v0 ^= k0;
     }
 
+    // the tail of m bytes at p, for a total input length of n
+
+    std::uint32_t finalize( unsigned char const * p, std::size_t m, std::uint32_t n )
+    {
+        unsigned char q[ 4 ] = { 0 };
+
+        if( m > 0 )
+        {
+            std::memcpy( q, p, m );
+        }
+
+        q[ 3 ] = static_cast<unsigned char>( n & 0xFF );
+
+        update_( q );
+
+        v2 ^= 0xFF;
+
+        for( int i = 0; i < D; ++i )
+        {
+            sipround();
+        }
+
+        return v1 ^ v3;
+    }
+
 public:
 
     typedef std::uint32_t result_type;
     typedef std::uint32_t size_type;
 
-    explicit siphash_32( std::uint64_t seed = 0 ): m_( 0 ), n_( 0 )
+    explicit basic_siphash_32( std::uint64_t seed = 0 ): m_( 0 ), n_( 0 )
     {
         std::uint32_t k0 = static_cast<std::uint32_t>( seed );
         std::uint32_t k1 = static_cast<std::uint32_t>( seed >> 32 );
@@ -270,12 +370,12 @@ public:
         init( k0, k1 );
     }
 
-    siphash_32( std::uint32_t k0, std::uint32_t k1 ): m_( 0 ), n_( 0 )
+    basic_siphash_32( std::uint32_t k0, std::uint32_t k1 ): m_( 0 ), n_( 0 )
     {
         init( k0, k1 );
     }
 
-    siphash_32( unsigned char const * p, std::size_t n ): m_( 0 ), n_( 0 )
+    basic_siphash_32( unsigned char const * p, std::size_t n ): m_( 0 ), n_( 0 )
     {
         if( n == 0 )
         {
@@ -364,22 +464,39 @@ public:
         BOOST_ASSERT( m_ == n_ % 4 );
     }
 
-    std::uint32_t result()
+    // update( p, N ), with the length known at compile time
+
+    template<std::size_t N> void update_fixed( unsigned char const * p )
     {
         BOOST_ASSERT( m_ == n_ % 4 );
 
-        std::memset( buffer_ + m_, 0, 4 - m_ );
+        if( N % 4 == 0 && m_ == 0 )
+        {
+            for( std::size_t i = 0; i < N / 4; ++i )
+            {
+                update_( p + 4 * i );
+            }
 
-        buffer_[ 3 ] = static_cast<unsigned char>( n_ & 0xFF );
+            n_ += static_cast<std::uint32_t>( N );
+        }
+        else if( N < 4 && m_ < 4 - N )
+        {
+            std::memcpy( buffer_ + m_, p, N );
 
-        update_( buffer_ );
+            m_ += static_cast<std::uint32_t>( N );
+            n_ += static_cast<std::uint32_t>( N );
+        }
+        else
+        {
+            update( p, N );
+        }
+    }
 
-        v2 ^= 0xFF;
+    std::uint32_t result()
+    {
+        BOOST_ASSERT( m_ == n_ % 4 );
 
-        sipround();
-        sipround();
-        sipround();
-        sipround();
+        std::uint32_t r = finalize( buffer_, m_, n_ );
 
         n_ += 4 - m_;
         m_ = 0;
@@ -387,10 +504,35 @@ public:
         // clear buffered plaintext
         std::memset( buffer_, 0, 4 );
 
-        return v1 ^ v3;
+        return r;
+    }
+
+    // hashes p[0..n) directly, without buffering; the result is the
+    // same as that of update( p, n ) and result() on basic_siphash_32( seed )
+
+    static std::uint32_t hash( void const * pv, std::size_t n, std::uint64_t seed = 0 )
+    {
+        unsigned char const* p = static_cast<unsigned char const*>( pv );
+
+        basic_siphash_32 h( seed );
+
+        std::size_t k = n / 4;
+
+        for( std::size_t i = 0; i < k; ++i, p += 4 )
+        {
+            h.update_( p );
+        }
+
+        return h.finalize( p, n % 4, static_cast<std::uint32_t>( n ) );
     }
 };
 
+// HalfSipHash-2-4
+typedef basic_siphash_32<2, 4> siphash_32;
+
+// HalfSipHash-1-3
+typedef basic_siphash_32<1, 3> siphash13_32;
+
 } // namespace hash2
 } // namespace boost
 
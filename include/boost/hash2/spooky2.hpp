@@ -239,6 +239,71 @@ public:
     typedef std::array<unsigned char, 16> result_type;
     typedef std::uint64_t size_type;
 
+private:
+
+    // the tail of m bytes at p, for a total input length of n
+
+    result_type finalize( unsigned char const * p, std::size_t m, std::size_t n )
+    {
+        std::uint64_t h0 = v_[ 0 ];
+        std::uint64_t h1 = v_[ 1 ];
+
+        if( n < N )
+        {
+            short_hash( p, n, h0, h1 );
+        }
+        else
+        {
+            std::uint64_t h2  = v_[  2 ];
+            std::uint64_t h3  = v_[  3 ];
+            std::uint64_t h4  = v_[  4 ];
+            std::uint64_t h5  = v_[  5 ];
+            std::uint64_t h6  = v_[  6 ];
+            std::uint64_t h7  = v_[  7 ];
+            std::uint64_t h8  = v_[  8 ];
+            std::uint64_t h9  = v_[  9 ];
+            std::uint64_t h10 = v_[ 10 ];
+            std::uint64_t h11 = v_[ 11 ];
+
+            if( m >= 96 )
+            {
+                mix( p, h0, h1, h2, h3, h4, h5, h6, h7, h8, h9, h10, h11 );
+
+                p += 96;
+                m -= 96;
+            }
+
+            unsigned char tmp[ 96 ] = { 0 };
+            std::memcpy( tmp, p, m );
+            tmp[ 95 ] = static_cast<unsigned char>( m & 0xFF );
+
+            end( tmp, h0, h1, h2, h3, h4, h5, h6, h7, h8, h9, h10, h11 );
+
+            v_[  2 ] = h2;
+            v_[  3 ] = h3;
+            v_[  4 ] = h4;
+            v_[  5 ] = h5;
+            v_[  6 ] = h6;
+            v_[  7 ] = h7;
+            v_[  8 ] = h8;
+            v_[  9 ] = h9;
+            v_[ 10 ] = h10;
+            v_[ 11 ] = h11;
+        }
+
+        v_[ 0 ] = h0;
+        v_[ 1 ] = h1;
+
+        result_type r;
+
+        detail::write64le( &r[ 0 ], h0 );
+        detail::write64le( &r[ 8 ], h1 );
+
+        return r;
+    }
+
+public:
+
     explicit spooky2_128( std::uint64_t seed1 = 0, std::uint64_t seed2 = 0 ): m_( 0 ), n_( 0 )
     {
         init( seed1, seed2 );
@@ -334,56 +399,7 @@ public:
     {
         BOOST_ASSERT( m_ == n_ % N );
 
-        std::uint64_t h0 = v_[ 0 ];
-        std::uint64_t h1 = v_[ 1 ];
-
-        if( n_ < N )
-        {
-            short_hash( buffer_, n_, h0, h1 );
-        }
-        else
-        {
-            std::uint64_t h2  = v_[  2 ];
-            std::uint64_t h3  = v_[  3 ];
-            std::uint64_t h4  = v_[  4 ];
-            std::uint64_t h5  = v_[  5 ];
-            std::uint64_t h6  = v_[  6 ];
-            std::uint64_t h7  = v_[  7 ];
-            std::uint64_t h8  = v_[  8 ];
-            std::uint64_t h9  = v_[  9 ];
-            std::uint64_t h10 = v_[ 10 ];
-            std::uint64_t h11 = v_[ 11 ];
-
-            unsigned char * p = buffer_;
-            std::size_t m = m_;
-
-            if( m >= 96 )
-            {
-                mix( p, h0, h1, h2, h3, h4, h5, h6, h7, h8, h9, h10, h11 );
-
-                p += 96;
-                m -= 96;
-            }
-
-            std::memset( p + m, 0, 96 - m );
-            p[ 95 ] = static_cast<unsigned char>( m & 0xFF );
-
-            end( p, h0, h1, h2, h3, h4, h5, h6, h7, h8, h9, h10, h11 );
-
-            v_[  2 ] = h2;
-            v_[  3 ] = h3;
-            v_[  4 ] = h4;
-            v_[  5 ] = h5;
-            v_[  6 ] = h6;
-            v_[  7 ] = h7;
-            v_[  8 ] = h8;
-            v_[  9 ] = h9;
-            v_[ 10 ] = h10;
-            v_[ 11 ] = h11;
-        }
-
-        v_[ 0 ] = h0;
-        v_[ 1 ] = h1;
+        result_type r = finalize( buffer_, m_, n_ );
 
         n_ += N - m_;
         m_ = 0;
@@ -396,12 +412,22 @@ public:
         // clear buffered plaintext
         std::memset( buffer_, 0, N );
 
-        result_type r;
+        return r;
+    }
 
-        detail::write64le( &r[ 0 ], h0 );
-        detail::write64le( &r[ 8 ], h1 );
+    // hashes p[0..n) directly, without buffering; the result is the same
+    // as that of update( p, n ) and result() on spooky2_128( seed1, seed2 )
 
-        return r;
+    static result_type hash( void const * pv, std::size_t n, std::uint64_t seed1 = 0, std::uint64_t seed2 = 0 )
+    {
+        unsigned char const* p = static_cast<unsigned char const*>( pv );
+
+        spooky2_128 h( seed1, seed2 );
+
+        std::size_t k = n / N;
+        h.update_( p, k * 2 );
+
+        return h.finalize( p + k * N, n % N, n );
     }
 };
 
@@ -0,0 +1,143 @@
+#ifndef BOOST_HASH2_TABULATION_HPP_INCLUDED
+#define BOOST_HASH2_TABULATION_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// Simple and twisted tabulation hashing of 64 bit keys,
+// https://arxiv.org/abs/1011.5200, https://arxiv.org/abs/1505.01523
+
+#include <boost/hash2/detail/integer_hash.hpp>
+#include <boost/config.hpp>
+#include <cstdint>
+#include <cstddef>
+
+namespace boost
+{
+namespace hash2
+{
+
+// The key is split into eight bytes, each selecting an entry of its own
+// table of random words, and the entries are xor-ed together. The 16K
+// of tables are filled from the seed; the family is 3-independent.
+//
+// operator()( x ) hashes a single key directly; update() and result()
+// hash arbitrary input as described in detail/integer_hash.hpp. Copies
+// include the tables, so keep a seeded object and call operator().
+
+class tabulation_64: public detail::integer_hash_base<tabulation_64>
+{
+private:
+
+    std::uint64_t t_[ 8 ][ 256 ];
+
+    void init( std::uint64_t seed )
+    {
+        for( int i = 0; i < 8; ++i )
+        {
+            for( int j = 0; j < 256; ++j )
+            {
+                t_[ i ][ j ] = detail::splitmix64( seed );
+            }
+        }
+    }
+
+public:
+
+    explicit tabulation_64( std::uint64_t seed = 0 )
+    {
+        init( seed );
+    }
+
+    tabulation_64( unsigned char const * p, std::size_t n )
+    {
+        init( detail::integer_hash_seed( p, n ) );
+    }
+
+    BOOST_FORCEINLINE std::uint64_t operator()( std::uint64_t x ) const
+    {
+        return
+            t_[ 0 ][ ( x >>  0 ) & 0xFF ] ^
+            t_[ 1 ][ ( x >>  8 ) & 0xFF ] ^
+            t_[ 2 ][ ( x >> 16 ) & 0xFF ] ^
+            t_[ 3 ][ ( x >> 24 ) & 0xFF ] ^
+            t_[ 4 ][ ( x >> 32 ) & 0xFF ] ^
+            t_[ 5 ][ ( x >> 40 ) & 0xFF ] ^
+            t_[ 6 ][ ( x >> 48 ) & 0xFF ] ^
+            t_[ 7 ][ ( x >> 56 ) & 0xFF ];
+    }
+};
+
+// Twisted tabulation also derives an eight bit "twister" from the first
+// seven bytes, which is xor-ed into the last byte before its lookup. This
+// gives Chernoff-style concentration bounds that simple tabulation lacks.
+// t_ and u_ are the low 64 bits and the low 8 bits, respectively, of the
+// 72 bit table entries of the paper, whose results are shifted right by 8
+
+class twisted_tabulation_64: public detail::integer_hash_base<twisted_tabulation_64>
+{
+private:
+
+    std::uint64_t t_[ 8 ][ 256 ];
+    unsigned char u_[ 7 ][ 256 ];
+
+    void init( std::uint64_t seed )
+    {
+        for( int i = 0; i < 8; ++i )
+        {
+            for( int j = 0; j < 256; ++j )
+            {
+                t_[ i ][ j ] = detail::splitmix64( seed );
+            }
+        }
+
+        for( int i = 0; i < 7; ++i )
+        {
+            for( int j = 0; j < 256; ++j )
+            {
+                u_[ i ][ j ] = static_cast<unsigned char>( detail::splitmix64( seed ) >> 56 );
+            }
+        }
+    }
+
+public:
+
+    explicit twisted_tabulation_64( std::uint64_t seed = 0 )
+    {
+        init( seed );
+    }
+
+    twisted_tabulation_64( unsigned char const * p, std::size_t n )
+    {
+        init( detail::integer_hash_seed( p, n ) );
+    }
+
+    BOOST_FORCEINLINE std::uint64_t operator()( std::uint64_t x ) const
+    {
+        std::uint64_t h =
+            t_[ 0 ][ ( x >>  0 ) & 0xFF ] ^
+            t_[ 1 ][ ( x >>  8 ) & 0xFF ] ^
+            t_[ 2 ][ ( x >> 16 ) & 0xFF ] ^
+            t_[ 3 ][ ( x >> 24 ) & 0xFF ] ^
+            t_[ 4 ][ ( x >> 32 ) & 0xFF ] ^
+            t_[ 5 ][ ( x >> 40 ) & 0xFF ] ^
+            t_[ 6 ][ ( x >> 48 ) & 0xFF ];
+
+        unsigned u =
+            u_[ 0 ][ ( x >>  0 ) & 0xFF ] ^
+            u_[ 1 ][ ( x >>  8 ) & 0xFF ] ^
+            u_[ 2 ][ ( x >> 16 ) & 0xFF ] ^
+            u_[ 3 ][ ( x >> 24 ) & 0xFF ] ^
+            u_[ 4 ][ ( x >> 32 ) & 0xFF ] ^
+            u_[ 5 ][ ( x >> 40 ) & 0xFF ] ^
+            u_[ 6 ][ ( x >> 48 ) & 0xFF ];
+
+        return h ^ t_[ 7 ][ ( x >> 56 ) ^ u ];
+    }
+};
+
+} // namespace hash2
+} // namespace boost
+
+#endif // #ifndef BOOST_HASH2_TABULATION_HPP_INCLUDED
@@ -0,0 +1,257 @@
+#ifndef BOOST_HASH2_WYHASH_HPP_INCLUDED
+#define BOOST_HASH2_WYHASH_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// wyhash (final version 4), https://github.com/wangyi-fudan/wyhash
+
+#include <boost/hash2/detail/read.hpp>
+#include <boost/hash2/detail/mul128.hpp>
+#include <boost/assert.hpp>
+#include <cstdint>
+#include <cstring>
+#include <cstddef>
+
+namespace boost
+{
+namespace hash2
+{
+
+class wyhash_64
+{
+private:
+
+    static const std::uint64_t S0 = 0xA0761D6478BD642Full;
+    static const std::uint64_t S1 = 0xE7037ED1A0B428DBull;
+    static const std::uint64_t S2 = 0x8EBC6AF09C88C6E3ull;
+    static const std::uint64_t S3 = 0x589965CC75374CC3ull;
+
+private:
+
+    std::uint64_t seed_, see1_, see2_;
+
+    // the 16 bytes preceding the unprocessed input, followed by
+    // the unprocessed input; a 48 byte block is only processed
+    // once more input follows it, as the last block goes through
+    // the tail path
+    unsigned char buffer_[ 64 ];
+    std::size_t m_; // <= 48
+
+    std::uint64_t n_;
+
+private:
+
+    void init( std::uint64_t seed )
+    {
+        seed ^= detail::mulx( seed ^ S0, S1 );
+
+        seed_ = seed;
+        see1_ = seed;
+        see2_ = seed;
+
+        std::memset( buffer_, 0, 64 );
+        m_ = 0;
+
+        n_ = 0;
+    }
+
+    static void update_( unsigned char const * p, std::uint64_t & seed, std::uint64_t & see1, std::uint64_t & see2 )
+    {
+        seed = detail::mulx( detail::read64le( p +  0 ) ^ S1, detail::read64le( p +  8 ) ^ seed );
+        see1 = detail::mulx( detail::read64le( p + 16 ) ^ S2, detail::read64le( p + 24 ) ^ see1 );
+        see2 = detail::mulx( detail::read64le( p + 32 ) ^ S3, detail::read64le( p + 40 ) ^ see2 );
+    }
+
+    void update_( unsigned char const * p )
+    {
+        update_( p, seed_, see1_, see2_ );
+    }
+
+    static std::uint64_t read3( unsigned char const * p, std::size_t k )
+    {
+        return ( static_cast<std::uint64_t>( p[ 0 ] ) << 16 ) | ( static_cast<std::uint64_t>( p[ k >> 1 ] ) << 8 ) | p[ k - 1 ];
+    }
+
+    // the last i bytes at p, for a total input length of n; when n > 48,
+    // the 16 bytes preceding p must be the input preceding them
+
+    static std::uint64_t finalize( std::uint64_t seed, std::uint64_t see1, std::uint64_t see2, unsigned char const * p, std::size_t i, std::uint64_t n )
+    {
+        std::uint64_t a, b;
+
+        if( n <= 16 )
+        {
+            if( i >= 4 )
+            {
+                std::size_t k = ( i >> 3 ) << 2;
+
+                a = ( static_cast<std::uint64_t>( detail::read32le( p ) ) << 32 ) | detail::read32le( p + k );
+                b = ( static_cast<std::uint64_t>( detail::read32le( p + i - 4 ) ) << 32 ) | detail::read32le( p + i - 4 - k );
+            }
+            else if( i > 0 )
+            {
+                a = read3( p, i );
+                b = 0;
+            }
+            else
+            {
+                a = b = 0;
+            }
+        }
+        else
+        {
+            if( n > 48 )
+            {
+                seed ^= see1 ^ see2;
+            }
+
+            while( i > 16 )
+            {
+                seed = detail::mulx( detail::read64le( p ) ^ S1, detail::read64le( p + 8 ) ^ seed );
+
+                p += 16;
+                i -= 16;
+            }
+
+            // the last 16 bytes of the input, which may
+            // overlap with those already processed
+            a = detail::read64le( p + i - 16 );
+            b = detail::read64le( p + i - 8 );
+        }
+
+        detail::uint128 r = detail::mul128( a ^ S1, b ^ seed );
+
+        return detail::mulx( r.low ^ S0 ^ n, r.high ^ S1 );
+    }
+
+public:
+
+    typedef std::uint64_t result_type;
+    typedef std::uint64_t size_type;
+
+    explicit wyhash_64( std::uint64_t seed = 0 )
+    {
+        init( seed );
+    }
+
+    wyhash_64( unsigned char const * p, std::size_t n )
+    {
+        if( n == 0 )
+        {
+            init( 0 );
+        }
+        else if( n <= 8 )
+        {
+            unsigned char q[ 8 ] = {};
+            std::memcpy( q, p, n );
+
+            std::uint64_t seed = detail::read64le( q );
+            init( seed );
+        }
+        else
+        {
+            std::uint64_t seed = detail::read64le( p );
+            init( seed );
+
+            p += 8;
+            n -= 8;
+
+            update( p, n );
+            result();
+        }
+    }
+
+    void update( void const * pv, std::size_t n )
+    {
+        unsigned char const* p = static_cast<unsigned char const*>( pv );
+
+        if( n == 0 ) return;
+
+        n_ += n;
+
+        if( m_ + n <= 48 )
+        {
+            std::memcpy( buffer_ + 16 + m_, p, n );
+            m_ += n;
+
+            return;
+        }
+
+        if( m_ > 0 )
+        {
+            std::size_t k = 48 - m_;
+
+            std::memcpy( buffer_ + 16 + m_, p, k );
+
+            p += k;
+            n -= k;
+
+            BOOST_ASSERT( n > 0 );
+
+            update_( buffer_ + 16 );
+            std::memcpy( buffer_, buffer_ + 48, 16 );
+
+            m_ = 0;
+        }
+
+        if( n > 48 )
+        {
+            do
+            {
+                update_( p );
+
+                p += 48;
+                n -= 48;
+            }
+            while( n > 48 );
+
+            std::memcpy( buffer_, p - 16, 16 );
+        }
+
+        std::memcpy( buffer_ + 16, p, n );
+        m_ = n;
+    }
+
+    std::uint64_t result()
+    {
+        std::uint64_t h = finalize( seed_, see1_, see2_, buffer_ + 16, m_, n_ );
+
+        // restart from a state seeded with the result; this
+        // also clears the buffered plaintext
+        init( h );
+
+        return h;
+    }
+
+    // hashes p[0..n) directly, without buffering; the result is the
+    // same as that of update( p, n ) and result() on wyhash_64( seed )
+
+    static std::uint64_t hash( void const * pv, std::size_t n, std::uint64_t seed = 0 )
+    {
+        unsigned char const* p = static_cast<unsigned char const*>( pv );
+
+        seed ^= detail::mulx( seed ^ S0, S1 );
+
+        std::uint64_t see1 = seed;
+        std::uint64_t see2 = seed;
+
+        std::size_t i = n;
+
+        while( i > 48 )
+        {
+            update_( p, seed, see1, see2 );
+
+            p += 48;
+            i -= 48;
+        }
+
+        return finalize( seed, see1, see2, p, i, n );
+    }
+};
+
+} // namespace hash2
+} // namespace boost
+
+#endif // #ifndef BOOST_HASH2_WYHASH_HPP_INCLUDED
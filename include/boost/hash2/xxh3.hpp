@@ -0,0 +1,991 @@
+#ifndef BOOST_HASH2_XXH3_HPP_INCLUDED
+#define BOOST_HASH2_XXH3_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// XXH3, https://github.com/Cyan4973/xxHash/blob/dev/doc/xxhash_spec.md
+
+#include <boost/hash2/detail/config.hpp>
+#include <boost/hash2/detail/intrin.hpp>
+#include <boost/hash2/detail/read.hpp>
+#include <boost/hash2/detail/write.hpp>
+#include <boost/hash2/detail/rot.hpp>
+#include <boost/hash2/detail/mul128.hpp>
+#include <boost/assert.hpp>
+#include <cstdint>
+#include <array>
+#include <cstring>
+#include <cstddef>
+
+namespace boost
+{
+namespace hash2
+{
+
+namespace detail
+{
+
+template<class = void> struct xxh3_constants
+{
+    static const unsigned char default_secret[ 192 ];
+};
+
+template<class T> const unsigned char xxh3_constants<T>::default_secret[ 192 ] =
+{
+    0xb8, 0xfe, 0x6c, 0x39, 0x23, 0xa4, 0x4b, 0xbe, 0x7c, 0x01, 0x81, 0x2c, 0xf7, 0x21, 0xad, 0x1c,
+    0xde, 0xd4, 0x6d, 0xe9, 0x83, 0x90, 0x97, 0xdb, 0x72, 0x40, 0xa4, 0xa4, 0xb7, 0xb3, 0x67, 0x1f,
+    0xcb, 0x79, 0xe6, 0x4e, 0xcc, 0xc0, 0xe5, 0x78, 0x82, 0x5a, 0xd0, 0x7d, 0xcc, 0xff, 0x72, 0x21,
+    0xb8, 0x08, 0x46, 0x74, 0xf7, 0x43, 0x24, 0x8e, 0xe0, 0x35, 0x90, 0xe6, 0x81, 0x3a, 0x26, 0x4c,
+    0x3c, 0x28, 0x52, 0xbb, 0x91, 0xc3, 0x00, 0xcb, 0x88, 0xd0, 0x65, 0x8b, 0x1b, 0x53, 0x2e, 0xa3,
+    0x71, 0x64, 0x48, 0x97, 0xa2, 0x0d, 0xf9, 0x4e, 0x38, 0x19, 0xef, 0x46, 0xa9, 0xde, 0xac, 0xd8,
+    0xa8, 0xfa, 0x76, 0x3f, 0xe3, 0x9c, 0x34, 0x3f, 0xf9, 0xdc, 0xbb, 0xc7, 0xc7, 0x0b, 0x4f, 0x1d,
+    0x8a, 0x51, 0xe0, 0x4b, 0xcd, 0xb4, 0x59, 0x31, 0xc8, 0x9f, 0x7e, 0xc9, 0xd9, 0x78, 0x73, 0x64,
+    0xea, 0xc5, 0xac, 0x83, 0x34, 0xd3, 0xeb, 0xc3, 0xc5, 0x81, 0xa0, 0xff, 0xfa, 0x13, 0x63, 0xeb,
+    0x17, 0x0d, 0xdd, 0x51, 0xb7, 0xf0, 0xda, 0x49, 0xd3, 0x16, 0x55, 0x26, 0x29, 0xd4, 0x68, 0x9e,
+    0x2b, 0x16, 0xbe, 0x58, 0x7d, 0x47, 0xa1, 0xfc, 0x8f, 0xf8, 0xb8, 0xd1, 0x7a, 0xd0, 0x31, 0xce,
+    0x45, 0xcb, 0x3a, 0x8f, 0x95, 0x16, 0x04, 0x28, 0xaf, 0xd7, 0xfb, 0xca, 0xbb, 0x4b, 0x40, 0x7e,
+};
+
+class xxh3_base
+{
+protected:
+
+    static const std::size_t secret_size = 192;
+    static const std::size_t min_secret_size = 136;
+
+    static const std::size_t stripe_size = 64;
+    static const std::size_t stripes_per_block = ( secret_size - stripe_size ) / 8;
+
+    static const std::size_t short_size = 240;
+
+    static const std::size_t N = 256; // buffer size, four stripes
+
+    static const std::uint32_t P32_1 = 0x9E3779B1U;
+    static const std::uint32_t P32_2 = 0x85EBCA77U;
+    static const std::uint32_t P32_3 = 0xC2B2AE3DU;
+
+    static const std::uint64_t P64_1 = 0x9E3779B185EBCA87ULL;
+    static const std::uint64_t P64_2 = 0xC2B2AE3D27D4EB4FULL;
+    static const std::uint64_t P64_3 = 0x165667B19E3779F9ULL;
+    static const std::uint64_t P64_4 = 0x85EBCA77C2B2AE63ULL;
+    static const std::uint64_t P64_5 = 0x27D4EB2F165667C5ULL;
+
+    static const std::uint64_t PMX_1 = 0x165667919E3779F9ULL;
+    static const std::uint64_t PMX_2 = 0x9FB21C651E98DF25ULL;
+
+protected:
+
+    // secret_ is used by the long input path; the short input path
+    // uses the default secret with seed_, unless with_secret_ is set
+
+    unsigned char secret_[ secret_size ];
+    std::uint64_t seed_;
+    bool with_secret_;
+
+    std::uint64_t acc_[ 8 ];
+
+    unsigned char buffer_[ N ];
+    std::size_t m_; // buffered bytes, 0 < m_ <= N unless n_ == 0
+
+    std::size_t stripes_; // stripes consumed in the current block
+
+    std::uint64_t n_;
+
+protected:
+
+    static std::uint32_t bswap32( std::uint32_t v )
+    {
+        return ( v >> 24 ) | ( ( v >> 8 ) & 0xFF00u ) | ( ( v << 8 ) & 0xFF0000u ) | ( v << 24 );
+    }
+
+    static std::uint64_t bswap64( std::uint64_t v )
+    {
+        return ( static_cast<std::uint64_t>( bswap32( static_cast<std::uint32_t>( v ) ) ) << 32 ) | bswap32( static_cast<std::uint32_t>( v >> 32 ) );
+    }
+
+    static std::uint64_t xxh64_avalanche( std::uint64_t h )
+    {
+        h ^= h >> 33;
+        h *= P64_2;
+        h ^= h >> 29;
+        h *= P64_3;
+        h ^= h >> 32;
+
+        return h;
+    }
+
+    static std::uint64_t avalanche( std::uint64_t h )
+    {
+        h ^= h >> 37;
+        h *= PMX_1;
+        h ^= h >> 32;
+
+        return h;
+    }
+
+    static std::uint64_t rrmxmx( std::uint64_t h, std::uint64_t n )
+    {
+        h ^= detail::rotl( h, 49 ) ^ detail::rotl( h, 24 );
+        h *= PMX_2;
+        h ^= ( h >> 35 ) + n;
+        h *= PMX_2;
+        h ^= h >> 28;
+
+        return h;
+    }
+
+    static BOOST_FORCEINLINE std::uint64_t mix16( unsigned char const * p, unsigned char const * secret, std::uint64_t seed )
+    {
+        std::uint64_t lo = detail::read64le( p + 0 ) ^ ( detail::read64le( secret + 0 ) + seed );
+        std::uint64_t hi = detail::read64le( p + 8 ) ^ ( detail::read64le( secret + 8 ) - seed );
+
+        return detail::mulx( lo, hi );
+    }
+
+    static BOOST_FORCEINLINE void mix32( detail::uint128 & acc, unsigned char const * p1, unsigned char const * p2, unsigned char const * secret, std::uint64_t seed )
+    {
+        acc.low += mix16( p1, secret, seed );
+        acc.low ^= detail::read64le( p2 ) + detail::read64le( p2 + 8 );
+
+        acc.high += mix16( p2, secret + 16, seed );
+        acc.high ^= detail::read64le( p1 ) + detail::read64le( p1 + 8 );
+    }
+
+    // long input kernels
+
+    static void accumulate_512( std::uint64_t * acc, unsigned char const * p, unsigned char const * secret )
+    {
+        for( int i = 0; i < 8; ++i )
+        {
+            std::uint64_t v = detail::read64le( p + 8 * i );
+            std::uint64_t k = v ^ detail::read64le( secret + 8 * i );
+
+            acc[ i ^ 1 ] += v;
+            acc[ i ] += ( k & 0xFFFFFFFFu ) * ( k >> 32 );
+        }
+    }
+
+#if defined(BOOST_HASH2_HAS_AVX512)
+
+    static void accumulate( std::uint64_t * acc, unsigned char const * p, unsigned char const * secret, std::size_t k )
+    {
+        __m512i a = _mm512_loadu_si512( acc );
+
+        for( std::size_t i = 0; i < k; ++i, p += stripe_size, secret += 8 )
+        {
+            __m512i v = _mm512_loadu_si512( p );
+            __m512i k2 = _mm512_xor_si512( v, _mm512_loadu_si512( secret ) );
+
+            __m512i kh = _mm512_shuffle_epi32( k2, static_cast<_MM_PERM_ENUM>( _MM_SHUFFLE( 0, 3, 0, 1 ) ) );
+            __m512i vs = _mm512_shuffle_epi32( v, static_cast<_MM_PERM_ENUM>( _MM_SHUFFLE( 1, 0, 3, 2 ) ) );
+
+            a = _mm512_add_epi64( a, _mm512_add_epi64( _mm512_mul_epu32( k2, kh ), vs ) );
+        }
+
+        _mm512_storeu_si512( acc, a );
+    }
+
+    static void scramble( std::uint64_t * acc, unsigned char const * secret )
+    {
+        __m512i const prime = _mm512_set1_epi32( static_cast<int>( P32_1 ) );
+
+        __m512i a = _mm512_loadu_si512( acc );
+
+        // a ^ (a >> 47) ^ secret
+        a = _mm512_ternarylogic_epi32( a, _mm512_srli_epi64( a, 47 ), _mm512_loadu_si512( secret ), 0x96 );
+
+        __m512i lo = _mm512_mul_epu32( a, prime );
+        __m512i hi = _mm512_mul_epu32( _mm512_srli_epi64( a, 32 ), prime );
+
+        _mm512_storeu_si512( acc, _mm512_add_epi64( lo, _mm512_slli_epi64( hi, 32 ) ) );
+    }
+
+#elif defined(BOOST_HASH2_HAS_AVX2)
+
+    static void accumulate( std::uint64_t * acc, unsigned char const * p, unsigned char const * secret, std::size_t k )
+    {
+        __m256i a0 = _mm256_loadu_si256( reinterpret_cast<__m256i const*>( acc + 0 ) );
+        __m256i a1 = _mm256_loadu_si256( reinterpret_cast<__m256i const*>( acc + 4 ) );
+
+        for( std::size_t i = 0; i < k; ++i, p += stripe_size, secret += 8 )
+        {
+            __m256i v0 = _mm256_loadu_si256( reinterpret_cast<__m256i const*>( p +  0 ) );
+            __m256i v1 = _mm256_loadu_si256( reinterpret_cast<__m256i const*>( p + 32 ) );
+
+            __m256i k0 = _mm256_xor_si256( v0, _mm256_loadu_si256( reinterpret_cast<__m256i const*>( secret +  0 ) ) );
+            __m256i k1 = _mm256_xor_si256( v1, _mm256_loadu_si256( reinterpret_cast<__m256i const*>( secret + 32 ) ) );
+
+            a0 = _mm256_add_epi64( a0, _mm256_add_epi64( _mm256_mul_epu32( k0, _mm256_shuffle_epi32( k0, _MM_SHUFFLE( 0, 3, 0, 1 ) ) ), _mm256_shuffle_epi32( v0, _MM_SHUFFLE( 1, 0, 3, 2 ) ) ) );
+            a1 = _mm256_add_epi64( a1, _mm256_add_epi64( _mm256_mul_epu32( k1, _mm256_shuffle_epi32( k1, _MM_SHUFFLE( 0, 3, 0, 1 ) ) ), _mm256_shuffle_epi32( v1, _MM_SHUFFLE( 1, 0, 3, 2 ) ) ) );
+        }
+
+        _mm256_storeu_si256( reinterpret_cast<__m256i*>( acc + 0 ), a0 );
+        _mm256_storeu_si256( reinterpret_cast<__m256i*>( acc + 4 ), a1 );
+    }
+
+    static void scramble( std::uint64_t * acc, unsigned char const * secret )
+    {
+        __m256i const prime = _mm256_set1_epi32( static_cast<int>( P32_1 ) );
+
+        for( int i = 0; i < 8; i += 4 )
+        {
+            __m256i a = _mm256_loadu_si256( reinterpret_cast<__m256i const*>( acc + i ) );
+
+            a = _mm256_xor_si256( a, _mm256_srli_epi64( a, 47 ) );
+            a = _mm256_xor_si256( a, _mm256_loadu_si256( reinterpret_cast<__m256i const*>( secret + 8 * i ) ) );
+
+            __m256i lo = _mm256_mul_epu32( a, prime );
+            __m256i hi = _mm256_mul_epu32( _mm256_srli_epi64( a, 32 ), prime );
+
+            _mm256_storeu_si256( reinterpret_cast<__m256i*>( acc + i ), _mm256_add_epi64( lo, _mm256_slli_epi64( hi, 32 ) ) );
+        }
+    }
+
+#elif defined(BOOST_HASH2_HAS_SSE2)
+
+    static void accumulate( std::uint64_t * acc, unsigned char const * p, unsigned char const * secret, std::size_t k )
+    {
+        __m128i a[ 4 ];
+
+        for( int j = 0; j < 4; ++j )
+        {
+            a[ j ] = _mm_loadu_si128( reinterpret_cast<__m128i const*>( acc + 2 * j ) );
+        }
+
+        for( std::size_t i = 0; i < k; ++i, p += stripe_size, secret += 8 )
+        {
+            for( int j = 0; j < 4; ++j )
+            {
+                __m128i v = _mm_loadu_si128( reinterpret_cast<__m128i const*>( p + 16 * j ) );
+                __m128i k2 = _mm_xor_si128( v, _mm_loadu_si128( reinterpret_cast<__m128i const*>( secret + 16 * j ) ) );
+
+                a[ j ] = _mm_add_epi64( a[ j ], _mm_add_epi64( _mm_mul_epu32( k2, _mm_shuffle_epi32( k2, _MM_SHUFFLE( 0, 3, 0, 1 ) ) ), _mm_shuffle_epi32( v, _MM_SHUFFLE( 1, 0, 3, 2 ) ) ) );
+            }
+        }
+
+        for( int j = 0; j < 4; ++j )
+        {
+            _mm_storeu_si128( reinterpret_cast<__m128i*>( acc + 2 * j ), a[ j ] );
+        }
+    }
+
+    static void scramble( std::uint64_t * acc, unsigned char const * secret )
+    {
+        __m128i const prime = _mm_set1_epi32( static_cast<int>( P32_1 ) );
+
+        for( int i = 0; i < 8; i += 2 )
+        {
+            __m128i a = _mm_loadu_si128( reinterpret_cast<__m128i const*>( acc + i ) );
+
+            a = _mm_xor_si128( a, _mm_srli_epi64( a, 47 ) );
+            a = _mm_xor_si128( a, _mm_loadu_si128( reinterpret_cast<__m128i const*>( secret + 8 * i ) ) );
+
+            __m128i lo = _mm_mul_epu32( a, prime );
+            __m128i hi = _mm_mul_epu32( _mm_srli_epi64( a, 32 ), prime );
+
+            _mm_storeu_si128( reinterpret_cast<__m128i*>( acc + i ), _mm_add_epi64( lo, _mm_slli_epi64( hi, 32 ) ) );
+        }
+    }
+
+#else
+
+    static void accumulate( std::uint64_t * acc, unsigned char const * p, unsigned char const * secret, std::size_t k )
+    {
+        for( std::size_t i = 0; i < k; ++i, p += stripe_size, secret += 8 )
+        {
+            accumulate_512( acc, p, secret );
+        }
+    }
+
+    static void scramble( std::uint64_t * acc, unsigned char const * secret )
+    {
+        for( int i = 0; i < 8; ++i )
+        {
+            std::uint64_t a = acc[ i ];
+
+            a ^= a >> 47;
+            a ^= detail::read64le( secret + 8 * i );
+            a *= P32_1;
+
+            acc[ i ] = a;
+        }
+    }
+
+#endif
+
+
+    // consumes k stripes, scrambling at block boundaries; must only
+    // be called for stripes that are followed by more input
+    void consume( std::uint64_t * acc, std::size_t & stripes, unsigned char const * p, std::size_t k ) const
+    {
+        for( ;; )
+        {
+            std::size_t k1 = stripes_per_block - stripes;
+
+            if( k < k1 )
+            {
+                accumulate( acc, p, secret_ + stripes * 8, k );
+                stripes += k;
+
+                return;
+            }
+
+            accumulate( acc, p, secret_ + stripes * 8, k1 );
+            scramble( acc, secret_ + secret_size - stripe_size );
+
+            p += k1 * stripe_size;
+            k -= k1;
+
+            stripes = 0;
+        }
+    }
+
+    static std::uint64_t merge_accumulators( std::uint64_t const * acc, unsigned char const * secret, std::uint64_t h )
+    {
+        for( int i = 0; i < 4; ++i )
+        {
+            h += detail::mulx( acc[ 2 * i ] ^ detail::read64le( secret + 16 * i ), acc[ 2 * i + 1 ] ^ detail::read64le( secret + 16 * i + 8 ) );
+        }
+
+        return avalanche( h );
+    }
+
+    // processes the buffered tail of a long input into acc
+    void finalize_long( std::uint64_t * acc ) const
+    {
+        BOOST_ASSERT( n_ > short_size );
+        BOOST_ASSERT( m_ > 0 );
+
+        std::memcpy( acc, acc_, sizeof( acc_ ) );
+
+        unsigned char const * last;
+        unsigned char tmp[ stripe_size ];
+
+        if( m_ >= stripe_size )
+        {
+            std::size_t stripes = stripes_;
+            consume( acc, stripes, buffer_, ( m_ - 1 ) / stripe_size );
+
+            last = buffer_ + m_ - stripe_size;
+        }
+        else
+        {
+            // the last stripe spans the end of the previously consumed data
+            std::size_t k = stripe_size - m_;
+
+            std::memcpy( tmp, buffer_ + N - k, k );
+            std::memcpy( tmp + k, buffer_, m_ );
+
+            last = tmp;
+        }
+
+        accumulate_512( acc, last, secret_ + secret_size - stripe_size - 7 );
+    }
+
+    // the long input path of the one-shot hash functions, on a freshly
+    // initialized state; reads p[0..n) in place, as the last stripe can
+    // overlap the consumed data directly
+    void hash_long( std::uint64_t * acc, unsigned char const * p, std::size_t n ) const
+    {
+        BOOST_ASSERT( n_ == 0 );
+        BOOST_ASSERT( n > short_size );
+
+        std::memcpy( acc, acc_, sizeof( acc_ ) );
+
+        std::size_t stripes = 0;
+        consume( acc, stripes, p, ( n - 1 ) / stripe_size );
+
+        accumulate_512( acc, p + n - stripe_size, secret_ + secret_size - stripe_size - 7 );
+    }
+
+    // short inputs, 64 bit result
+
+    static std::uint64_t hash64_0to16( unsigned char const * p, std::size_t n, unsigned char const * secret, std::uint64_t seed )
+    {
+        if( n > 8 )
+        {
+            std::uint64_t f1 = ( detail::read64le( secret + 24 ) ^ detail::read64le( secret + 32 ) ) + seed;
+            std::uint64_t f2 = ( detail::read64le( secret + 40 ) ^ detail::read64le( secret + 48 ) ) - seed;
+
+            std::uint64_t lo = detail::read64le( p ) ^ f1;
+            std::uint64_t hi = detail::read64le( p + n - 8 ) ^ f2;
+
+            return avalanche( n + bswap64( lo ) + hi + detail::mulx( lo, hi ) );
+        }
+        else if( n >= 4 )
+        {
+            seed ^= static_cast<std::uint64_t>( bswap32( static_cast<std::uint32_t>( seed ) ) ) << 32;
+
+            std::uint64_t f = ( detail::read64le( secret + 8 ) ^ detail::read64le( secret + 16 ) ) - seed;
+            std::uint64_t v = detail::read32le( p + n - 4 ) + ( static_cast<std::uint64_t>( detail::read32le( p ) ) << 32 );
+
+            return rrmxmx( v ^ f, n );
+        }
+        else if( n > 0 )
+        {
+            std::uint32_t c = ( static_cast<std::uint32_t>( p[ 0 ] ) << 16 ) | ( static_cast<std::uint32_t>( p[ n >> 1 ] ) << 24 ) | p[ n - 1 ] | ( static_cast<std::uint32_t>( n ) << 8 );
+            std::uint64_t f = ( detail::read32le( secret ) ^ detail::read32le( secret + 4 ) ) + seed;
+
+            return xxh64_avalanche( c ^ f );
+        }
+        else
+        {
+            return xxh64_avalanche( seed ^ detail::read64le( secret + 56 ) ^ detail::read64le( secret + 64 ) );
+        }
+    }
+
+    static std::uint64_t hash64_17to128( unsigned char const * p, std::size_t n, unsigned char const * secret, std::uint64_t seed )
+    {
+        std::uint64_t h = n * P64_1;
+
+        if( n > 32 )
+        {
+            if( n > 64 )
+            {
+                if( n > 96 )
+                {
+                    h += mix16( p + 48, secret + 96, seed );
+                    h += mix16( p + n - 64, secret + 112, seed );
+                }
+
+                h += mix16( p + 32, secret + 64, seed );
+                h += mix16( p + n - 48, secret + 80, seed );
+            }
+
+            h += mix16( p + 16, secret + 32, seed );
+            h += mix16( p + n - 32, secret + 48, seed );
+        }
+
+        h += mix16( p + 0, secret + 0, seed );
+        h += mix16( p + n - 16, secret + 16, seed );
+
+        return avalanche( h );
+    }
+
+    static std::uint64_t hash64_129to240( unsigned char const * p, std::size_t n, unsigned char const * secret, std::uint64_t seed )
+    {
+        std::uint64_t h = n * P64_1;
+
+        std::size_t k = n / 16;
+
+        for( std::size_t i = 0; i < 8; ++i )
+        {
+            h += mix16( p + 16 * i, secret + 16 * i, seed );
+        }
+
+        h = avalanche( h );
+
+        for( std::size_t i = 8; i < k; ++i )
+        {
+            h += mix16( p + 16 * i, secret + 16 * ( i - 8 ) + 3, seed );
+        }
+
+        h += mix16( p + n - 16, secret + min_secret_size - 17, seed );
+
+        return avalanche( h );
+    }
+
+    static std::uint64_t hash64_short( unsigned char const * p, std::size_t n, unsigned char const * secret, std::uint64_t seed )
+    {
+        BOOST_ASSERT( n <= short_size );
+
+        if( n <= 16 )
+        {
+            return hash64_0to16( p, n, secret, seed );
+        }
+        else if( n <= 128 )
+        {
+            return hash64_17to128( p, n, secret, seed );
+        }
+        else
+        {
+            return hash64_129to240( p, n, secret, seed );
+        }
+    }
+
+    // short inputs, 128 bit result
+
+    static detail::uint128 hash128_0to16( unsigned char const * p, std::size_t n, unsigned char const * secret, std::uint64_t seed )
+    {
+        detail::uint128 r;
+
+        if( n > 8 )
+        {
+            std::uint64_t f1 = ( detail::read64le( secret + 32 ) ^ detail::read64le( secret + 40 ) ) - seed;
+            std::uint64_t f2 = ( detail::read64le( secret + 48 ) ^ detail::read64le( secret + 56 ) ) + seed;
+
+            std::uint64_t lo = detail::read64le( p );
+            std::uint64_t hi = detail::read64le( p + n - 8 );
+
+            detail::uint128 m = detail::mul128( lo ^ hi ^ f1, P64_1 );
+
+            m.low += static_cast<std::uint64_t>( n - 1 ) << 54;
+
+            hi ^= f2;
+
+            m.high += hi + ( hi & 0xFFFFFFFFu ) * ( P32_2 - 1 );
+            m.low ^= bswap64( m.high );
+
+            r = detail::mul128( m.low, P64_2 );
+            r.high += m.high * P64_2;
+
+            r.low = avalanche( r.low );
+            r.high = avalanche( r.high );
+        }
+        else if( n >= 4 )
+        {
+            seed ^= static_cast<std::uint64_t>( bswap32( static_cast<std::uint32_t>( seed ) ) ) << 32;
+
+            std::uint64_t f = ( detail::read64le( secret + 16 ) ^ detail::read64le( secret + 24 ) ) + seed;
+            std::uint64_t v = detail::read32le( p ) + ( static_cast<std::uint64_t>( detail::read32le( p + n - 4 ) ) << 32 );
+
+            r = detail::mul128( v ^ f, P64_1 + ( n << 2 ) );
+
+            r.high += r.low << 1;
+            r.low ^= r.high >> 3;
+
+            r.low ^= r.low >> 35;
+            r.low *= PMX_2;
+            r.low ^= r.low >> 28;
+
+            r.high = avalanche( r.high );
+        }
+        else if( n > 0 )
+        {
+            std::uint32_t c1 = ( static_cast<std::uint32_t>( p[ 0 ] ) << 16 ) | ( static_cast<std::uint32_t>( p[ n >> 1 ] ) << 24 ) | p[ n - 1 ] | ( static_cast<std::uint32_t>( n ) << 8 );
+            std::uint32_t c2 = detail::rotl( bswap32( c1 ), 13 );
+
+            std::uint64_t f1 = ( detail::read32le( secret + 0 ) ^ detail::read32le( secret +  4 ) ) + seed;
+            std::uint64_t f2 = ( detail::read32le( secret + 8 ) ^ detail::read32le( secret + 12 ) ) - seed;
+
+            r.low = xxh64_avalanche( c1 ^ f1 );
+            r.high = xxh64_avalanche( c2 ^ f2 );
+        }
+        else
+        {
+            r.low = xxh64_avalanche( seed ^ detail::read64le( secret + 64 ) ^ detail::read64le( secret + 72 ) );
+            r.high = xxh64_avalanche( seed ^ detail::read64le( secret + 80 ) ^ detail::read64le( secret + 88 ) );
+        }
+
+        return r;
+    }
+
+    static detail::uint128 hash128_finalize( detail::uint128 acc, std::size_t n, std::uint64_t seed )
+    {
+        detail::uint128 r;
+
+        r.low = acc.low + acc.high;
+        r.high = acc.low * P64_1 + acc.high * P64_4 + ( n - seed ) * P64_2;
+
+        r.low = avalanche( r.low );
+        r.high = 0 - avalanche( r.high );
+
+        return r;
+    }
+
+    static detail::uint128 hash128_17to128( unsigned char const * p, std::size_t n, unsigned char const * secret, std::uint64_t seed )
+    {
+        detail::uint128 acc = { n * P64_1, 0 };
+
+        if( n > 32 )
+        {
+            if( n > 64 )
+            {
+                if( n > 96 )
+                {
+                    mix32( acc, p + 48, p + n - 64, secret + 96, seed );
+                }
+
+                mix32( acc, p + 32, p + n - 48, secret + 64, seed );
+            }
+
+            mix32( acc, p + 16, p + n - 32, secret + 32, seed );
+        }
+
+        mix32( acc, p, p + n - 16, secret, seed );
+
+        return hash128_finalize( acc, n, seed );
+    }
+
+    static detail::uint128 hash128_129to240( unsigned char const * p, std::size_t n, unsigned char const * secret, std::uint64_t seed )
+    {
+        detail::uint128 acc = { n * P64_1, 0 };
+
+        std::size_t k = n / 32;
+
+        for( std::size_t i = 0; i < 4; ++i )
+        {
+            mix32( acc, p + 32 * i, p + 32 * i + 16, secret + 32 * i, seed );
+        }
+
+        acc.low = avalanche( acc.low );
+        acc.high = avalanche( acc.high );
+
+        for( std::size_t i = 4; i < k; ++i )
+        {
+            mix32( acc, p + 32 * i, p + 32 * i + 16, secret + 32 * ( i - 4 ) + 3, seed );
+        }
+
+        mix32( acc, p + n - 16, p + n - 32, secret + min_secret_size - 17 - 16, 0 - seed );
+
+        return hash128_finalize( acc, n, seed );
+    }
+
+    static detail::uint128 hash128_short( unsigned char const * p, std::size_t n, unsigned char const * secret, std::uint64_t seed )
+    {
+        BOOST_ASSERT( n <= short_size );
+
+        if( n <= 16 )
+        {
+            return hash128_0to16( p, n, secret, seed );
+        }
+        else if( n <= 128 )
+        {
+            return hash128_17to128( p, n, secret, seed );
+        }
+        else
+        {
+            return hash128_129to240( p, n, secret, seed );
+        }
+    }
+
+    unsigned char const * short_secret() const
+    {
+        return with_secret_? secret_: xxh3_constants<>::default_secret;
+    }
+
+    std::uint64_t merge64( std::uint64_t const * acc, std::uint64_t n ) const
+    {
+        return merge_accumulators( acc, secret_ + 11, n * P64_1 );
+    }
+
+    detail::uint128 merge128( std::uint64_t const * acc, std::uint64_t n ) const
+    {
+        detail::uint128 r;
+
+        r.low = merge_accumulators( acc, secret_ + 11, n * P64_1 );
+        r.high = merge_accumulators( acc, secret_ + secret_size - stripe_size - 11, ~( n * P64_2 ) );
+
+        return r;
+    }
+
+    std::uint64_t digest64() const
+    {
+        if( n_ > short_size )
+        {
+            std::uint64_t acc[ 8 ];
+            finalize_long( acc );
+
+            return merge64( acc, n_ );
+        }
+        else
+        {
+            return hash64_short( buffer_, static_cast<std::size_t>( n_ ), short_secret(), seed_ );
+        }
+    }
+
+    detail::uint128 digest128() const
+    {
+        if( n_ > short_size )
+        {
+            std::uint64_t acc[ 8 ];
+            finalize_long( acc );
+
+            return merge128( acc, n_ );
+        }
+        else
+        {
+            return hash128_short( buffer_, static_cast<std::size_t>( n_ ), short_secret(), seed_ );
+        }
+    }
+
+    void init_accumulators()
+    {
+        acc_[ 0 ] = P32_3;
+        acc_[ 1 ] = P64_1;
+        acc_[ 2 ] = P64_2;
+        acc_[ 3 ] = P64_3;
+        acc_[ 4 ] = P64_4;
+        acc_[ 5 ] = P32_2;
+        acc_[ 6 ] = P64_5;
+        acc_[ 7 ] = P32_1;
+
+        m_ = 0;
+        stripes_ = 0;
+        n_ = 0;
+    }
+
+    // derives secret_ from s by adding and subtracting seed from alternate words
+    void init_custom_secret( unsigned char const * s, std::uint64_t seed )
+    {
+        for( std::size_t i = 0; i < secret_size; i += 16 )
+        {
+            detail::write64le( secret_ + i + 0, detail::read64le( s + i + 0 ) + seed );
+            detail::write64le( secret_ + i + 8, detail::read64le( s + i + 8 ) - seed );
+        }
+    }
+
+    void init( std::uint64_t seed )
+    {
+        seed_ = seed;
+        with_secret_ = false;
+
+        init_custom_secret( xxh3_constants<>::default_secret, seed );
+        init_accumulators();
+    }
+
+    // generates the secret from a byte sequence, after XXH3_generateSecret
+    void init( unsigned char const * p, std::size_t n )
+    {
+        if( n == 0 )
+        {
+            init( 0 );
+            return;
+        }
+
+        seed_ = 0;
+        with_secret_ = true;
+
+        for( std::size_t i = 0; i < secret_size; i += n )
+        {
+            std::memcpy( secret_ + i, p, n < secret_size - i? n: secret_size - i );
+        }
+
+        unsigned char scrambler[ 16 ];
+        detail::uint128 s;
+
+        {
+            xxh3_base h;
+
+            h.init( 0 );
+            h.update( p, n );
+
+            s = h.digest128();
+
+            detail::write64be( scrambler + 0, s.high );
+            detail::write64be( scrambler + 8, s.low );
+
+            std::memset( h.buffer_, 0, N );
+        }
+
+        for( std::size_t i = 0; i < secret_size / 16; ++i )
+        {
+            combine16( secret_ + 16 * i, hash128_short( scrambler, 16, xxh3_constants<>::default_secret, i ) );
+        }
+
+        combine16( secret_ + secret_size - 16, s );
+
+        init_accumulators();
+    }
+
+    static void combine16( unsigned char * p, detail::uint128 h )
+    {
+        detail::write64le( p + 0, detail::read64le( p + 0 ) ^ h.low );
+        detail::write64le( p + 8, detail::read64le( p + 8 ) ^ h.high );
+    }
+
+    // called from result(); clears the buffered plaintext and rekeys
+    // the state so that subsequent results form a distinct sequence
+    void reset( std::uint64_t r )
+    {
+        if( with_secret_ )
+        {
+            unsigned char tmp[ secret_size ];
+            std::memcpy( tmp, secret_, secret_size );
+
+            init_custom_secret( tmp, r );
+        }
+        else
+        {
+            seed_ = r;
+            init_custom_secret( xxh3_constants<>::default_secret, r );
+        }
+
+        std::memset( buffer_, 0, N );
+        init_accumulators();
+    }
+
+public:
+
+    typedef std::uint64_t size_type;
+
+    void update( void const * pv, std::size_t n )
+    {
+        unsigned char const* p = static_cast<unsigned char const*>( pv );
+
+        if( n == 0 ) return;
+
+        n_ += n;
+
+        if( n <= N - m_ )
+        {
+            std::memcpy( buffer_ + m_, p, n );
+            m_ += n;
+
+            return;
+        }
+
+        if( m_ > 0 )
+        {
+            std::size_t k = N - m_;
+
+            std::memcpy( buffer_ + m_, p, k );
+
+            p += k;
+            n -= k;
+
+            consume( acc_, stripes_, buffer_, N / stripe_size );
+            m_ = 0;
+        }
+
+        // always leave a nonempty tail in the buffer, as result()
+        // needs to know whether the input has ended
+
+        if( n > N )
+        {
+            std::size_t k = ( n - 1 ) / stripe_size;
+
+            consume( acc_, stripes_, p, k );
+
+            p += k * stripe_size;
+            n -= k * stripe_size;
+
+            // keep the last consumed stripe for result()
+            std::memcpy( buffer_ + N - stripe_size, p - stripe_size, stripe_size );
+        }
+
+        BOOST_ASSERT( n > 0 && n <= N );
+
+        std::memcpy( buffer_, p, n );
+        m_ = n;
+    }
+};
+
+} // namespace detail
+
+class xxh3_64: public detail::xxh3_base
+{
+public:
+
+    typedef std::uint64_t result_type;
+
+    xxh3_64()
+    {
+        init( 0 );
+    }
+
+    explicit xxh3_64( std::uint64_t seed )
+    {
+        init( seed );
+    }
+
+    xxh3_64( unsigned char const * p, std::size_t n )
+    {
+        init( p, n );
+    }
+
+    result_type result()
+    {
+        std::uint64_t r = digest64();
+
+        reset( r );
+
+        return r;
+    }
+
+    // hashes p[0..n) directly, without buffering; the result is the
+    // same as that of update( p, n ) and result() on xxh3_64( seed )
+
+    static result_type hash( void const * pv, std::size_t n, std::uint64_t seed = 0 )
+    {
+        unsigned char const* p = static_cast<unsigned char const*>( pv );
+
+        if( n <= short_size )
+        {
+            return hash64_short( p, n, detail::xxh3_constants<>::default_secret, seed );
+        }
+
+        xxh3_64 h( seed );
+
+        std::uint64_t acc[ 8 ];
+        h.hash_long( acc, p, n );
+
+        return h.merge64( acc, n );
+    }
+};
+
+class xxh3_128: public detail::xxh3_base
+{
+public:
+
+    typedef std::array<unsigned char, 16> result_type;
+
+    xxh3_128()
+    {
+        init( 0 );
+    }
+
+    explicit xxh3_128( std::uint64_t seed )
+    {
+        init( seed );
+    }
+
+    xxh3_128( unsigned char const * p, std::size_t n )
+    {
+        init( p, n );
+    }
+
+    result_type result()
+    {
+        detail::uint128 h = digest128();
+
+        reset( h.low ^ h.high );
+
+        // canonical representation, big endian
+
+        result_type r;
+
+        detail::write64be( &r[ 0 ], h.high );
+        detail::write64be( &r[ 8 ], h.low );
+
+        return r;
+    }
+
+    // hashes p[0..n) directly, without buffering; the result is the
+    // same as that of update( p, n ) and result() on xxh3_128( seed )
+
+    static result_type hash( void const * pv, std::size_t n, std::uint64_t seed = 0 )
+    {
+        unsigned char const* p = static_cast<unsigned char const*>( pv );
+
+        detail::uint128 h;
+
+        if( n <= short_size )
+        {
+            h = hash128_short( p, n, detail::xxh3_constants<>::default_secret, seed );
+        }
+        else
+        {
+            xxh3_128 s( seed );
+
+            std::uint64_t acc[ 8 ];
+            s.hash_long( acc, p, n );
+
+            h = s.merge128( acc, n );
+        }
+
+        result_type r;
+
+        detail::write64be( &r[ 0 ], h.high );
+        detail::write64be( &r[ 8 ], h.low );
+
+        return r;
+    }
+};
+
+} // namespace hash2
+} // namespace boost
+
+#endif // #ifndef BOOST_HASH2_XXH3_HPP_INCLUDED
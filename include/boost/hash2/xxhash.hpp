@@ -7,6 +7,8 @@
 //
 // xxHash, https://cyan4973.github.io/xxHash/
 
+#include <boost/hash2/detail/config.hpp>
+#include <boost/hash2/detail/intrin.hpp>
 #include <boost/hash2/detail/read.hpp>
 #include <boost/hash2/detail/rot.hpp>
 #include <boost/assert.hpp>
@@ -45,6 +47,16 @@ private:
         seed += input * P2;
         seed = detail::rotl( seed, 13 );
         seed *= P1;
+
+#if defined(__GNUC__) && ( defined(__x86_64__) || defined(__i386__) )
+
+        // keeps GCC and Clang from vectorizing the four lanes of
+        // update_, which makes it up to twice as slow; see below
+
+        __asm__( "" : "+r"( seed ) );
+
+#endif
+
         return seed;
     }
 
@@ -77,6 +89,50 @@ private:
         v4_ = seed - P1;
     }
 
+    // the tail of m bytes at p, for a total input length of n
+
+    std::uint32_t finalize( unsigned char const * p, std::size_t m, std::size_t n ) const
+    {
+        std::uint32_t h;
+
+        if( n >= 16 )
+        {
+            h = detail::rotl( v1_, 1 ) + detail::rotl( v2_, 7 ) + detail::rotl( v3_, 12 ) + detail::rotl( v4_, 18 );
+        }
+        else
+        {
+            h = v3_ + P5;
+        }
+
+        h += static_cast<std::uint32_t>( n );
+
+        while( m >= 4 )
+        {
+            h += detail::read32le( p ) * P3;
+            h = detail::rotl( h, 17 ) * P4;
+
+            p += 4;
+            m -= 4;
+        }
+
+        while( m > 0 )
+        {
+            h += p[0] * P5;
+            h = detail::rotl( h, 11 ) * P1;
+
+            ++p;
+            --m;
+        }
+
+        h ^= h >> 15;
+        h *= P2;
+        h ^= h >> 13;
+        h *= P3;
+        h ^= h >> 16;
+
+        return h;
+    }
+
 public:
 
     typedef std::uint32_t result_type;
@@ -180,44 +236,30 @@ public:
         BOOST_ASSERT( m_ == n_ % 16 );
     }
 
-    std::uint32_t result()
+    // update( p, N ), with the length known at compile time
+
+    template<std::size_t N> void update_fixed( unsigned char const * p )
     {
         BOOST_ASSERT( m_ == n_ % 16 );
 
-        std::uint32_t h;
-
-        if( n_ >= 16 )
+        if( N < 16 && m_ < 16 - N )
         {
-            h = detail::rotl( v1_, 1 ) + detail::rotl( v2_, 7 ) + detail::rotl( v3_, 12 ) + detail::rotl( v4_, 18 );
+            std::memcpy( buffer_ + m_, p, N );
+
+            m_ += N;
+            n_ += N;
         }
         else
         {
-            h = v3_ + P5;
-        }
-
-        h += static_cast<std::uint32_t>( n_ );
-
-        unsigned char const * p = buffer_;
-
-        std::size_t m = m_;
-
-        while( m >= 4 )
-        {
-            h += detail::read32le( p ) * P3;
-            h = detail::rotl( h, 17 ) * P4;
-
-            p += 4;
-            m -= 4;
+            update( p, N );
         }
+    }
 
-        while( m > 0 )
-        {
-            h += p[0] * P5;
-            h = detail::rotl( h, 11 ) * P1;
+    std::uint32_t result()
+    {
+        BOOST_ASSERT( m_ == n_ % 16 );
 
-            ++p;
-            --m;
-        }
+        std::uint32_t h = finalize( buffer_, m_, n_ );
 
         n_ += 16 - m_;
         m_ = 0;
@@ -225,14 +267,23 @@ public:
         // clear buffered plaintext
         std::memset( buffer_, 0, 16 );
 
-        h ^= h >> 15;
-        h *= P2;
-        h ^= h >> 13;
-        h *= P3;
-        h ^= h >> 16;
-
         return h;
     }
+
+    // hashes p[0..n) directly, without buffering; the result is the
+    // same as that of update( p, n ) and result() on xxhash_32( seed )
+
+    static std::uint32_t hash( void const * pv, std::size_t n, std::uint64_t seed = 0 )
+    {
+        unsigned char const* p = static_cast<unsigned char const*>( pv );
+
+        xxhash_32 h( seed );
+
+        std::size_t k = n / 16;
+        h.update_( p, k );
+
+        return h.finalize( p + 16 * k, n % 16, n );
+    }
 };
 
 class xxhash_64
@@ -261,6 +312,16 @@ private:
         seed += input * P2;
         seed = detail::rotl( seed, 31 );
         seed *= P1;
+
+#if defined(__GNUC__) && defined(__x86_64__)
+
+        // as in xxhash_32; with AVX-512DQ, GCC otherwise
+        // vectorizes update_ using vpmullq, see below
+
+        __asm__( "" : "+r"( seed ) );
+
+#endif
+
         return seed;
     }
 
@@ -272,6 +333,43 @@ private:
         return acc;
     }
 
+#if defined(BOOST_HASH2_HAS_AVX512) && defined(BOOST_HASH2_XXHASH64_SIMD)
+
+    // The four accumulators are the four lanes of one ymm register. This
+    // is opt-in, because vpmullq is three uops with a latency of 15 cycles
+    // on Intel, against 3 for the scalar imul, and the loop, being one
+    // dependency chain, is then slower than the four scalar chains below.
+    // Define BOOST_HASH2_XXHASH64_SIMD where it's fast (e.g. AMD Zen 4.)
+
+    void update_( unsigned char const * p, std::size_t k )
+    {
+        if( k == 0 ) return;
+
+        __m256i const p1 = _mm256_set1_epi64x( static_cast<long long>( P1 ) );
+        __m256i const p2 = _mm256_set1_epi64x( static_cast<long long>( P2 ) );
+
+        __m256i v = _mm256_set_epi64x( static_cast<long long>( v4_ ), static_cast<long long>( v3_ ), static_cast<long long>( v2_ ), static_cast<long long>( v1_ ) );
+
+        for( std::size_t i = 0; i < k; ++i, p += 32 )
+        {
+            __m256i w = _mm256_loadu_si256( reinterpret_cast<__m256i const*>( p ) );
+
+            v = _mm256_add_epi64( v, _mm256_mullo_epi64( w, p2 ) );
+            v = _mm256_rol_epi64( v, 31 );
+            v = _mm256_mullo_epi64( v, p1 );
+        }
+
+        unsigned char w[ 32 ];
+        _mm256_storeu_si256( reinterpret_cast<__m256i*>( w ), v );
+
+        v1_ = detail::read64le( w +  0 );
+        v2_ = detail::read64le( w +  8 );
+        v3_ = detail::read64le( w + 16 );
+        v4_ = detail::read64le( w + 24 );
+    }
+
+#else
+
     void update_( unsigned char const * p, std::size_t k )
     {
         std::uint64_t v1 = v1_;
@@ -293,6 +391,8 @@ private:
         v4_ = v4; 
     }
 
+#endif
+
     void init( std::uint64_t seed )
     {
         v1_ = seed + P1 + P2;
@@ -301,6 +401,66 @@ private:
         v4_ = seed - P1;
     }
 
+    // the tail of m bytes at p, for a total input length of n
+
+    std::uint64_t finalize( unsigned char const * p, std::size_t m, std::uint64_t n ) const
+    {
+        std::uint64_t h;
+
+        if( n >= 32 )
+        {
+            h = detail::rotl( v1_, 1 ) + detail::rotl( v2_, 7 ) + detail::rotl( v3_, 12 ) + detail::rotl( v4_, 18 );
+
+            h = merge_round( h, v1_ );
+            h = merge_round( h, v2_ );
+            h = merge_round( h, v3_ );
+            h = merge_round( h, v4_ );
+        }
+        else
+        {
+            h = v3_ + P5;
+        }
+
+        h += n;
+
+        while( m >= 8 )
+        {
+            std::uint64_t k1 = round( 0, detail::read64le( p ) );
+
+            h ^= k1;
+            h = detail::rotl( h, 27 ) * P1 + P4;
+
+            p += 8;
+            m -= 8;
+        }
+
+        while( m >= 4 )
+        {
+            h ^= static_cast<std::uint64_t>( detail::read32le( p ) ) * P1;
+            h = detail::rotl( h, 23 ) * P2 + P3;
+
+            p += 4;
+            m -= 4;
+        }
+
+        while( m > 0 )
+        {
+            h ^= p[0] * P5;
+            h = detail::rotl( h, 11 ) * P1;
+
+            ++p;
+            --m;
+        }
+
+        h ^= h >> 33;
+        h *= P2;
+        h ^= h >> 29;
+        h *= P3;
+        h ^= h >> 32;
+
+        return h;
+    }
+
 public:
 
     typedef std::uint64_t result_type;
@@ -393,60 +553,30 @@ public:
         BOOST_ASSERT( m_ == n_ % 32 );
     }
 
-    std::uint64_t result()
+    // update( p, N ), with the length known at compile time
+
+    template<std::size_t N> void update_fixed( unsigned char const * p )
     {
         BOOST_ASSERT( m_ == n_ % 32 );
 
-        std::uint64_t h;
-
-        if( n_ >= 32 )
+        if( N < 32 && m_ < 32 - N )
         {
-            h = detail::rotl( v1_, 1 ) + detail::rotl( v2_, 7 ) + detail::rotl( v3_, 12 ) + detail::rotl( v4_, 18 );
+            std::memcpy( buffer_ + m_, p, N );
 
-            h = merge_round( h, v1_ );
-            h = merge_round( h, v2_ );
-            h = merge_round( h, v3_ );
-            h = merge_round( h, v4_ );
+            m_ += N;
+            n_ += N;
         }
         else
         {
-            h = v3_ + P5;
-        }
-
-        h += n_;
-
-        unsigned char const * p = buffer_;
-
-        std::size_t m = m_;
-
-        while( m >= 8 )
-        {
-            std::uint64_t k1 = round( 0, detail::read64le( p ) );
-
-            h ^= k1;
-            h = detail::rotl( h, 27 ) * P1 + P4;
-
-            p += 8;
-            m -= 8;
-        }
-
-        while( m >= 4 )
-        {
-            h ^= static_cast<std::uint64_t>( detail::read32le( p ) ) * P1;
-            h = detail::rotl( h, 23 ) * P2 + P3;
-
-            p += 4;
-            m -= 4;
+            update( p, N );
         }
+    }
 
-        while( m > 0 )
-        {
-            h ^= p[0] * P5;
-            h = detail::rotl( h, 11 ) * P1;
+    std::uint64_t result()
+    {
+        BOOST_ASSERT( m_ == n_ % 32 );
 
-            ++p;
-            --m;
-        }
+        std::uint64_t h = finalize( buffer_, m_, n_ );
 
         n_ += 32 - m_;
         m_ = 0;
@@ -454,14 +584,23 @@ public:
         // clear buffered plaintext
         std::memset( buffer_, 0, 32 );
 
-        h ^= h >> 33;
-        h *= P2;
-        h ^= h >> 29;
-        h *= P3;
-        h ^= h >> 32;
-
         return h;
     }
+
+    // hashes p[0..n) directly, without buffering; the result is the
+    // same as that of update( p, n ) and result() on xxhash_64( seed )
+
+    static std::uint64_t hash( void const * pv, std::size_t n, std::uint64_t seed = 0 )
+    {
+        unsigned char const* p = static_cast<unsigned char const*>( pv );
+
+        xxhash_64 h( seed );
+
+        std::size_t k = n / 32;
+        h.update_( p, k );
+
+        return h.finalize( p + 32 * k, n % 32, n );
+    }
 };
 
 } // namespace hash2
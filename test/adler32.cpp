@@ -0,0 +1,123 @@
+// Copyright 2024 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/adler32.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <cstring>
+#include <cstdint>
+#include <cstddef>
+
+template<class H> typename H::result_type hash( H h, void const * p, std::size_t n )
+{
+    h.update( p, n );
+    return h.result();
+}
+
+template<class H> typename H::result_type hash( char const * s )
+{
+    return hash( H(), s, std::strlen( s ) );
+}
+
+// the definition, one byte at a time
+
+std::uint32_t adler32_bytewise( unsigned char const * p, std::size_t n )
+{
+    std::uint32_t s1 = 1, s2 = 0;
+
+    for( std::size_t i = 0; i < n; ++i )
+    {
+        s1 = ( s1 + p[ i ] ) % 65521;
+        s2 = ( s2 + s1 ) % 65521;
+    }
+
+    return ( s2 << 16 ) | s1;
+}
+
+static const std::size_t N = 100000;
+static unsigned char buffer[ N + 1 ];
+
+static void test_bytewise( unsigned char const * p )
+{
+    for( std::size_t n = 0; n <= N; n += n < 1100? 1: n / 16 )
+    {
+        BOOST_TEST_EQ( hash( boost::hash2::adler32(), p, n ), adler32_bytewise( p, n ) );
+    }
+}
+
+int main()
+{
+    using namespace boost::hash2;
+
+    // Test vectors from https://en.wikipedia.org/wiki/Adler-32, and the
+    // initial value of https://www.rfc-editor.org/rfc/rfc1950#section-9
+
+    BOOST_TEST_EQ( hash<adler32>( "" ), 0x00000001ul );
+    BOOST_TEST_EQ( hash<adler32>( "abc" ), 0x024D0127ul );
+    BOOST_TEST_EQ( hash<adler32>( "Wikipedia" ), 0x11E60398ul );
+
+    // unaligned
+    unsigned char * p = buffer + 1;
+
+    // the sums must not overflow between reductions
+
+    std::memset( p, 0xFF, N );
+    test_bytewise( p );
+
+    // the vectorized path must match the definition
+
+    for( std::size_t i = 0; i < N + 1; ++i )
+    {
+        buffer[ i ] = static_cast<unsigned char>( i ^ ( i >> 8 ) );
+    }
+
+    test_bytewise( p );
+
+    // a seed is hashed as 8 bytes, or as 4 bytes when it fits
+
+    {
+        unsigned char const s8[] = { 0x15, 0x7c, 0x4a, 0x7f, 0xb9, 0x79, 0x37, 0x9e, 'a', 'b', 'c' };
+        BOOST_TEST_EQ( hash( adler32( 0x9e3779b97f4a7c15ull ), "abc", 3 ), adler32_bytewise( s8, 11 ) );
+
+        unsigned char const s4[] = { 0x15, 0x7c, 0x4a, 0x7f, 'a', 'b', 'c' };
+        BOOST_TEST_EQ( hash( adler32( 0x7f4a7c15ull ), "abc", 3 ), adler32_bytewise( s4, 7 ) );
+    }
+
+    // a second result() continues as if by update( "\xFF", 1 )
+
+    {
+        unsigned char tmp[ 1001 ];
+
+        std::memcpy( tmp, p, 1000 );
+        tmp[ 1000 ] = 0xFF;
+
+        adler32 h;
+
+        h.update( p, 1000 );
+
+        BOOST_TEST_EQ( h.result(), adler32_bytewise( tmp, 1000 ) );
+        BOOST_TEST_EQ( h.result(), adler32_bytewise( tmp, 1001 ) );
+    }
+
+    // adler32_combine( adler( A ), adler( B ), len( B ) ) == adler( A + B )
+
+    {
+        std::size_t const lengths[] = { 0, 1, 7, 64, 255, 1000, 5552, 10000, 65521, N };
+        std::size_t const M = sizeof( lengths ) / sizeof( lengths[0] );
+
+        for( std::size_t i = 0; i < M; ++i )
+        {
+            for( std::size_t j = 0; j < M; ++j )
+            {
+                std::size_t n1 = lengths[ i ];
+                std::size_t n2 = lengths[ j ];
+
+                if( n1 + n2 > N ) continue;
+
+                BOOST_TEST_EQ( adler32_combine( hash( adler32(), p, n1 ), hash( adler32(), p + n1, n2 ), n2 ), hash( adler32(), p, n1 + n2 ) );
+            }
+        }
+    }
+
+    return boost::report_errors();
+}
@@ -0,0 +1,120 @@
+// Copyright 2024 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#define _CRT_SECURE_NO_WARNINGS
+
+#include <boost/hash2/aeshash.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <string>
+#include <cstdint>
+#include <cstddef>
+#include <cstdio>
+
+template<std::size_t N> std::string to_string( std::array<unsigned char, N> const & v )
+{
+    std::string r;
+
+    for( std::size_t i = 0; i < N; ++i )
+    {
+        char buffer[ 8 ];
+
+        std::snprintf( buffer, sizeof( buffer ), "%02x", static_cast<int>( v[ i ] ) );
+
+        r += buffer;
+    }
+
+    return r;
+}
+
+template<class H> typename H::result_type hash( H h, void const * p, std::size_t n )
+{
+    h.update( p, n );
+    return h.result();
+}
+
+// aeshash has no published test vectors; these are regression values,
+// computed with this implementation. All code paths, AES-NI, VAES and
+// the portable one, must produce them
+
+struct test_vector
+{
+    std::size_t n;
+    std::uint64_t r64;
+    char const * r128;
+};
+
+static const test_vector vectors[] =
+{
+    {     0, 0x3a0ab56fb5e2823eull, "3e82e2b56fb50a3ae9b455ce0b57ffb8" },
+    {     1, 0xce6f37903e125425ull, "2554123e90376fce0777f37e95104dcc" },
+    {    15, 0x24007d79c9d80ed9ull, "d90ed8c9797d0024f4f817c7878afafe" },
+    {    16, 0x545e5fa77ae036e8ull, "e836e07aa75f5e5471d6928cd71e6e28" },
+    {    17, 0x265c53f4f08bdf9aull, "9adf8bf0f4535c26e43e500c3db3fdd6" },
+    {   127, 0xfbfcd4c767c12279ull, "7922c167c7d4fcfbc114683a45bb241a" },
+    {   128, 0xa0be3883e0cfc332ull, "32c3cfe08338bea0e404a5bf1094880b" },
+    {   129, 0x45b6f6d57b95bb38ull, "38bb957bd5f6b645c3ca4750cba2641f" },
+    {   255, 0xacc0486ad77faa5dull, "5daa7fd76a48c0ac49cf5e4390f9f99d" },
+    {   256, 0xa6dffdf22d44bfcfull, "cfbf442df2fddfa6c5ab56061d0bc7ad" },
+    {   257, 0x10caf665f116e1a5ull, "a5e116f165f6ca10b8060c67aa005bf7" },
+    {  1000, 0x246e3ab88fabdddbull, "dbddab8fb83a6e247fdf31704f4f6d7d" },
+    { 10000, 0xdf68fe31441cc31bull, "1bc31c4431fe68df65137d748072d783" }
+};
+
+static const std::size_t N = 10000;
+static unsigned char buffer[ N ];
+
+int main()
+{
+    using namespace boost::hash2;
+
+    // the portable AES round; test vector from FIPS 197, Appendix B,
+    // the state at the start of round 2 (columns as little endian words)
+
+    {
+        std::uint32_t const x[ 4 ] = { 0xbee33d19, 0x2be2f4a0, 0x2a8dc69a, 0x0848f8e9 };
+        std::uint32_t const k[ 4 ] = { 0x17fefaa0, 0xb12c5488, 0x3939a323, 0x05766c2a };
+
+        std::uint32_t r[ 4 ];
+        detail::aes_round( x, k, r );
+
+        BOOST_TEST_EQ( r[ 0 ], 0xf27f9ca4u );
+        BOOST_TEST_EQ( r[ 1 ], 0x2b359f68u );
+        BOOST_TEST_EQ( r[ 2 ], 0x43ea5b6bu );
+        BOOST_TEST_EQ( r[ 3 ], 0x49506a02u );
+    }
+
+    for( std::size_t i = 0; i < N; ++i )
+    {
+        buffer[ i ] = static_cast<unsigned char>( i );
+    }
+
+    for( std::size_t i = 0; i < sizeof( vectors ) / sizeof( vectors[0] ); ++i )
+    {
+        test_vector const & v = vectors[ i ];
+
+        BOOST_TEST_EQ( hash( aeshash_64(), buffer, v.n ), v.r64 );
+        BOOST_TEST_EQ( to_string( hash( aeshash_128(), buffer, v.n ) ), std::string( v.r128 ) );
+    }
+
+    // regression values, as above
+
+    BOOST_TEST_EQ( hash( aeshash_64( 0x9e3779b97f4a7c15ull ), "abc", 3 ), 0xd6ec9c05fee2e709ull );
+    BOOST_TEST_EQ( to_string( hash( aeshash_128( 0x9e3779b97f4a7c15ull ), "abc", 3 ) ), std::string( "09e7e2fe059cecd62abffdc50f86adcb" ) );
+
+    // a byte seed of up to 16 bytes is the zero padded key, so an
+    // integral seed is the same as its 8 bytes, little endian
+
+    {
+        unsigned char const seed[] = { 0x15, 0x7c, 0x4a, 0x7f, 0xb9, 0x79, 0x37, 0x9e };
+
+        BOOST_TEST_EQ( hash( aeshash_64( seed, 8 ), buffer, 1000 ), hash( aeshash_64( 0x9e3779b97f4a7c15ull ), buffer, 1000 ) );
+        BOOST_TEST( hash( aeshash_128( seed, 8 ), buffer, 1000 ) == hash( aeshash_128( 0x9e3779b97f4a7c15ull ), buffer, 1000 ) );
+    }
+
+    // longer byte seeds are hashed; regression value
+
+    BOOST_TEST_EQ( hash( aeshash_64( reinterpret_cast<unsigned char const*>( "0123456789abcdef0123" ), 20 ), buffer, 100 ), 0xcc66152ccea4d492ull );
+
+    return boost::report_errors();
+}
@@ -0,0 +1,9 @@
+// Copyright 2024 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+// Tests the portable implementation
+
+#define BOOST_HASH2_DISABLE_SIMD
+
+#include "aeshash.cpp"
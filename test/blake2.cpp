@@ -0,0 +1,275 @@
+// Copyright 2024 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#define _CRT_SECURE_NO_WARNINGS
+
+#include <boost/hash2/blake2.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <string>
+#include <cstddef>
+#include <cstdio>
+
+template<std::size_t N> std::string to_string( std::array<unsigned char, N> const & v )
+{
+    std::string r;
+
+    for( std::size_t i = 0; i < N; ++i )
+    {
+        char buffer[ 8 ];
+
+        std::snprintf( buffer, sizeof( buffer ), "%02x", static_cast<int>( v[ i ] ) );
+
+        r += buffer;
+    }
+
+    return r;
+}
+
+template<class H> std::string digest( std::string const & s )
+{
+    H h;
+
+    h.update( s.data(), s.size() );
+
+    return to_string( h.result() );
+}
+
+template<class H> std::string digest( H h, unsigned char const * p, std::size_t n )
+{
+    h.update( p, n );
+
+    return to_string( h.result() );
+}
+
+struct test_vector
+{
+    std::size_t n;
+    char const * hash;
+    char const * keyed_hash;
+};
+
+// Test vectors from https://github.com/BLAKE2/BLAKE2/blob/master/testvectors/blake2-kat.json
+//
+// The input is 0, 1, 2, ..., the key is 0, 1, 2, ... of the maximum
+// key size, 64 bytes for BLAKE2b and 32 for BLAKE2s
+
+static const test_vector blake2b_512_kat[] =
+{
+    {     0, "786a02f742015903c6c6fd852552d272912f4740e15847618a86e217f71f5419d25e1031afee585313896444934eb04b903a685b1448b755d56f701afe9be2ce", "10ebb67700b1868efb4417987acf4690ae9d972fb7a590c2f02871799aaa4786b5e996e8f0f4eb981fc214b005f42d2ff4233499391653df7aefcbc13fc51568" },
+    {     1, "2fa3f686df876995167e7c2e5d74c4c7b6e48f8068fe0e44208344d480f7904c36963e44115fe3eb2a3ac8694c28bcb4f5a0f3276f2e79487d8219057a506e4b", "961f6dd1e4dd30f63901690c512e78e4b45e4742ed197c3c5e45c549fd25f2e4187b0bc9fe30492b16b0d0bc4ef9b0f34c7003fac09a5ef1532e69430234cebd" },
+    {     2, "1c08798dc641aba9dee435e22519a4729a09b2bfe0ff00ef2dcd8ed6f8a07d15eaf4aee52bbf18ab5608a6190f70b90486c8a7d4873710b1115d3debbb4327b5", "da2cfbe2d8409a0f38026113884f84b50156371ae304c4430173d08a99d9fb1b983164a3770706d537f49e0c916d9f32b95cc37a95b99d857436f0232c88a965" },
+    {     3, "40a374727302d9a4769c17b5f409ff32f58aa24ff122d7603e4fda1509e919d4107a52c57570a6d94e50967aea573b11f86f473f537565c66f7039830a85d186", "33d0825dddf7ada99b0e7e307104ad07ca9cfd9692214f1561356315e784f3e5a17e364ae9dbb14cb2036df932b77f4b292761365fb328de7afdc6d8998f5fc1" },
+    {     4, "77ddf4b14425eb3d053c1e84e3469d92c4cd910ed20f92035e0c99d8a7a86cecaf69f9663c20a7aa230bc82f60d22fb4a00b09d3eb8fc65ef547fe63c8d3ddce", "beaa5a3d08f3807143cf621d95cd690514d0b49efff9c91d24b59241ec0eefa5f60196d407048bba8d2146828ebcb0488d8842fd56bb4f6df8e19c4b4daab8ac" },
+    {    63, "d10bf9a15b1c9fc8d41f89bb140bf0be08d2f3666176d13baac4d381358ad074c9d4748c300520eb026daeaea7c5b158892fde4e8ec17dc998dcd507df26eb63", "bd965bf31e87d70327536f2a341cebc4768eca275fa05ef98f7f1b71a0351298de006fba73fe6733ed01d75801b4a928e54231b38e38c562b2e33ea1284992fa" },
+    {    64, "2fc6e69fa26a89a5ed269092cb9b2a449a4409a7a44011eecad13d7c4b0456602d402fa5844f1a7a758136ce3d5d8d0e8b86921ffff4f692dd95bdc8e5ff0052", "65676d800617972fbd87e4b9514e1c67402b7a331096d3bfac22f1abb95374abc942f16e9ab0ead33b87c91968a6e509e119ff07787b3ef483e1dcdccf6e3022" },
+    {    65, "fcbe8be7dcb49a32dbdf239459e26308b84dff1ea480df8d104eeff34b46fae98627b450c2267d48c0946a697c5b59531452ac0484f1c84e3a33d0c339bb2e28", "939fa189699c5d2c81ddd1ffc1fa207c970b6a3685bb29ce1d3e99d42f2f7442da53e95a72907314f4588399a3ff5b0a92beb3f6be2694f9f86ecf2952d5b41c" },
+    {   127, "b6292669ccd38d5f01caae96ba272c76a879a45743afa0725d83b9ebb26665b731f1848c52f11972b6644f554c064fa90780dbbbf3a89d4fc31f67df3e5857ef", "76d2d819c92bce55fa8e092ab1bf9b9eab237a25267986cacf2b8ee14d214d730dc9a5aa2d7b596e86a1fd8fa0804c77402d2fcd45083688b218b1cdfa0dcbcb" },
+    {   128, "2319e3789c47e2daa5fe807f61bec2a1a6537fa03f19ff32e87eecbfd64b7e0e8ccff439ac333b040f19b0c4ddd11a61e24ac1fe0f10a039806c5dcc0da3d115", "72065ee4dd91c2d8509fa1fc28a37c7fc9fa7d5b3f8ad3d0d7a25626b57b1b44788d4caf806290425f9890a3a2a35a905ab4b37acfd0da6e4517b2525c9651e4" },
+    {   129, "f59711d44a031d5f97a9413c065d1e614c417ede998590325f49bad2fd444d3e4418be19aec4e11449ac1a57207898bc57d76a1bcf3566292c20c683a5c4648f", "64475dfe7600d7171bea0b394e27c9b00d8e74dd1e416a79473682ad3dfdbb706631558055cfc8a40e07bd015a4540dcdea15883cbbf31412df1de1cd4152b91" },
+    {   255, "5b21c5fd8868367612474fa2e70e9cfa2201ffeee8fafab5797ad58fefa17c9b5b107da4a3db6320baaf2c8617d5a51df914ae88da3867c2d41f0cc14fa67928", "142709d62e28fcccd0af97fad0f8465b971e82201dc51070faa0372aa43e92484be1c1e73ba10906d5d1853db6a4106e0a7bf9800d373d6dee2d46d62ef2a461" }
+};
+
+static const test_vector blake2s_256_kat[] =
+{
+    {     0, "69217a3079908094e11121d042354a7c1f55b6482ca1a51e1b250dfd1ed0eef9", "48a8997da407876b3d79c0d92325ad3b89cbb754d86ab71aee047ad345fd2c49" },
+    {     1, "e34d74dbaf4ff4c6abd871cc220451d2ea2648846c7757fbaac82fe51ad64bea", "40d15fee7c328830166ac3f918650f807e7e01e177258cdc0a39b11f598066f1" },
+    {     2, "ddad9ab15dac4549ba42f49d262496bef6c0bae1dd342a8808f8ea267c6e210c", "6bb71300644cd3991b26ccd4d274acd1adeab8b1d7914546c1198bbe9fc9d803" },
+    {     3, "e8f91c6ef232a041452ab0e149070cdd7dd1769e75b3a5921be37876c45c9900", "1d220dbe2ee134661fdf6d9e74b41704710556f2f6e5a091b227697445dbea6b" },
+    {     4, "0cc70e00348b86ba2944d0c32038b25c55584f90df2304f55fa332af5fb01e20", "f6c3fbadb4cc687a0064a5be6e791bec63b868ad62fba61b3757ef9ca52e05b2" },
+    {    63, "e57cb79487dd57902432b250733813bd96a84efce59f650fac26e6696aefafc3", "c65382513f07460da39833cb666c5ed82e61b9e998f4b0c4287cee56c3cc9bcd" },
+    {    64, "56f34e8b96557e90c1f24b52d0c89d51086acf1b00f634cf1dde9233b8eaaa3e", "8975b0577fd35566d750b362b0897a26c399136df07bababbde6203ff2954ed4" },
+    {    65, "1b53ee94aaf34e4b159d48de352c7f0661d0a40edff95a0b1639b4090e974472", "21fe0ceb0052be7fb0f004187cacd7de67fa6eb0938d927677f2398c132317a8" },
+    {   127, "f18417b39d617ab1c18fdf91ebd0fc6d5516bb34cf39364037bce81fa04cecb1", "ddbfea75cc467882eb3483ce5e2e756a4f4701b76b445519e89f22d60fa86e06" },
+    {   128, "1fa877de67259d19863a2a34bcc6962a2b25fcbf5cbecd7ede8f1fa36688a796", "0c311f38c35a4fb90d651c289d486856cd1413df9b0677f53ece2cd9e477c60a" },
+    {   129, "5bd169e67c82c2c2e98ef7008bdf261f2ddf30b1c00f9e7f275bb3e8a28dc9a2", "46a73a8dd3e70f59d3942c01df599def783c9da82fd83222cd662b53dce7dbdf" },
+    {   255, "f03f5789d3336b80d002d59fdf918bdb775b00956ed5528e86aa994acb38fe2d", "3fb735061abc519dfe979e54c1ee5bfad0a9d858b3315bad34bde999efd724dd" }
+};
+
+static const test_vector blake2bp_512_kat[] =
+{
+    {     0, "b5ef811a8038f70b628fa8b294daae7492b1ebe343a80eaabbf1f6ae664dd67b9d90b0120791eab81dc96985f28849f6a305186a85501b405114bfa678df9380", "9d9461073e4eb640a255357b839f394b838c6ff57c9b686a3f76107c1066728f3c9956bd785cbc3bf79dc2ab578c5a0c063b9d9c405848de1dbe821cd05c940a" },
+    {     1, "a139280e72757b723e6473d5be59f36e9d50fc5cd7d4585cbc09804895a36c521242fb2789f85cb9e35491f31d4a6952f9d8e097aef94fa1ca0b12525721f03d", "ff8e90a37b94623932c59f7559f26035029c376732cb14d41602001cbb73adb79293a2dbda5f60703025144d158e2735529596251c73c0345ca6fccb1fb1e97e" },
+    {     2, "ef8cda9635d5063af81115da3c52325a86e84074f9f724b7cbd0b0856ff00177cdd283c298326cd0917754c5241f1480fb509cf2d2c449818077ae35fc330737", "d6220ca195a0f356a4795e071cee1f5412ecd95d8a5e01d7c2b86750ca53d7f64c29cbb3d289c6f4ecc6c01e3ca9338971170388e3e40228479006d1bbebad51" },
+    {     3, "8cf933a2d361a3e6a136dbe4a01e7903797ad6ce766e2b91b9b4a4035127d65f4be86550119418e22da00fd06bf2b27596b37f06be0a154aaf7eca54c4520b97", "30302c3fc999065d10dc982c8feef41bbb6642718f624af6e3eabea083e7fe785340db4b0897efff39cee1dc1eb737cd1eea0fe75384984e7d8f446faa683b80" },
+    {     4, "24dc1e6dc4e51a3a3c8da67aacb4c541e41818d180e5bb69753dbbff2f44d0e7da830386bfc83b27a59dbb62b964fc8ea6cbdf3049bff81f24f348db4efd0d07", "32f398a60c1e53f1f81d6d8da2ec1175422d6b2cfa0c0e66d8c4e730b296a4b53e392e39859822a145ae5f1a24c27f55339e2b4b4458e8c5eb19aa14206427aa" },
+    {    63, "0425caaa923b47b35045eb50829c048bc890444afeefc0afc9d1877b821e043c9c7b9d6dc33fbbdfa537c1ece311965b2fee8982bc46a2a750bfc71d79dbea04", "714ad185f1eec43f46b67e992d2d38bc3149e37da7b44748d4d14c161e0878020442149579a865d804b049cd0155ba983378757a1388301bdc0fae2ceaea07dd" },
+    {    64, "6b9d86f15c090a00fc3d907f906c5eb79265e58b88eb64294b4cc4e2b89b1a7c5ee3127ed21b456862de6b2abda59eaacf2dcbe922ca755e40735be81d9c88a5", "22b8249eaf722964ce424f71a74d038ff9b615fba5c7c22cb62797f5398224c3f072ebc1dacba32fc6f66360b3e1658d0fa0da1ed1c1da662a2037da823a3383" },
+    {    65, "146a187a99e8a2d233e0eb373d437b02bfa8d6515b3ca1de48a6b6acf7437eb7e7ac3f2d19ef3bb9b833cc5761dba22d1ad060be76cdcb812d64d578e989a5a4", "b8e903e691b992782528f8db964d08e3baafbd08ba60c72aec0c28ec6bfeca4b2ec4c46f22bf621a5d74f75c0d29693e56c5c584f4399e942f3bd8d38613e639" },
+    {   127, "ea64b003a135766121cfbccbdc08dca2402926be78cea3d0a7253d9ec9e63b8acdd994559917e0e03b5e155f944d7198d99245a794ce19c9b4df4da4a3399334", "7926708859e6e2ab68f604da69a9fb5087bb33f4e8d895730e301ab2d7df748b67df0b6b8622e52dd57d8d3ad87d5820d4ecfd24178b2d2b78d64f4fbd387582" },
+    {   128, "05ad0f271faf7e361320518452813ff9fb9976ac378050b6eefb05f7867b577b8f14475794cff61b2bc062d346a7c65c6e0067c60a374af7940f10aa449d5fb9", "9280f4d1157032ab315c100d636283fbf4fba2fbad0f8bc020721d76bc1c8973ced28871cc907dab60e59756987b0e0f867fa2fe9d9041f2c9618074e44fe5e9" },
+    {   129, "b545880294afa153f8b9f49c73d952b5d1228f1a1ab5ebcb05ff79e560c030f7500fe256a40b6a0e6cb3d42acd4b98595c5b51eaec5ad69cd40f1fc16d2d5f50", "5530c2d59f144872e987e4e258a7d8c38ce844e2cc2eed940ffc683b498815e53adb1faaf568946122805ac3b8e2fed435fed6162e76f564e586ba464424e885" },
+    {   255, "3f35c45d24fcfb4acca651076c08000e279ebbff37a1333ce19fd577202dbd24b58c514e36dd9ba64af4d78eea4e2dd13bc18d798887dd971376bcae0087e17e", "96fbcbb60bd313b8845033e5bc058a38027438572d7e7957f3684f6268aadd3ad08d21767ed6878685331ba98571487e12470aad669326716e46667f69f8d7e8" }
+};
+
+static const test_vector blake2sp_256_kat[] =
+{
+    {     0, "dd0e891776933f43c7d032b08a917e25741f8aa9a12c12e1cac8801500f2ca4f", "715cb13895aeb678f6124160bff21465b30f4f6874193fc851b4621043f09cc6" },
+    {     1, "a6b9eecc25227ad788c99d3f236debc8da408849e9a5178978727a81457f7239", "40578ffa52bf51ae1866f4284d3a157fc1bcd36ac13cbdcb0377e4d0cd0b6603" },
+    {     2, "dacadece7a8e6bf3abfe324ca695436984b8195d29f6bbd896e41e18e21c9145", "67e3097545bad7e852d74d4eb548eca7c219c202a7d088db0efeac0eac304249" },
+    {     3, "ed14413b40da689f1f7fed2b08dff45b8092db5ec2c3610e02724d202f423c46", "8dbcc0589a3d17296a7a58e2f1eff0e2aa4210b58d1f88b86d7ba5f29dd3b583" },
+    {     4, "9b8a527b5272250a1ec397388f040914954806e794db04b70a4611bc59586a83", "a9a9652c8c677594c87212d89d5a75fb31ef4f47c6582cde5f1ef66bd494533a" },
+    {    63, "1024c940be7341449b5010522b509f65bbdc1287b455c2bb7f72b2c92fd0d189", "e85594700e3922a1e8e41eb8b064e7ac6d949d13b5a34523e5a6beac03c8ab29" },
+    {    64, "52603b6cbfad4966cb044cb267568385cf35f21e6c45cf30aed19832cb51e9f5", "1d3701a5661bd31ab20562bd07b74dd19ac8f3524b73ce7bc996b788afd2f317" },
+    {    65, "fff24d3cc729d395daf978b0157306cb495797e6c8dca1731d2f6f81b849baae", "874e1938033d7d383597a2a65f58b554e41106f6d1d50e9ba0eb685f6b6da071" },
+    {   127, "a626543c271fccc3e4450b48d66bc9cbdeb25e5d077a6213cd90cbbd0fd22076", "44cb6311d0750b7e33f7333aa78aaca9c34ad5f79c1b1591ec33951e69c4c461" },
+    {   128, "05cf3a90049116dc60efc31536aaa3d167762994892876dcb7ef3fbecd7449c0", "0c6ce32a3ea05612c5f8090f6a7e87f5ab30e41b707dcbe54155620ad770a340" },
+    {   129, "ccd61c926cc1e5e9128c021c0c6e92aefc4ffbde394dd6f3b7d87a8ced896014", "c65938dd3a053c729cf5b7c89f390bfebb5112766bb00aa5fa3164dfdf3b5647" },
+    {   255, "25059f10605e67adfe681350666e15ae976a5a571c13cf5bc8053f430e120a52", "0c8a36597d7461c63a94732821c941856c668376606c86a52de0ee4104c615db" }
+};
+
+// The truncated variants aren't in the KAT; computed with
+// hashlib.blake2b and hashlib.blake2s from Python, with
+// digest_size=32 and digest_size=16
+
+static const test_vector blake2b_256_kat[] =
+{
+    {     0, "0e5751c026e543b2e8ab2eb06099daa1d1e5df47778f7787faab45cdf12fe3a8", "2fa9fbd9be36437de204e139e97d402bce68c828f43391608c891b5faed8a98a" },
+    {     1, "03170a2e7597b7b7e3d84c05391d139a62b157e78786d8c082f29dcf4c111314", "34758b647135628297fb09c7930cd04e9528e5669112f5b1318493e14de77e55" },
+    {     2, "01cf79da4945c370c68b265ef70641aaa65eaa8f5953e3900d97724c2c5aa095", "2a18c32a9441f937ae772cd14327013e99ce2fea438c3d5b45e25a5d80739a5b" },
+    {     3, "3d8c3d594928271f44aad7a04b177154806867bcf918e1549c0bc16f9da2b09b", "3e57c5ab79418defd6e252719a380096d9abf1901db38e0be7d404eb7206c0dc" },
+    {     4, "e1eae5a8adae652ec9af9677346a9d60eced61e3a0a69bfacf518db31f86e36b", "e3107da536ddba3dc453915100c55d69630b22118da166fd524642c1dac5445f" },
+    {    63, "29e41a64fbdd2fd27612228623c0702222bf367451e7324287f181cb3dcf7237", "6fb66ed039b6f5a082c3b40bce75df2f68be1cdb63cac4b532942c3b703045ac" },
+    {    64, "10d8e6d534b00939843fe9dcc4dae48cdf008f6b8b2b82b156f5404d874887f5", "28c89a7c58f807ae33bc5aae78340e9c565290597436632f4613dbe33192c5db" },
+    {    65, "84c04ab082c8ae24206561f77397704b627892089a05887a2a1996472bcfe15d", "88feea78f5d2fcb7f9cf27953214b14bb1e6d2c1cfde07404ac8dbe02812ab9b" },
+    {   127, "f2fe67ff342e21b8f45e8f2e0bcd1d9243245d50ee6c78042e9c491388791c72", "7c0bfe069b3ba04e2c88bac200999e2b1c9ef2f96f9ffa69b665efca9230c9ab" },
+    {   128, "c3582f71ebb2be66fa5dd750f80baae97554f3b015663c8be377cfcb2488c1d1", "6a591b356f19ca93ae2bcc7406653ff34aea53cea58bec62803e571d94944165" },
+    {   129, "f7f3c46ba2564ff4c4c162da1f5b605f9f1c4aa6a20652a9f9a337c1a2f5b9c9", "20f607da31ed9652deecf4ef78905d4916ba6f5df37bfc4b610d50ba5447623a" },
+    {   255, "1d0850ee9bca0abc9601e9deabe1418fedec2fb6ac4150bd5302d2430f9be943", "fe7b76a61787c089141f9e10fca1e5092488d89c62ea793fb2c5b1f849b4f2cb" }
+};
+
+static const test_vector blake2s_128_kat[] =
+{
+    {     0, "64550d6ffe2c0a01a14aba1eade0200c", "9536f9b267655743dee97b8a670f9f53" },
+    {     1, "9f31f3ec588c6064a8e1f9051aeab90a", "13bacfb85b48a1223c595f8c1e7e82cb" },
+    {     2, "f52b4fc6be5ac0fe16b72622653eb56f", "d47a9b1645e2feae501cd5fe44ce6333" },
+    {     3, "c41561edb251df8f3c9523524d60a707", "1e2a79436a7796a3e9826bfedf07659f" },
+    {     4, "51725a57be12698e2e0d7e98910780a0", "7640360ed3c4f3054dba79a21dda66b7" },
+    {    63, "4006430a2d313751a9ece24fccb52de5", "ece382a8bd5018f1de5da44b72cea75b" },
+    {    64, "dc66ca8f03865801b0ffe06ed8a1a90e", "f1efa90d2547036841ecd3627fafbc36" },
+    {    65, "399d3e92ccfcedcdde9bf4c2be14cf8c", "811ff8686d23a435ecbd0bdafcd27b1b" },
+    {   127, "5d3541be0ce9b6d8f9315862ac0198c5", "25887fab1422700d7fa3edc0b20206e2" },
+    {   128, "7a3b3fa888b60095e7b305efcf3c3dbc", "8c09f698d03eaf88abf69f8147865ef6" },
+    {   129, "dd6146fb0f48a29aa4c813fe75d15941", "5c363ae42a5bec26fbc5e996428d9bd7" },
+    {   255, "b504e782a6ba7a75eca305c265cf3633", "cd075928ab7e6883e697fe7fd3ac43ee" }
+};
+
+// Longer inputs, with the same input and key; computed with hashlib
+// for BLAKE2b and BLAKE2s, and with a separate implementation of the
+// specification, checked against the KAT, for BLAKE2bp and BLAKE2sp
+
+static const test_vector blake2b_512_long[] =
+{
+    {  1000, "9fe687126e6566313081b43167cbfa0b4f721b45a5afd4076af327765d63a616478ffbd1cd5fbe4033e8638b8bcf8de6b3978b54a30f1d9d8d68fbe66c2b74cf", "3a88309ddbb490799a0ac4f3fb7438f7dc8690baecb44e80748deee739e7757c48fead341f9d8a8f50a849ec1a4c3e1170c16d79b4c182732b44f01af28bbef6" },
+    { 10000, "5bda73c62fdc2d0cc0593c94d6777b6b51ec5e00b90afbd291b5036b865b4cbe039e5cfc4fb2878b1c951cd21424228ee497d0fbf52030485bf0e2bf5cf62c35", "831e91953760f2b922e3822281a0df62296426259150f07c20924b11d2e1db971d7f44c925f2a033cb700e9b1db605f6f58953d3ac0425a3abbdb7817b1d87b2" }
+};
+
+static const test_vector blake2s_256_long[] =
+{
+    {  1000, "b5f9d7799111edafc9326fbf667be98140b5e20ce5e151793c59125bf654ac18", "5754feae2a6eefffae7d7c689f2405d1ec46c7e48a9c6187e71c5421a757b95d" },
+    { 10000, "b178a7449b8c7dd7ede9bf9b426a405252514722eabb2b8cf13fb519f59f312c", "7c79e1d65930c8437a7401e7bd3f5497a291001b4ba4b6ca0f2d168969b2f0ca" }
+};
+
+static const test_vector blake2bp_512_long[] =
+{
+    {  1000, "1ce5b8d6f6fcc89fcb6ed29f12796cc210a03f4763e528cb2c0e1b4b1255d6ae86c79332529f6368d0bcfe9d316a5f999a53af47a8f0ec4412ce19156bbafd04", "10e119191da5964afdbf0171f5e062d4123e6c97e759d20d03825be22debc6947ef6c01f5fdac9eb36e3b03955ff28d647caf564f2cb2f203a0cbc90e0dd4dc3" },
+    { 10000, "c89f293aa30fa81048807bb9be246aef3752baeae101951369bc2fd97196f4ff7867348cde4cf25cd4c38f32af12745b64593a4b1a3dfcef6499d1842cc6ae80", "c1c648d18245bedfc16a60eb459964e81cdca68ba9809ceb7d9137cbcb7d9ddaa6b92289afbddb4c04c00d0e25caabd4c237b37eeafd340417f59f5a4658a8f5" }
+};
+
+static const test_vector blake2sp_256_long[] =
+{
+    {  1000, "7e2830f74fc7c4d224a201b46f95e37ebbfb56dddc492f8227e4d905201734b8", "686d695f449e5156d70c54cd7c3f740c9233dca172ffcadba9488414da9c1415" },
+    { 10000, "b29efdd6156fdfd98e4eef8c9b09f033ad6ff21f0edf339e3f78dd91c6a1d9cb", "543aa94317141771aaea8fbf13d54fad82f98e87fc42986307a276a396328f56" }
+};
+
+static const test_vector blake2b_256_long[] =
+{
+    {  1000, "c636324d47d89f2b2434dc2c994100663fbbaea880ff020fc5de89dd0f77a1ec", "218c8e20fa50de8a5271b3fa7495d0cfa08f38bea3b54cfe869300a7eac4ece5" },
+    { 10000, "31ff06272d78ead9b15c724ff129664dfae00df7c93961d7af8b0f41e65e13a4", "d21bfc28ace587c046cd2cb87a0b91949c5dea78dd98bc01ad87160672346a30" }
+};
+
+static const test_vector blake2s_128_long[] =
+{
+    {  1000, "0b94973a96dc199cfbc1ec1e06615c99", "f69872b03760f95ddfb897eede223884" },
+    { 10000, "39e4039c01843d66e31a3479526b4030", "c3179ffd73d9cf66c3a8f1d45063a805" }
+};
+
+static const std::size_t N = 10000;
+
+static unsigned char input[ N ];
+
+static unsigned char key[ 64 ];
+
+template<class H, std::size_t M> void test( test_vector const (&vectors)[ M ], std::size_t key_size )
+{
+    for( std::size_t i = 0; i < M; ++i )
+    {
+        test_vector const & v = vectors[ i ];
+
+        BOOST_TEST_EQ( digest( H(), input, v.n ), std::string( v.hash ) );
+        BOOST_TEST_EQ( digest( H( key, key_size ), input, v.n ), std::string( v.keyed_hash ) );
+    }
+}
+
+// a seed is an eight byte key, little endian
+
+template<class H> void test_seed( char const * expected )
+{
+    unsigned char const seed[ 8 ] = { 0x15, 0x7c, 0x4a, 0x7f, 0xb9, 0x79, 0x37, 0x9e };
+
+    BOOST_TEST_EQ( digest( H( 0x9e3779b97f4a7c15ull ), reinterpret_cast<unsigned char const*>( "abc" ), 3 ), std::string( expected ) );
+    BOOST_TEST_EQ( digest( H( seed, 8 ), reinterpret_cast<unsigned char const*>( "abc" ), 3 ), std::string( expected ) );
+}
+
+int main()
+{
+    using namespace boost::hash2;
+
+    // Test vectors from https://www.rfc-editor.org/rfc/rfc7693, Appendices A and B
+
+    BOOST_TEST_EQ( digest<blake2b_512>( "abc" ), std::string( "ba80a53f981c4d0d6a2797b69f12f6e94c212f14685ac4b74b12bb6fdbffa2d17d87c5392aab792dc252d5de4533cc9518d38aa8dbf1925ab92386edd4009923" ) );
+    BOOST_TEST_EQ( digest<blake2s_256>( "abc" ), std::string( "508c5e8c327c14e2e1a72ba34eeb452f37458b209ed63a294d999b4c86675982" ) );
+
+    // computed as the longer inputs above
+
+    BOOST_TEST_EQ( digest<blake2b_256>( "abc" ), std::string( "bddd813c634239723171ef3fee98579b94964e3bb1cb3e427262c8c068d52319" ) );
+    BOOST_TEST_EQ( digest<blake2s_128>( "abc" ), std::string( "aa4938119b1dc7b87cbad0ffd200d0ae" ) );
+    BOOST_TEST_EQ( digest<blake2bp_512>( "abc" ), std::string( "b91a6b66ae87526c400b0a8b53774dc65284ad8f6575f8148ff93dff943a6ecd8362130f22d6dae633aa0f91df4ac89aaff31d0f1b923c898e82025dedbdad6e" ) );
+    BOOST_TEST_EQ( digest<blake2sp_256>( "abc" ), std::string( "70f75b58f1fecab821db43c88ad84edde5a52600616cd22517b7bb14d440a7d5" ) );
+
+    for( std::size_t i = 0; i < N; ++i )
+    {
+        input[ i ] = static_cast<unsigned char>( i );
+    }
+
+    for( int i = 0; i < 64; ++i )
+    {
+        key[ i ] = static_cast<unsigned char>( i );
+    }
+
+    test<blake2b_512>( blake2b_512_kat, 64 );
+    test<blake2s_256>( blake2s_256_kat, 32 );
+    test<blake2bp_512>( blake2bp_512_kat, 64 );
+    test<blake2sp_256>( blake2sp_256_kat, 32 );
+
+    test<blake2b_256>( blake2b_256_kat, 64 );
+    test<blake2s_128>( blake2s_128_kat, 32 );
+
+    test<blake2b_512>( blake2b_512_long, 64 );
+    test<blake2s_256>( blake2s_256_long, 32 );
+    test<blake2bp_512>( blake2bp_512_long, 64 );
+    test<blake2sp_256>( blake2sp_256_long, 32 );
+    test<blake2b_256>( blake2b_256_long, 64 );
+    test<blake2s_128>( blake2s_128_long, 32 );
+
+    // computed as the longer inputs above
+
+    test_seed<blake2b_512>( "44331e0d0181be1fe2cd215ef88ba2e9ea3b8b5fa9ef7b4f82900f84c202be1e575c423b2c1f53f8c93163acf6300fa179fbcf289431181f632c37dad646f3e1" );
+    test_seed<blake2b_256>( "7d962ecc093439fc0b658ba3845941195e652bab10b7039485d35aa5df80c1e9" );
+    test_seed<blake2s_256>( "361a2fa148cbc27256d171ee3b17b704a9a51c13a2685b3a65a7cea96e7ba13d" );
+    test_seed<blake2s_128>( "4b773f4d3924d10818cc030b738fea5f" );
+    test_seed<blake2bp_512>( "b2f7605a74194ba28477984a4d552cbb4b8e0d733b9c6a12141d811814c164410b83c65e0389465f2cfe412568dfa3f1432126c57d0756f0c033e6a93b57d8fe" );
+    test_seed<blake2sp_256>( "2a5bf008f60c864e3dd85574ea4738944fed5e2587a0c65725c54ba74d9780d9" );
+
+    return boost::report_errors();
+}
@@ -0,0 +1,73 @@
+// Copyright 2024 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/blake3.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <vector>
+#include <string>
+#include <cstddef>
+#include <cstdio>
+
+template<std::size_t N> std::string to_string( std::array<unsigned char, N> const & v )
+{
+    std::string r;
+
+    for( std::size_t i = 0; i < N; ++i )
+    {
+        char buffer[ 8 ];
+
+        std::snprintf( buffer, sizeof( buffer ), "%02x", static_cast<int>( v[ i ] ) );
+
+        r += buffer;
+    }
+
+    return r;
+}
+
+static char const key[] = "whats the Elvish word for friend";
+
+int main()
+{
+    using boost::hash2::blake3;
+
+    std::size_t const N = ( 3 << 20 ) + 12345;
+
+    std::vector<unsigned char> buffer( N );
+
+    for( std::size_t i = 0; i < N; ++i )
+    {
+        buffer[ i ] = static_cast<unsigned char>( i % 251 );
+    }
+
+    unsigned const threads[] = { 0, 1, 2, 3, 4, 8 };
+
+    for( std::size_t i = 0; i < sizeof( threads ) / sizeof( threads[0] ); ++i )
+    {
+        {
+            blake3 h;
+            h.update_parallel( &buffer[ 0 ], N, threads[ i ] );
+
+            BOOST_TEST_EQ( to_string( h.result() ), std::string( "ce1148523b8586723c3fd8b1fe92fe16394888a360c96965bf3b1900421f3e19" ) );
+        }
+
+        {
+            blake3 h( reinterpret_cast<unsigned char const*>( key ), 32 );
+            h.update_parallel( &buffer[ 0 ], N, threads[ i ] );
+
+            BOOST_TEST_EQ( to_string( h.result() ), std::string( "98a38f377bf594f39fee5b1605620ead59b2d8aadc3e98cbb1baed11c17feb33" ) );
+        }
+
+        {
+            // after a partial chunk, the subtrees are no longer aligned
+
+            blake3 h;
+            h.update( &buffer[ 0 ], 1000 );
+            h.update_parallel( &buffer[ 1000 ], N - 1000, threads[ i ] );
+
+            BOOST_TEST_EQ( to_string( h.result() ), std::string( "ce1148523b8586723c3fd8b1fe92fe16394888a360c96965bf3b1900421f3e19" ) );
+        }
+    }
+
+    return boost::report_errors();
+}
@@ -0,0 +1,202 @@
+// Copyright 2024 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/buffered.hpp>
+#include <boost/hash2/hash_append.hpp>
+#include <boost/hash2/fnv1a.hpp>
+#include <boost/hash2/siphash.hpp>
+#include <boost/hash2/xxhash.hpp>
+#include <boost/hash2/murmur3.hpp>
+#include <boost/hash2/md5.hpp>
+#include <boost/hash2/sha1.hpp>
+#include <boost/hash2/sha2.hpp>
+#include <boost/hash2/sha3.hpp>
+#include <boost/hash2/hmac.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <type_traits>
+#include <string>
+#include <vector>
+#include <tuple>
+#include <cstdint>
+#include <cstddef>
+
+// buffered<H, N> must produce the same results as H
+
+struct X
+{
+    int a;
+    std::string b;
+    std::vector<double> c;
+};
+
+template<class H> void hash_append( H & h, X const & x )
+{
+    using boost::hash2::hash_append;
+
+    hash_append( h, x.a );
+    hash_append( h, x.b );
+    hash_append( h, x.c );
+}
+
+template<class H> void feed( H & h, unsigned char const * p, std::size_t n )
+{
+    using boost::hash2::hash_append;
+
+    h.update( p, n );
+
+    // many small writes
+
+    std::vector<std::string> v;
+
+    for( std::size_t i = 0; i < n; i += i / 4 + 1 )
+    {
+        v.push_back( std::string( p, p + i ) );
+    }
+
+    hash_append( h, v );
+    hash_append( h, std::make_tuple( 1, 'x', 2.5, std::string( "tuple" ) ) );
+
+    X x = { -7, std::string( p, p + n / 2 ), std::vector<double>( n % 19, 0.25 ) };
+    hash_append( h, x );
+
+    // irregular chunk sizes
+
+    for( std::size_t i = 0, k = 1; i < n; i += k, k = k * 3 % 257 )
+    {
+        h.update( p + i, k < n - i? k: n - i );
+    }
+}
+
+template<class H, class B> void test( H h1, B h2, unsigned char const * p, std::size_t n )
+{
+    for( int i = 0; i < 3; ++i )
+    {
+        feed( h1, p, n );
+        feed( h2, p, n );
+
+        BOOST_TEST( h2.result() == h1.result() );
+    }
+}
+
+template<class H, std::size_t N> void test()
+{
+    typedef boost::hash2::buffered<H, N> B;
+
+    unsigned char data[ 601 ];
+
+    for( int i = 0; i < 601; ++i )
+    {
+        data[ i ] = static_cast<unsigned char>( i * 7 + 3 );
+    }
+
+    unsigned char const seed[] = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17 };
+
+    // unaligned
+    unsigned char const* p = data + 1;
+
+    for( std::size_t n = 0; n <= 600; n += n / 8 + 1 )
+    {
+        test( H(), B(), p, n );
+        test( H( 0x0123456789ABCDEFull ), B( 0x0123456789ABCDEFull ), p, n );
+        test( H( seed, sizeof( seed ) ), B( seed, sizeof( seed ) ), p, n );
+    }
+}
+
+template<class H> void test()
+{
+    test<H, 64>();
+    test<H, 1>();
+    test<H, 7>();
+    test<H, 128>();
+}
+
+template<class H, class = void> struct has_block_size: std::false_type
+{
+};
+
+template<class H> struct has_block_size<H, decltype( (void)H::block_size )>: std::true_type
+{
+};
+
+int main()
+{
+    test<boost::hash2::fnv1a_32>();
+    test<boost::hash2::fnv1a_64>();
+    test<boost::hash2::murmur3_32>();
+    test<boost::hash2::murmur3_128>();
+    test<boost::hash2::xxhash_32>();
+    test<boost::hash2::xxhash_64>();
+    test<boost::hash2::siphash_32>();
+    test<boost::hash2::siphash_64>();
+    test<boost::hash2::md5_128>();
+    test<boost::hash2::sha1_160>();
+    test<boost::hash2::sha2_256>();
+    test<boost::hash2::sha2_512>();
+    test<boost::hash2::sha3_256>();
+    test<boost::hash2::shake_128>();
+
+    unsigned char data[ 301 ];
+
+    for( int i = 0; i < 301; ++i )
+    {
+        data[ i ] = static_cast<unsigned char>( i * 7 + 3 );
+    }
+
+    // other constructors of H
+
+    {
+        typedef boost::hash2::murmur3_128 H;
+        typedef boost::hash2::buffered<H, 7> B;
+
+        for( std::size_t n = 0; n <= 300; n += n / 8 + 1 )
+        {
+            test( H( 0x0123456789ABCDEFull, 0xFEDCBA9876543210ull ), B( 0x0123456789ABCDEFull, 0xFEDCBA9876543210ull ), data + 1, n );
+        }
+    }
+
+    // copies, not a forwarding of *this to H
+
+    {
+        typedef boost::hash2::buffered<boost::hash2::xxhash_64, 7> B;
+
+        B h1( 0x0123456789ABCDEFull );
+        h1.update( data, 5 );
+
+        B h2( h1 );
+
+        h1.update( data + 5, 9 );
+        h2.update( data + 5, 9 );
+
+        BOOST_TEST_EQ( h1.result(), h2.result() );
+    }
+
+    // block_size, when H has it, for hmac
+
+    {
+        int const m1 = boost::hash2::buffered<boost::hash2::sha2_256>::block_size;
+        BOOST_TEST_EQ( m1, 64 );
+
+        int const m2 = boost::hash2::buffered<boost::hash2::sha2_512, 7>::block_size;
+        BOOST_TEST_EQ( m2, 128 );
+
+        BOOST_TEST( !has_block_size< boost::hash2::buffered<boost::hash2::xxhash_64> >::value );
+    }
+
+    {
+        typedef boost::hash2::hmac_sha2_256 H;
+        typedef boost::hash2::hmac< boost::hash2::buffered<boost::hash2::sha2_256> > B;
+
+        unsigned char const key[] = "key";
+
+        for( std::size_t n = 0; n <= 300; n += n / 8 + 1 )
+        {
+            test( H(), B(), data + 1, n );
+            test( H( 0x0123456789ABCDEFull ), B( 0x0123456789ABCDEFull ), data + 1, n );
+            test( H( key, 3 ), B( key, 3 ), data + 1, n );
+            test( H( data, 200 ), B( data, 200 ), data + 1, n );
+        }
+    }
+
+    return boost::report_errors();
+}
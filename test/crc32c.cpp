@@ -0,0 +1,132 @@
+// Copyright 2024 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/crc.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <cstring>
+#include <cstdint>
+#include <cstddef>
+
+template<class H> typename H::result_type hash( H h, void const * p, std::size_t n )
+{
+    h.update( p, n );
+    return h.result();
+}
+
+template<class H> typename H::result_type hash( char const * s )
+{
+    return hash( H(), s, std::strlen( s ) );
+}
+
+// the definition, one bit at a time
+
+std::uint32_t crc32c_bitwise( unsigned char const * p, std::size_t n )
+{
+    std::uint32_t c = 0xFFFFFFFFul;
+
+    for( std::size_t i = 0; i < n; ++i )
+    {
+        c ^= p[ i ];
+
+        for( int j = 0; j < 8; ++j )
+        {
+            c = ( c & 1 )? ( c >> 1 ) ^ 0x82F63B78ul: c >> 1;
+        }
+    }
+
+    return ~c;
+}
+
+static const std::size_t N = 10000;
+static unsigned char buffer[ N + 1 ];
+
+int main()
+{
+    using namespace boost::hash2;
+
+    // Check value from https://reveng.sourceforge.io/crc-catalogue/17plus.htm#crc.cat.crc-32-iscsi
+
+    BOOST_TEST_EQ( hash<crc32c>( "123456789" ), 0xE3069283ul );
+
+    // Test vectors from https://www.rfc-editor.org/rfc/rfc3720#appendix-B.4
+
+    {
+        unsigned char v[ 32 ];
+
+        std::memset( v, 0, 32 );
+        BOOST_TEST_EQ( hash( crc32c(), v, 32 ), 0x8A9136AAul );
+
+        std::memset( v, 0xFF, 32 );
+        BOOST_TEST_EQ( hash( crc32c(), v, 32 ), 0x62A8AB43ul );
+
+        for( int i = 0; i < 32; ++i ) v[ i ] = static_cast<unsigned char>( i );
+        BOOST_TEST_EQ( hash( crc32c(), v, 32 ), 0x46DD794Eul );
+
+        for( int i = 0; i < 32; ++i ) v[ i ] = static_cast<unsigned char>( 31 - i );
+        BOOST_TEST_EQ( hash( crc32c(), v, 32 ), 0x113FDB5Cul );
+    }
+
+    // the table driven and vectorized paths must match the definition
+
+    for( std::size_t i = 0; i < N + 1; ++i )
+    {
+        buffer[ i ] = static_cast<unsigned char>( i ^ ( i >> 8 ) );
+    }
+
+    // unaligned
+    unsigned char const * p = buffer + 1;
+
+    for( std::size_t n = 0; n <= N; n += n < 1100? 1: n / 16 )
+    {
+        BOOST_TEST_EQ( hash( crc32c(), p, n ), crc32c_bitwise( p, n ) );
+    }
+
+    // a seed is hashed as 8 bytes, or as 4 bytes when it fits
+
+    {
+        unsigned char const s8[] = { 0x15, 0x7c, 0x4a, 0x7f, 0xb9, 0x79, 0x37, 0x9e, 'a', 'b', 'c' };
+        BOOST_TEST_EQ( hash( crc32c( 0x9e3779b97f4a7c15ull ), "abc", 3 ), crc32c_bitwise( s8, 11 ) );
+
+        unsigned char const s4[] = { 0x15, 0x7c, 0x4a, 0x7f, 'a', 'b', 'c' };
+        BOOST_TEST_EQ( hash( crc32c( 0x7f4a7c15ull ), "abc", 3 ), crc32c_bitwise( s4, 7 ) );
+    }
+
+    // a second result() continues as if by update( "\xFF", 1 )
+
+    {
+        unsigned char tmp[ 1001 ];
+
+        std::memcpy( tmp, p, 1000 );
+        tmp[ 1000 ] = 0xFF;
+
+        crc32c h;
+
+        h.update( p, 1000 );
+
+        BOOST_TEST_EQ( h.result(), crc32c_bitwise( tmp, 1000 ) );
+        BOOST_TEST_EQ( h.result(), crc32c_bitwise( tmp, 1001 ) );
+    }
+
+    // crc32c_combine( crc( A ), crc( B ), len( B ) ) == crc( A + B )
+
+    {
+        std::size_t const lengths[] = { 0, 1, 7, 64, 255, 1000, 3072, 5000, N };
+        std::size_t const M = sizeof( lengths ) / sizeof( lengths[0] );
+
+        for( std::size_t i = 0; i < M; ++i )
+        {
+            for( std::size_t j = 0; j < M; ++j )
+            {
+                std::size_t n1 = lengths[ i ];
+                std::size_t n2 = lengths[ j ];
+
+                if( n1 + n2 > N ) continue;
+
+                BOOST_TEST_EQ( crc32c_combine( hash( crc32c(), p, n1 ), hash( crc32c(), p + n1, n2 ), n2 ), hash( crc32c(), p, n1 + n2 ) );
+            }
+        }
+    }
+
+    return boost::report_errors();
+}
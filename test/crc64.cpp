@@ -0,0 +1,140 @@
+// Copyright 2024 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/crc.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <cstring>
+#include <cstdint>
+#include <cstddef>
+
+template<class H> typename H::result_type hash( H h, void const * p, std::size_t n )
+{
+    h.update( p, n );
+    return h.result();
+}
+
+template<class H> typename H::result_type hash( char const * s )
+{
+    return hash( H(), s, std::strlen( s ) );
+}
+
+// the definition, one bit at a time
+
+std::uint64_t crc64_bitwise( std::uint64_t poly, unsigned char const * p, std::size_t n )
+{
+    std::uint64_t c = ~std::uint64_t( 0 );
+
+    for( std::size_t i = 0; i < n; ++i )
+    {
+        c ^= p[ i ];
+
+        for( int j = 0; j < 8; ++j )
+        {
+            c = ( c & 1 )? ( c >> 1 ) ^ poly: c >> 1;
+        }
+    }
+
+    return ~c;
+}
+
+static const std::size_t N = 10000;
+static unsigned char buffer[ N + 1 ];
+
+template<class H, class F> void test( std::uint64_t poly, F combine )
+{
+    // unaligned
+    unsigned char const * p = buffer + 1;
+
+    // the table driven and vectorized paths must match the definition
+
+    for( std::size_t n = 0; n <= N; n += n < 1100? 1: n / 16 )
+    {
+        BOOST_TEST_EQ( hash( H(), p, n ), crc64_bitwise( poly, p, n ) );
+    }
+
+    // a seed is hashed as 8 bytes, or as 4 bytes when it fits
+
+    {
+        unsigned char const s8[] = { 0x15, 0x7c, 0x4a, 0x7f, 0xb9, 0x79, 0x37, 0x9e, 'a', 'b', 'c' };
+        BOOST_TEST_EQ( hash( H( 0x9e3779b97f4a7c15ull ), "abc", 3 ), crc64_bitwise( poly, s8, 11 ) );
+
+        unsigned char const s4[] = { 0x15, 0x7c, 0x4a, 0x7f, 'a', 'b', 'c' };
+        BOOST_TEST_EQ( hash( H( 0x7f4a7c15ull ), "abc", 3 ), crc64_bitwise( poly, s4, 7 ) );
+    }
+
+    // a second result() continues as if by update( "\xFF", 1 )
+
+    {
+        unsigned char tmp[ 1001 ];
+
+        std::memcpy( tmp, p, 1000 );
+        tmp[ 1000 ] = 0xFF;
+
+        H h;
+
+        h.update( p, 1000 );
+
+        BOOST_TEST_EQ( h.result(), crc64_bitwise( poly, tmp, 1000 ) );
+        BOOST_TEST_EQ( h.result(), crc64_bitwise( poly, tmp, 1001 ) );
+    }
+
+    // combine( crc( A ), crc( B ), len( B ) ) == crc( A + B )
+
+    {
+        std::size_t const lengths[] = { 0, 1, 7, 64, 255, 1000, 3072, 5000, N };
+        std::size_t const M = sizeof( lengths ) / sizeof( lengths[0] );
+
+        for( std::size_t i = 0; i < M; ++i )
+        {
+            for( std::size_t j = 0; j < M; ++j )
+            {
+                std::size_t n1 = lengths[ i ];
+                std::size_t n2 = lengths[ j ];
+
+                if( n1 + n2 > N ) continue;
+
+                BOOST_TEST_EQ( combine( hash( H(), p, n1 ), hash( H(), p + n1, n2 ), n2 ), hash( H(), p, n1 + n2 ) );
+            }
+        }
+    }
+}
+
+int main()
+{
+    using namespace boost::hash2;
+
+    // Check values from https://reveng.sourceforge.io/crc-catalogue/17plus.htm#crc.cat-bits.64
+
+    BOOST_TEST_EQ( hash<crc64_xz>( "123456789" ), 0x995DC9BBDF1939FAull );
+    BOOST_TEST_EQ( hash<crc64_nvme>( "123456789" ), 0xAE8B14860A799888ull );
+
+    // Test vectors from the NVM Express NVM Command Set Specification,
+    // the 64b CRC test cases, https://nvmexpress.org/specifications/
+
+    {
+        unsigned char v[ 4096 ];
+
+        std::memset( v, 0, 4096 );
+        BOOST_TEST_EQ( hash( crc64_nvme(), v, 4096 ), 0x6482D367EB22B64Eull );
+
+        std::memset( v, 0xFF, 4096 );
+        BOOST_TEST_EQ( hash( crc64_nvme(), v, 4096 ), 0xC0DDBA7302ECA3ACull );
+
+        for( int i = 0; i < 4096; ++i ) v[ i ] = static_cast<unsigned char>( i );
+        BOOST_TEST_EQ( hash( crc64_nvme(), v, 4096 ), 0x3E729F5F6750449Cull );
+
+        for( int i = 0; i < 4096; ++i ) v[ i ] = static_cast<unsigned char>( 255 - i );
+        BOOST_TEST_EQ( hash( crc64_nvme(), v, 4096 ), 0x9A2DF64B8E9E517Eull );
+    }
+
+    for( std::size_t i = 0; i < N + 1; ++i )
+    {
+        buffer[ i ] = static_cast<unsigned char>( i ^ ( i >> 8 ) );
+    }
+
+    test<crc64_xz>( 0xC96C5795D7870F42ull, crc64_xz_combine );
+    test<crc64_nvme>( 0x9A6C9329AC4BC9B5ull, crc64_nvme_combine );
+
+    return boost::report_errors();
+}
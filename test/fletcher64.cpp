@@ -0,0 +1,137 @@
+// Copyright 2024 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/fletcher.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <cstring>
+#include <cstdint>
+#include <cstddef>
+
+template<class H> typename H::result_type hash( H h, void const * p, std::size_t n )
+{
+    h.update( p, n );
+    return h.result();
+}
+
+template<class H> typename H::result_type hash( char const * s )
+{
+    return hash( H(), s, std::strlen( s ) );
+}
+
+// the definition, one little-endian word at a time, with
+// a trailing partial word padded with zeros
+
+std::uint64_t fletcher64_wordwise( unsigned char const * p, std::size_t n )
+{
+    std::uint64_t s1 = 0, s2 = 0;
+
+    for( std::size_t i = 0; i < n; i += 4 )
+    {
+        std::uint64_t w = 0;
+
+        for( std::size_t j = 0; j < 4 && i + j < n; ++j )
+        {
+            w |= static_cast<std::uint64_t>( p[ i + j ] ) << ( 8 * j );
+        }
+
+        s1 = ( s1 + w ) % 0xFFFFFFFFu;
+        s2 = ( s2 + s1 ) % 0xFFFFFFFFu;
+    }
+
+    return ( s2 << 32 ) | s1;
+}
+
+static const std::size_t N = 100000;
+static unsigned char buffer[ N + 1 ];
+
+static void test_wordwise( unsigned char const * p )
+{
+    for( std::size_t n = 0; n <= N; n += n < 1100? 1: n / 16 )
+    {
+        BOOST_TEST_EQ( hash( boost::hash2::fletcher64(), p, n ), fletcher64_wordwise( p, n ) );
+    }
+}
+
+int main()
+{
+    using namespace boost::hash2;
+
+    // Test vectors from https://en.wikipedia.org/wiki/Fletcher%27s_checksum
+
+    BOOST_TEST_EQ( hash<fletcher64>( "abcde" ), 0xC8C6C527646362C6ull );
+    BOOST_TEST_EQ( hash<fletcher64>( "abcdef" ), 0xC8C72B276463C8C6ull );
+    BOOST_TEST_EQ( hash<fletcher64>( "abcdefgh" ), 0x312E2B28CCCAC8C6ull );
+
+    // unaligned
+    unsigned char * p = buffer + 1;
+
+    // the sums must not overflow between reductions
+
+    std::memset( p, 0xFF, N );
+    test_wordwise( p );
+
+    // the vectorized path must match the definition
+
+    for( std::size_t i = 0; i < N + 1; ++i )
+    {
+        buffer[ i ] = static_cast<unsigned char>( i ^ ( i >> 8 ) );
+    }
+
+    test_wordwise( p );
+
+    // a seed is hashed as 8 bytes
+
+    {
+        unsigned char const s1[] = { 0x15, 0x7c, 0x4a, 0x7f, 0xb9, 0x79, 0x37, 0x9e, 'a', 'b', 'c' };
+        BOOST_TEST_EQ( hash( fletcher64( 0x9e3779b97f4a7c15ull ), "abc", 3 ), fletcher64_wordwise( s1, 11 ) );
+
+        unsigned char const s2[] = { 0x15, 0x7c, 0x4a, 0x7f, 0, 0, 0, 0, 'a', 'b', 'c' };
+        BOOST_TEST_EQ( hash( fletcher64( 0x7f4a7c15ull ), "abc", 3 ), fletcher64_wordwise( s2, 11 ) );
+    }
+
+    // a second result() continues as if by update( "\xFF\0\0\0", 4 ),
+    // after the trailing partial word
+
+    {
+        unsigned char tmp[ 1004 ];
+
+        std::memcpy( tmp, p, 999 );
+        tmp[ 999 ] = 0;
+
+        tmp[ 1000 ] = 0xFF;
+        tmp[ 1001 ] = 0;
+        tmp[ 1002 ] = 0;
+        tmp[ 1003 ] = 0;
+
+        fletcher64 h;
+
+        h.update( p, 999 );
+
+        BOOST_TEST_EQ( h.result(), fletcher64_wordwise( tmp, 999 ) );
+        BOOST_TEST_EQ( h.result(), fletcher64_wordwise( tmp, 1004 ) );
+    }
+
+    // fletcher64_combine( f( A ), f( B ), len( B ) ) == f( A + B ),
+    // when len( A ) is a multiple of four
+
+    {
+        std::size_t const lengths[] = { 0, 1, 7, 64, 255, 1000, 16384, 65536, N };
+        std::size_t const M = sizeof( lengths ) / sizeof( lengths[0] );
+
+        for( std::size_t i = 0; i < M; ++i )
+        {
+            for( std::size_t j = 0; j < M; ++j )
+            {
+                std::size_t n1 = lengths[ i ];
+                std::size_t n2 = lengths[ j ];
+
+                if( n1 % 4 != 0 || n1 + n2 > N ) continue;
+
+                BOOST_TEST_EQ( fletcher64_combine( hash( fletcher64(), p, n1 ), hash( fletcher64(), p + n1, n2 ), n2 ), hash( fletcher64(), p, n1 + n2 ) );
+            }
+        }
+    }
+
+    return boost::report_errors();
+}
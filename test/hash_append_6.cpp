@@ -0,0 +1,156 @@
+// Copyright 2024 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// Endian-dependent test
+
+#include <boost/hash2/hash_append.hpp>
+#include <boost/hash2/fnv1a.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <type_traits>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+// counts the update() calls
+
+class counting_fnv1a_64
+{
+private:
+
+    boost::hash2::fnv1a_64 h_;
+
+public:
+
+    typedef boost::hash2::fnv1a_64::result_type result_type;
+    typedef boost::hash2::fnv1a_64::size_type size_type;
+
+    int n_ = 0;
+
+    void update( void const * p, std::size_t n )
+    {
+        h_.update( p, n );
+        ++n_;
+    }
+
+    result_type result()
+    {
+        return h_.result();
+    }
+};
+
+// opts in explicitly
+struct U
+{
+    short a;
+    short b;
+};
+
+namespace boost
+{
+namespace hash2
+{
+
+template<> struct is_trivially_equality_comparable<U>: std::true_type
+{
+};
+
+} // namespace hash2
+} // namespace boost
+
+// no padding, but has its own hash_append, which doesn't use b
+struct S
+{
+    std::uint32_t a;
+    std::uint32_t b;
+
+    template<class H> friend void do_hash_append( H& h, S const& s )
+    {
+        boost::hash2::hash_append( h, s.a );
+    }
+};
+
+// no padding, and a hash_append for fnv1a_64 only, which doesn't use b
+struct C
+{
+    std::uint32_t a;
+    std::uint32_t b;
+};
+
+void hash_append( boost::hash2::fnv1a_64 & h, C const & c )
+{
+    boost::hash2::hash_append( h, c.a );
+}
+
+template<class T> void test( T const* first, std::size_t n, int calls )
+{
+    std::vector<T> v( first, first + n );
+
+    counting_fnv1a_64 h1;
+    boost::hash2::hash_append( h1, v );
+
+    BOOST_TEST_EQ( h1.n_, calls );
+
+    boost::hash2::fnv1a_64 h2;
+    h2.update( v.data(), v.size() * sizeof(T) );
+    boost::hash2::hash_append_size( h2, v.size() );
+
+    BOOST_TEST_EQ( h1.result(), h2.result() );
+}
+
+int main()
+{
+    {
+        U const v[] = { { 1, 2 }, { 3, 4 }, { -5, -6 } };
+
+        // one call for the elements, one for the size
+        test( v, 3, 2 );
+    }
+
+    {
+        S const v1[] = { { 1, 2 }, { 3, 4 } };
+        S const v2[] = { { 1, 7 }, { 3, 8 } };
+
+        counting_fnv1a_64 h1;
+        boost::hash2::hash_append( h1, std::vector<S>( v1, v1 + 2 ) );
+
+        BOOST_TEST_EQ( h1.n_, 3 );
+
+        counting_fnv1a_64 h2;
+        boost::hash2::hash_append( h2, std::vector<S>( v2, v2 + 2 ) );
+
+        BOOST_TEST_EQ( h1.result(), h2.result() );
+    }
+
+    {
+#if defined(__cpp_lib_has_unique_object_representations) && __cpp_lib_has_unique_object_representations >= 201606L
+
+        // so a deduced is_trivially_equality_comparable would bypass hash_append
+        BOOST_TEST( std::has_unique_object_representations<C>::value );
+
+#endif
+
+        C const v1[] = { { 1, 2 }, { 3, 4 } };
+        C const v2[] = { { 1, 7 }, { 3, 8 } };
+
+        boost::hash2::fnv1a_64 h1;
+        boost::hash2::hash_append( h1, std::vector<C>( v1, v1 + 2 ) );
+
+        boost::hash2::fnv1a_64 h2;
+        boost::hash2::hash_append( h2, std::vector<C>( v2, v2 + 2 ) );
+
+        BOOST_TEST_EQ( h1.result(), h2.result() );
+
+        using boost::hash2::hash_append;
+
+        boost::hash2::fnv1a_64 h3;
+        hash_append( h3, v1[ 0 ] );
+
+        boost::hash2::fnv1a_64 h4;
+        hash_append( h4, v2[ 0 ] );
+
+        BOOST_TEST_EQ( h3.result(), h4.result() );
+    }
+
+    return boost::report_errors();
+}
@@ -0,0 +1,118 @@
+// Copyright 2024 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+// the lanes are used on AVX2 only by default, and for xxhash_64 on request
+#define BOOST_HASH2_BATCH_LANES
+#define BOOST_HASH2_XXHASH64_SIMD
+
+#include <boost/hash2/hash_batch.hpp>
+#include <boost/hash2/murmur3.hpp>
+#include <boost/hash2/xxhash.hpp>
+#include <boost/hash2/siphash.hpp>
+#include <boost/hash2/xxh3.hpp>
+#include <boost/hash2/sha2.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <cstdint>
+#include <cstddef>
+#include <string>
+#include <vector>
+#include <random>
+#include <algorithm>
+#include <iterator>
+
+// hash_batch<H> must store H::hash( k.data(), k.size(), seed )
+// for each key, in order
+
+template<class H> void test( std::vector<std::string> const & v, std::uint64_t seed )
+{
+    typedef typename H::result_type R;
+
+    // batches that are not a multiple of the lane count
+    for( std::size_t m = 0; m <= 19; ++m )
+    {
+        std::vector<R> r( m + 1 );
+
+        R* p = boost::hash2::hash_batch<H>( v.begin(), v.begin() + m, seed, r.data() );
+
+        BOOST_TEST_EQ( p - r.data(), static_cast<std::ptrdiff_t>( m ) );
+
+        for( std::size_t i = 0; i < m; ++i )
+        {
+            H h( seed );
+            h.update( v[ i ].data(), v[ i ].size() );
+
+            BOOST_TEST( r[ i ] == h.result() );
+        }
+    }
+
+    {
+        std::vector<R> r;
+        boost::hash2::hash_batch<H>( v.begin(), v.end(), seed, std::back_inserter( r ) );
+
+        BOOST_TEST_EQ( r.size(), v.size() );
+
+        for( std::size_t i = 0; i < r.size(); ++i )
+        {
+            H h( seed );
+            h.update( v[ i ].data(), v[ i ].size() );
+
+            BOOST_TEST( r[ i ] == h.result() );
+        }
+    }
+}
+
+template<class H> void test( std::vector<std::string> const & v )
+{
+    test<H>( v, 0 );
+    test<H>( v, 7 );
+    test<H>( v, 0x0123456789ABCDEFull );
+}
+
+int main()
+{
+    std::vector<std::string> v;
+
+    {
+        std::mt19937 rng;
+
+        // every length up to 300, shuffled, so that the lanes finish at different times
+        for( std::size_t n = 0; n <= 300; ++n )
+        {
+            std::string s;
+
+            for( std::size_t i = 0; i < n; ++i )
+            {
+                s += static_cast<char>( rng() );
+            }
+
+            v.push_back( s );
+        }
+
+        std::shuffle( v.begin(), v.end(), rng );
+
+        // same lengths in a batch
+        v.push_back( std::string( 64, 'x' ) );
+        v.push_back( std::string( 64, 'y' ) );
+        v.push_back( std::string( 64, 'z' ) );
+        v.push_back( std::string( 64, 'w' ) );
+
+        // long keys
+        for( std::size_t n = 1000; n <= 1100; n += 5 )
+        {
+            v.push_back( std::string( n, static_cast<char>( n ) ) );
+            v.push_back( std::string( n / 10, static_cast<char>( n ) ) );
+        }
+    }
+
+    test<boost::hash2::murmur3_32>( v );
+    test<boost::hash2::xxhash_32>( v );
+    test<boost::hash2::xxhash_64>( v );
+    test<boost::hash2::siphash_64>( v );
+    test<boost::hash2::siphash13_64>( v );
+    test<boost::hash2::siphash_32>( v );
+    test<boost::hash2::xxh3_64>( v );
+    test<boost::hash2::sha2_256>( v );
+
+    return boost::report_errors();
+}
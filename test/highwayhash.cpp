@@ -0,0 +1,187 @@
+// Copyright 2024 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/highwayhash.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <string>
+#include <cstring>
+#include <cstdint>
+#include <cstddef>
+#include <cstdio>
+
+template<std::size_t N> std::string to_string( std::array<unsigned char, N> const & v )
+{
+    char buffer[ 2 * N + 1 ];
+
+    for( std::size_t i = 0; i < N; ++i )
+    {
+        std::snprintf( buffer + 2 * i, 3, "%02x", v[ i ] );
+    }
+
+    return std::string( buffer, 2 * N );
+}
+
+template<class H> typename H::result_type hash( H h, unsigned char const * p, std::size_t n )
+{
+    h.update( p, n );
+    return h.result();
+}
+
+// Test vectors from https://github.com/google/highwayhash/blob/master/highwayhash/highwayhash_test.cc;
+// the key is
+// { 0x0706050403020100, 0x0F0E0D0C0B0A0908, 0x1716151413121110, 0x1F1E1D1C1B1A1918 }
+// and input[ i ] = i, for sizes 0 to 64. The 128 and 256 bit results
+// are the 64 bit words of the reference, little endian
+
+static const std::uint64_t highwayhash_64_vectors[] =
+{
+    0x907A56DE22C26E53ull,
+    0x7EAB43AAC7CDDD78ull,
+    0xB8D0569AB0B53D62ull,
+    0x5C6BEFAB8A463D80ull,
+    0xF205A46893007EDAull,
+    0x2B8A1668E4A94541ull,
+    0xBD4CCC325BEFCA6Full,
+    0x4D02AE1738F59482ull,
+    0xE1205108E55F3171ull,
+    0x32D2644EC77A1584ull,
+    0xF6E10ACDB103A90Bull,
+    0xC3BBF4615B415C15ull,
+    0x243CC2040063FA9Cull,
+    0xA89A58CE65E641FFull,
+    0x24B031A348455A23ull,
+    0x40793F86A449F33Bull,
+    0xCFAB3489F97EB832ull,
+    0x19FE67D2C8C5C0E2ull,
+    0x04DD90A69C565CC2ull,
+    0x75D9518E2371C504ull,
+    0x38AD9B1141D3DD16ull,
+    0x0264432CCD8A70E0ull,
+    0xA9DB5A6288683390ull,
+    0xD7B05492003F028Cull,
+    0x205F615AEA59E51Eull,
+    0xEEE0C89621052884ull,
+    0x1BFC1A93A7284F4Full,
+    0x512175B5B70DA91Dull,
+    0xF71F8976A0A2C639ull,
+    0xAE093FEF1F84E3E7ull,
+    0x22CA92B01161860Full,
+    0x9FC7007CCF035A68ull,
+    0xA0C964D9ECD580FCull,
+    0x2C90F73CA03181FCull,
+    0x185CF84E5691EB9Eull,
+    0x4FC1F5EF2752AA9Bull,
+    0xF5B7391A5E0A33EBull,
+    0xB9B84B83B4E96C9Cull,
+    0x5E42FE712A5CD9B4ull,
+    0xA150F2F90C3F97DCull,
+    0x7FA522D75E2D637Dull,
+    0x181AD0CC0DFFD32Bull,
+    0x3889ED981E854028ull,
+    0xFB4297E8C586EE2Dull,
+    0x6D064A45BB28059Cull,
+    0x90563609B3EC860Cull,
+    0x7AA4FCE94097C666ull,
+    0x1326BAC06B911E08ull,
+    0xB926168D2B154F34ull,
+    0x9919848945B1948Dull,
+    0xA2A98FC534825EBEull,
+    0xE9809095213EF0B6ull,
+    0x582E5483707BC0E9ull,
+    0x086E9414A88A6AF5ull,
+    0xEE86B98D20F6743Dull,
+    0xF89B7FF609B1C0A7ull,
+    0x4C7D9CC19E22C3E8ull,
+    0x9A97005024562A6Full,
+    0x5DD41CF423E6EBEFull,
+    0xDF13609C0468E227ull,
+    0x6E0DA4F64188155Aull,
+    0xB755BA4B50D7D4A1ull,
+    0x887A3484647479BDull,
+    0xAB8EEBE9BF2139A0ull,
+    0x75542C5D4CD2A6FFull
+};
+
+struct test_vector
+{
+    std::size_t n;
+    char const * r;
+};
+
+static const test_vector highwayhash_128_vectors[] =
+{
+    {  0, "c7fe8f9d8f26ed0f6f3e097f765e5633" },
+    {  1, "a8e7813689a8b0d6b4dc9cebf91d29dc" },
+    {  3, "eb0b5f291b62070679ddced90f9ae6bf" },
+    {  4, "9ee4ac6db49e392608923139d02a922e" },
+    {  7, "b4717169ca1f402a6c79029fff031fbe" },
+    {  8, "e8520528846de9a1c20aec3bc6f15c69" },
+    { 15, "54afc42ba5372214d7bc266e0b6c79e0" },
+    { 16, "ad01a4d5ff604441c8189f01d5a39e02" },
+    { 17, "62991cc5964b2ac5a05e9b16b178b8ec" },
+    { 31, "297ca5e865b4e70646d4f5073a5e4152" },
+    { 32, "aa4a43c166df8419b9e4b3f95819fc16" },
+    { 33, "6cc3c6e0af7816119d84a2e59db558f9" },
+    { 63, "f03e2f021870bd74cb4b5fada894ea3a" },
+    { 64, "f2c4d498711fbb98c88f91de7105bce0" }
+};
+
+static const test_vector highwayhash_256_vectors[] =
+{
+    {  0, "f574c8c22a4844dd1f35c713730146d9ff1487b9ccbeaeb3f41d75453123da41" },
+    {  1, "54825fe4bc41b9ed0fc6ca3def440de2474a32cb9b1b657284e475b24c627320" },
+    {  3, "5cd9d10dd7a00a48d0d111697c5e22895a86bb8b6b42a88e22c7e190c3fb3de2" },
+    {  4, "dce42b2197c4cfc99b92d2aff69d5fa89e10f41d219fda1f9b4f4d377a27e407" },
+    {  7, "81ad8709a0b166d6376d8ceb38f8f1a430e063d4076e22e96c522c067dd65457" },
+    {  8, "c08b76edb005b9f1453afffcf36f97e67897d0d98d51be4f330d1e37ebafa0d9" },
+    { 15, "2e604278700519c146b1018501dbc362c10634fa17adf58547c3fed47bf884c8" },
+    { 16, "1fcdb6a189d91af5d97b622ad675f0f7068af279f5d5017e9f4d176ac115d41a" },
+    { 17, "8e06a42ca8cff419b975923abd4a9d3bc610c0e9ddb000801356214909d58488" },
+    { 31, "4d641a6076e28068dab70fb1208b72b36ed110060612bdd0f22e4533ef14ef8a" },
+    { 32, "fec3a139908ce3bc8912c1a32663d542a9aefc64f79555e3995a47c96b3cb0c9" },
+    { 33, "e5a634f0cb1501f6d046cebf75ea366c90597282d3c8173b357a0011eda2da7e" },
+    { 63, "67eb3a6a26f8b1f5dd1aec4dbe40b083aefb265b63c8e17f9fd7fede47a4a3f4" },
+    { 64, "7524c16affe6d890f2c1da6e192a421a02b08e1ffe65379ebecf51c3c4d7bdc1" }
+};
+
+static unsigned char buffer[ 64 ];
+
+static std::uint64_t const k0 = 0x0706050403020100ull;
+static std::uint64_t const k1 = 0x0F0E0D0C0B0A0908ull;
+static std::uint64_t const k2 = 0x1716151413121110ull;
+static std::uint64_t const k3 = 0x1F1E1D1C1B1A1918ull;
+
+template<class H, std::size_t M> void test( test_vector const (&vectors)[ M ] )
+{
+    for( std::size_t i = 0; i < M; ++i )
+    {
+        test_vector const & v = vectors[ i ];
+
+        BOOST_TEST_EQ( to_string( hash( H( k0, k1, k2, k3 ), buffer, v.n ) ), std::string( v.r ) );
+
+        // the byte seed is the key
+        BOOST_TEST_EQ( to_string( hash( H( buffer, 32 ), buffer, v.n ) ), std::string( v.r ) );
+    }
+}
+
+int main()
+{
+    using namespace boost::hash2;
+
+    for( std::size_t i = 0; i < 64; ++i )
+    {
+        buffer[ i ] = static_cast<unsigned char>( i );
+    }
+
+    for( std::size_t i = 0; i < sizeof( highwayhash_64_vectors ) / sizeof( highwayhash_64_vectors[0] ); ++i )
+    {
+        BOOST_TEST_EQ( hash( highwayhash_64( k0, k1, k2, k3 ), buffer, i ), highwayhash_64_vectors[ i ] );
+        BOOST_TEST_EQ( hash( highwayhash_64( buffer, 32 ), buffer, i ), highwayhash_64_vectors[ i ] );
+    }
+
+    test<highwayhash_128>( highwayhash_128_vectors );
+    test<highwayhash_256>( highwayhash_256_vectors );
+
+    return boost::report_errors();
+}
@@ -0,0 +1,57 @@
+// Copyright 2024 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#define _CRT_SECURE_NO_WARNINGS
+
+#ifdef _MSC_VER
+# pragma warning(disable: 4309) // truncation of constant value
+#endif
+
+#include <boost/hash2/sha2.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <cstdint>
+#include <string>
+#include <cstddef>
+#include <cstdio>
+
+template<std::size_t N> std::string to_string( std::array<unsigned char, N> const & v )
+{
+    std::string r;
+
+    for( std::size_t i = 0; i < N; ++i )
+    {
+        char buffer[ 8 ];
+
+        std::snprintf( buffer, sizeof( buffer ), "%02x", static_cast<int>( v[ i ] ) );
+
+        r += buffer;
+    }
+
+    return r;
+}
+
+template<class H> std::string digest( std::string const & k, std::string const & s )
+{
+    H h( reinterpret_cast<unsigned char const*>( k.data() ), k.size() );
+
+    h.update( s.data(), s.size() );
+
+    return to_string( h.result() );
+}
+
+using boost::hash2::hmac_sha2_224;
+
+int main()
+{
+    // Test vectors from https://tools.ietf.org/html/rfc4231
+
+    BOOST_TEST_EQ( digest<hmac_sha2_224>( std::string( 20, 0x0B ), "Hi There" ), std::string( "896fb1128abbdf196832107cd49df33f47b4b1169912ba4f53684b22" ) );
+    BOOST_TEST_EQ( digest<hmac_sha2_224>( "Jefe", "what do ya want for nothing?" ), std::string( "a30e01098bc6dbbf45690f3a7e9e6d0f8bbea2a39e6148008fd05e44" ) );
+    BOOST_TEST_EQ( digest<hmac_sha2_224>( std::string( 20, 0xAA ), std::string( 50, 0xDD ) ), std::string( "7fb3cb3588c6c1f6ffa9694d7d6ad2649365b0c1f65d69d1ec8333ea" ) );
+    BOOST_TEST_EQ( digest<hmac_sha2_224>( "\x01\x02\x03\x04\x05\x06\x07\x08\x09\x0A\x0B\x0C\x0D\x0E\x0F\x10\x11\x12\x13\x14\x15\x16\x17\x18\x19", std::string( 50, 0xCD ) ), std::string( "6c11506874013cac6a2abc1bb382627cec6a90d86efc012de7afec5a" ) );
+    BOOST_TEST_EQ( digest<hmac_sha2_224>( std::string( 131, 0xAA ), "Test Using Larger Than Block-Size Key - Hash Key First" ), std::string( "95e9a0db962095adaebe9b2d6f0dbce2d499f112f2d2b7273fa6870e" ) );
+    BOOST_TEST_EQ( digest<hmac_sha2_224>( std::string( 131, 0xAA ), "This is a test using a larger than block-size key and a larger than block-size data. The key needs to be hashed before being used by the HMAC algorithm." ), std::string( "3a854166ac5d9f023f54d517d0b39dbd946770db9c2b95c9f6f565d1" ) );
+
+    return boost::report_errors();
+}
@@ -0,0 +1,57 @@
+// Copyright 2024 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#define _CRT_SECURE_NO_WARNINGS
+
+#ifdef _MSC_VER
+# pragma warning(disable: 4309) // truncation of constant value
+#endif
+
+#include <boost/hash2/sha2.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <cstdint>
+#include <string>
+#include <cstddef>
+#include <cstdio>
+
+template<std::size_t N> std::string to_string( std::array<unsigned char, N> const & v )
+{
+    std::string r;
+
+    for( std::size_t i = 0; i < N; ++i )
+    {
+        char buffer[ 8 ];
+
+        std::snprintf( buffer, sizeof( buffer ), "%02x", static_cast<int>( v[ i ] ) );
+
+        r += buffer;
+    }
+
+    return r;
+}
+
+template<class H> std::string digest( std::string const & k, std::string const & s )
+{
+    H h( reinterpret_cast<unsigned char const*>( k.data() ), k.size() );
+
+    h.update( s.data(), s.size() );
+
+    return to_string( h.result() );
+}
+
+using boost::hash2::hmac_sha2_256;
+
+int main()
+{
+    // Test vectors from https://tools.ietf.org/html/rfc4231
+
+    BOOST_TEST_EQ( digest<hmac_sha2_256>( std::string( 20, 0x0B ), "Hi There" ), std::string( "b0344c61d8db38535ca8afceaf0bf12b881dc200c9833da726e9376c2e32cff7" ) );
+    BOOST_TEST_EQ( digest<hmac_sha2_256>( "Jefe", "what do ya want for nothing?" ), std::string( "5bdcc146bf60754e6a042426089575c75a003f089d2739839dec58b964ec3843" ) );
+    BOOST_TEST_EQ( digest<hmac_sha2_256>( std::string( 20, 0xAA ), std::string( 50, 0xDD ) ), std::string( "773ea91e36800e46854db8ebd09181a72959098b3ef8c122d9635514ced565fe" ) );
+    BOOST_TEST_EQ( digest<hmac_sha2_256>( "\x01\x02\x03\x04\x05\x06\x07\x08\x09\x0A\x0B\x0C\x0D\x0E\x0F\x10\x11\x12\x13\x14\x15\x16\x17\x18\x19", std::string( 50, 0xCD ) ), std::string( "82558a389a443c0ea4cc819899f2083a85f0faa3e578f8077a2e3ff46729665b" ) );
+    BOOST_TEST_EQ( digest<hmac_sha2_256>( std::string( 131, 0xAA ), "Test Using Larger Than Block-Size Key - Hash Key First" ), std::string( "60e431591ee0b67f0d8a26aacbf5b77f8e0bc6213728c5140546040f0ee37f54" ) );
+    BOOST_TEST_EQ( digest<hmac_sha2_256>( std::string( 131, 0xAA ), "This is a test using a larger than block-size key and a larger than block-size data. The key needs to be hashed before being used by the HMAC algorithm." ), std::string( "9b09ffa71b942fcb27635fbcd5b0e944bfdc63644f0713938a7f51535c3a35e2" ) );
+
+    return boost::report_errors();
+}
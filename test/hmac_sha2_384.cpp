@@ -0,0 +1,57 @@
+// Copyright 2024 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#define _CRT_SECURE_NO_WARNINGS
+
+#ifdef _MSC_VER
+# pragma warning(disable: 4309) // truncation of constant value
+#endif
+
+#include <boost/hash2/sha2.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <cstdint>
+#include <string>
+#include <cstddef>
+#include <cstdio>
+
+template<std::size_t N> std::string to_string( std::array<unsigned char, N> const & v )
+{
+    std::string r;
+
+    for( std::size_t i = 0; i < N; ++i )
+    {
+        char buffer[ 8 ];
+
+        std::snprintf( buffer, sizeof( buffer ), "%02x", static_cast<int>( v[ i ] ) );
+
+        r += buffer;
+    }
+
+    return r;
+}
+
+template<class H> std::string digest( std::string const & k, std::string const & s )
+{
+    H h( reinterpret_cast<unsigned char const*>( k.data() ), k.size() );
+
+    h.update( s.data(), s.size() );
+
+    return to_string( h.result() );
+}
+
+using boost::hash2::hmac_sha2_384;
+
+int main()
+{
+    // Test vectors from https://tools.ietf.org/html/rfc4231
+
+    BOOST_TEST_EQ( digest<hmac_sha2_384>( std::string( 20, 0x0B ), "Hi There" ), std::string( "afd03944d84895626b0825f4ab46907f15f9dadbe4101ec682aa034c7cebc59cfaea9ea9076ede7f4af152e8b2fa9cb6" ) );
+    BOOST_TEST_EQ( digest<hmac_sha2_384>( "Jefe", "what do ya want for nothing?" ), std::string( "af45d2e376484031617f78d2b58a6b1b9c7ef464f5a01b47e42ec3736322445e8e2240ca5e69e2c78b3239ecfab21649" ) );
+    BOOST_TEST_EQ( digest<hmac_sha2_384>( std::string( 20, 0xAA ), std::string( 50, 0xDD ) ), std::string( "88062608d3e6ad8a0aa2ace014c8a86f0aa635d947ac9febe83ef4e55966144b2a5ab39dc13814b94e3ab6e101a34f27" ) );
+    BOOST_TEST_EQ( digest<hmac_sha2_384>( "\x01\x02\x03\x04\x05\x06\x07\x08\x09\x0A\x0B\x0C\x0D\x0E\x0F\x10\x11\x12\x13\x14\x15\x16\x17\x18\x19", std::string( 50, 0xCD ) ), std::string( "3e8a69b7783c25851933ab6290af6ca77a9981480850009cc5577c6e1f573b4e6801dd23c4a7d679ccf8a386c674cffb" ) );
+    BOOST_TEST_EQ( digest<hmac_sha2_384>( std::string( 131, 0xAA ), "Test Using Larger Than Block-Size Key - Hash Key First" ), std::string( "4ece084485813e9088d2c63a041bc5b44f9ef1012a2b588f3cd11f05033ac4c60c2ef6ab4030fe8296248df163f44952" ) );
+    BOOST_TEST_EQ( digest<hmac_sha2_384>( std::string( 131, 0xAA ), "This is a test using a larger than block-size key and a larger than block-size data. The key needs to be hashed before being used by the HMAC algorithm." ), std::string( "6617178e941f020d351e2f254e8fd32c602420feb0b8fb9adccebb82461e99c5a678cc31e799176d3860e6110c46523e" ) );
+
+    return boost::report_errors();
+}
@@ -0,0 +1,57 @@
+// Copyright 2024 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#define _CRT_SECURE_NO_WARNINGS
+
+#ifdef _MSC_VER
+# pragma warning(disable: 4309) // truncation of constant value
+#endif
+
+#include <boost/hash2/sha2.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <cstdint>
+#include <string>
+#include <cstddef>
+#include <cstdio>
+
+template<std::size_t N> std::string to_string( std::array<unsigned char, N> const & v )
+{
+    std::string r;
+
+    for( std::size_t i = 0; i < N; ++i )
+    {
+        char buffer[ 8 ];
+
+        std::snprintf( buffer, sizeof( buffer ), "%02x", static_cast<int>( v[ i ] ) );
+
+        r += buffer;
+    }
+
+    return r;
+}
+
+template<class H> std::string digest( std::string const & k, std::string const & s )
+{
+    H h( reinterpret_cast<unsigned char const*>( k.data() ), k.size() );
+
+    h.update( s.data(), s.size() );
+
+    return to_string( h.result() );
+}
+
+using boost::hash2::hmac_sha2_512;
+
+int main()
+{
+    // Test vectors from https://tools.ietf.org/html/rfc4231
+
+    BOOST_TEST_EQ( digest<hmac_sha2_512>( std::string( 20, 0x0B ), "Hi There" ), std::string( "87aa7cdea5ef619d4ff0b4241a1d6cb02379f4e2ce4ec2787ad0b30545e17cdedaa833b7d6b8a702038b274eaea3f4e4be9d914eeb61f1702e696c203a126854" ) );
+    BOOST_TEST_EQ( digest<hmac_sha2_512>( "Jefe", "what do ya want for nothing?" ), std::string( "164b7a7bfcf819e2e395fbe73b56e0a387bd64222e831fd610270cd7ea2505549758bf75c05a994a6d034f65f8f0e6fdcaeab1a34d4a6b4b636e070a38bce737" ) );
+    BOOST_TEST_EQ( digest<hmac_sha2_512>( std::string( 20, 0xAA ), std::string( 50, 0xDD ) ), std::string( "fa73b0089d56a284efb0f0756c890be9b1b5dbdd8ee81a3655f83e33b2279d39bf3e848279a722c806b485a47e67c807b946a337bee8942674278859e13292fb" ) );
+    BOOST_TEST_EQ( digest<hmac_sha2_512>( "\x01\x02\x03\x04\x05\x06\x07\x08\x09\x0A\x0B\x0C\x0D\x0E\x0F\x10\x11\x12\x13\x14\x15\x16\x17\x18\x19", std::string( 50, 0xCD ) ), std::string( "b0ba465637458c6990e5a8c5f61d4af7e576d97ff94b872de76f8050361ee3dba91ca5c11aa25eb4d679275cc5788063a5f19741120c4f2de2adebeb10a298dd" ) );
+    BOOST_TEST_EQ( digest<hmac_sha2_512>( std::string( 131, 0xAA ), "Test Using Larger Than Block-Size Key - Hash Key First" ), std::string( "80b24263c7c1a3ebb71493c1dd7be8b49b46d1f41b4aeec1121b013783f8f3526b56d037e05f2598bd0fd2215d6a1e5295e64f73f63f0aec8b915a985d786598" ) );
+    BOOST_TEST_EQ( digest<hmac_sha2_512>( std::string( 131, 0xAA ), "This is a test using a larger than block-size key and a larger than block-size data. The key needs to be hashed before being used by the HMAC algorithm." ), std::string( "e37b6a775dc87dbaa4dfa9f96e5e3ffddebd71f8867289865df5a32d20cdc944b6022cac3c4982b10d5eeb55c3e4de15134676fb6de0446065c97440fa8c6a58" ) );
+
+    return boost::report_errors();
+}
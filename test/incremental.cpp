@@ -0,0 +1,108 @@
+// Copyright 2024 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/xxh3.hpp>
+#include <boost/hash2/wyhash.hpp>
+#include <boost/hash2/aeshash.hpp>
+#include <boost/hash2/highwayhash.hpp>
+#include <boost/hash2/crc.hpp>
+#include <boost/hash2/sha3.hpp>
+#include <boost/hash2/blake2.hpp>
+#include <boost/hash2/blake3.hpp>
+#include <boost/hash2/poly1305.hpp>
+#include <boost/hash2/polyval.hpp>
+#include <boost/hash2/adler32.hpp>
+#include <boost/hash2/fletcher.hpp>
+#include <boost/hash2/polymur.hpp>
+#include <boost/hash2/multiply_shift.hpp>
+#include <boost/hash2/tabulation.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <cstdint>
+#include <cstddef>
+
+// update( p, n ) in parts must give the same result as in one call
+
+unsigned char const* data()
+{
+    static unsigned char buffer[ 2201 ];
+
+    for( int i = 0; i < 2201; ++i )
+    {
+        buffer[ i ] = static_cast<unsigned char>( i * 7 + 3 );
+    }
+
+    // unaligned
+    return buffer + 1;
+}
+
+template<class H> void test( H const & h0 )
+{
+    unsigned char const* p = data();
+
+    for( std::size_t n = 0; n <= 2200; n += n / 8 + 1 )
+    {
+        H h1( h0 );
+        h1.update( p, n );
+
+        typename H::result_type const r = h1.result();
+
+        for( std::size_t k = 1; k <= n; k += k / 2 + 1 )
+        {
+            H h2( h0 );
+
+            for( std::size_t i = 0; i < n; i += k )
+            {
+                h2.update( p + i, k < n - i? k: n - i );
+            }
+
+            BOOST_TEST( h2.result() == r );
+        }
+    }
+}
+
+template<class H> void test()
+{
+    test( H() );
+    test( H( 7 ) );
+    test( H( 0x0123456789ABCDEFull ) );
+}
+
+int main()
+{
+    test<boost::hash2::xxh3_64>();
+    test<boost::hash2::xxh3_128>();
+    test<boost::hash2::wyhash_64>();
+    test<boost::hash2::aeshash_64>();
+    test<boost::hash2::aeshash_128>();
+    test<boost::hash2::highwayhash_64>();
+    test<boost::hash2::highwayhash_128>();
+    test<boost::hash2::highwayhash_256>();
+    test<boost::hash2::crc32c>();
+    test<boost::hash2::crc32_ieee>();
+    test<boost::hash2::crc64_xz>();
+    test<boost::hash2::crc64_nvme>();
+    test<boost::hash2::sha3_256>();
+    test<boost::hash2::sha3_512>();
+    test<boost::hash2::shake_128>();
+    test<boost::hash2::shake_256>();
+    test<boost::hash2::blake2b_512>();
+    test<boost::hash2::blake2b_256>();
+    test<boost::hash2::blake2s_256>();
+    test<boost::hash2::blake2s_128>();
+    test<boost::hash2::blake2bp_512>();
+    test<boost::hash2::blake2sp_256>();
+    test<boost::hash2::blake3>();
+    test<boost::hash2::poly1305>();
+    test<boost::hash2::polyval>();
+    test<boost::hash2::ghash>();
+    test<boost::hash2::adler32>();
+    test<boost::hash2::fletcher64>();
+    test<boost::hash2::polymur_64>();
+    test<boost::hash2::multiply_shift_64>();
+    test<boost::hash2::multiply_add_shift_64>();
+    test<boost::hash2::tabulation_64>();
+    test<boost::hash2::twisted_tabulation_64>();
+
+    return boost::report_errors();
+}
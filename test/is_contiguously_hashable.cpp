@@ -5,6 +5,9 @@
 #include <boost/hash2/is_contiguously_hashable.hpp>
 #include <boost/hash2/endian.hpp>
 #include <boost/core/lightweight_test_trait.hpp>
+#include <type_traits>
+#include <utility>
+#include <array>
 #include <cstddef>
 
 class X;
@@ -13,6 +16,55 @@ struct Y
 {
 };
 
+// no padding
+struct P
+{
+    int a;
+    int b;
+};
+
+// padding
+struct Q
+{
+    char a;
+    int b;
+};
+
+struct R
+{
+    float a;
+};
+
+// has its own do_hash_append
+struct S
+{
+    int a;
+    int b;
+
+    template<class H> friend void do_hash_append( H&, S const& )
+    {
+    }
+};
+
+// opts in explicitly
+struct U
+{
+    short a;
+    short b;
+};
+
+namespace boost
+{
+namespace hash2
+{
+
+template<> struct is_trivially_equality_comparable<U>: std::true_type
+{
+};
+
+} // namespace hash2
+} // namespace boost
+
 enum E
 {
     v
@@ -166,5 +218,24 @@ int main()
 
     //
 
+    // not deduced, even without padding
+
+    test<P, endian::native>( false );
+    test<P, endian::little>( false );
+    test<P, endian::big>( false );
+
+    test<Q, endian::native>( false );
+    test<R, endian::native>( false );
+    test<S, endian::native>( false );
+
+    test<U, endian::native>( true );
+    test<U, endian::little>( endian::native == endian::little );
+    test<U, endian::big>( endian::native == endian::big );
+
+    test<std::pair<int, int>, endian::native>( false );
+    test<std::array<int, 2>, endian::native>( false );
+
+    //
+
     return boost::report_errors();
 }
@@ -0,0 +1,176 @@
+// Copyright 2024 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// Linked into the instruction set variants of the tests (see Jamfile);
+// before main, exits successfully, skipping the test, if the CPU lacks
+// an instruction set that the translation unit has been compiled for
+
+#include <boost/hash2/detail/config.hpp>
+#include <cstdio>
+#include <cstdlib>
+
+#if defined(BOOST_HASH2_HAS_SSE2) && ( defined(__i386__) || defined(__x86_64__) || defined(_M_IX86) || defined(_M_X64) )
+
+#if defined(_MSC_VER) && !defined(__clang__)
+# include <intrin.h>
+#else
+# include <cpuid.h>
+#endif
+
+namespace
+{
+
+// the checks use no arrays, to keep the compiler from using vector
+// instructions, which may be the ones missing, for them
+
+void cpuid( unsigned leaf, unsigned & eax, unsigned & ebx, unsigned & ecx, unsigned & edx )
+{
+#if defined(_MSC_VER) && !defined(__clang__)
+
+    int w[ 4 ];
+    __cpuidex( w, static_cast<int>( leaf ), 0 );
+
+    eax = static_cast<unsigned>( w[0] );
+    ebx = static_cast<unsigned>( w[1] );
+    ecx = static_cast<unsigned>( w[2] );
+    edx = static_cast<unsigned>( w[3] );
+
+#else
+
+    __cpuid_count( leaf, 0, eax, ebx, ecx, edx );
+
+#endif
+}
+
+// the register state enabled by the OS, XCR0
+
+unsigned long long xgetbv0()
+{
+#if defined(_MSC_VER) && !defined(__clang__)
+
+    return _xgetbv( 0 );
+
+#else
+
+    unsigned eax, edx;
+    __asm__ __volatile__( "xgetbv" : "=a"( eax ), "=d"( edx ) : "c"( 0 ) );
+
+    return ( static_cast<unsigned long long>( edx ) << 32 ) | eax;
+
+#endif
+}
+
+char const * missing_isa()
+{
+    unsigned max_leaf, eax, ebx, ecx, edx;
+    cpuid( 0, max_leaf, ebx, ecx, edx );
+
+    unsigned ecx1, edx1;
+    cpuid( 1, eax, ebx, ecx1, edx1 );
+
+    unsigned ebx7 = 0, ecx7 = 0;
+
+    if( max_leaf >= 7 )
+    {
+        cpuid( 7, eax, ebx7, ecx7, edx );
+    }
+
+    bool const osxsave = ( ecx1 >> 27 ) & 1;
+
+    unsigned long long const xcr0 = osxsave? xgetbv0(): 0;
+
+    bool const avx_os = ( xcr0 & 0x06 ) == 0x06;
+    bool const avx512_os = avx_os && ( xcr0 & 0xE0 ) == 0xE0;
+
+    (void)edx1; (void)ebx7; (void)ecx7; (void)avx512_os;
+
+#if defined(BOOST_HASH2_HAS_SSE2)
+    if( !( ( edx1 >> 26 ) & 1 ) ) return "SSE2";
+#endif
+
+#if defined(BOOST_HASH2_HAS_SSSE3)
+    if( !( ( ecx1 >> 9 ) & 1 ) ) return "SSSE3";
+#endif
+
+#if defined(BOOST_HASH2_HAS_SSE41)
+    if( !( ( ecx1 >> 19 ) & 1 ) ) return "SSE4.1";
+#endif
+
+#if defined(BOOST_HASH2_HAS_SSE42)
+    if( !( ( ecx1 >> 20 ) & 1 ) ) return "SSE4.2";
+#endif
+
+#if defined(BOOST_HASH2_HAS_PCLMUL)
+    if( !( ( ecx1 >> 1 ) & 1 ) ) return "PCLMULQDQ";
+#endif
+
+#if defined(BOOST_HASH2_HAS_AES)
+    if( !( ( ecx1 >> 25 ) & 1 ) ) return "AES-NI";
+#endif
+
+#if defined(BOOST_HASH2_HAS_SHA)
+    if( !( ( ebx7 >> 29 ) & 1 ) ) return "SHA";
+#endif
+
+#if defined(__AVX__)
+    if( !( ( ecx1 >> 28 ) & 1 ) || !avx_os ) return "AVX";
+#endif
+
+#if defined(BOOST_HASH2_HAS_AVX2)
+    if( !( ( ebx7 >> 5 ) & 1 ) ) return "AVX2";
+#endif
+
+#if defined(__BMI2__)
+    if( !( ( ebx7 >> 8 ) & 1 ) ) return "BMI2";
+#endif
+
+#if defined(__AVX512F__)
+    // F, DQ, BW, VL
+    if( ( ebx7 & 0xC0030000u ) != 0xC0030000u || !avx512_os ) return "AVX-512";
+#endif
+
+#if defined(BOOST_HASH2_HAS_AVX512IFMA)
+    if( !( ( ebx7 >> 21 ) & 1 ) ) return "AVX-512 IFMA";
+#endif
+
+#if defined(BOOST_HASH2_HAS_VAES)
+    if( !( ( ecx7 >> 9 ) & 1 ) ) return "VAES";
+#endif
+
+#if defined(BOOST_HASH2_HAS_VPCLMUL)
+    if( !( ( ecx7 >> 10 ) & 1 ) ) return "VPCLMULQDQ";
+#endif
+
+    return 0;
+}
+
+struct isa_check
+{
+    isa_check()
+    {
+        if( char const * isa = missing_isa() )
+        {
+            std::printf( "The CPU doesn't support %s; test skipped\n", isa );
+            std::exit( 0 );
+        }
+    }
+};
+
+} // namespace
+
+#if defined(_MSC_VER) && !defined(__clang__)
+
+// before the static objects of the test
+#pragma init_seg( lib )
+
+static isa_check check;
+
+#else
+
+// before the static objects of the test
+static isa_check check __attribute__(( init_priority( 101 ) ));
+
+#endif
+
+#endif
@@ -0,0 +1,90 @@
+// Copyright 2024 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/multi_buffer.hpp>
+#include <boost/hash2/md5.hpp>
+#include <boost/hash2/sha1.hpp>
+#include <boost/hash2/sha2.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+template<class H, class Hx> void test( std::size_t k, std::vector<unsigned char> const & data, std::size_t const * lengths )
+{
+    std::vector<void const*> p( k + 1 );
+    std::vector<std::size_t> n( k + 1 );
+    std::vector<typename Hx::result_type> r( k + 1 );
+
+    std::size_t offset = 0;
+
+    for( std::size_t i = 0; i < k; ++i )
+    {
+        p[ i ] = data.data() + offset;
+        n[ i ] = lengths[ i ];
+
+        offset += lengths[ i ];
+    }
+
+    Hx::hash( k, p.data(), n.data(), r.data() );
+
+    for( std::size_t i = 0; i < k; ++i )
+    {
+        H h;
+
+        h.update( p[ i ], n[ i ] );
+
+        BOOST_TEST( h.result() == r[ i ] );
+    }
+}
+
+template<class H, class Hx> void test()
+{
+    std::size_t const M = 64;
+
+    std::size_t lengths[ M ];
+    std::size_t total = 0;
+
+    std::uint32_t x = 1;
+
+    for( std::size_t i = 0; i < M; ++i )
+    {
+        x = x * 1103515245u + 12345u;
+
+        // mostly short messages, some spanning several blocks
+        lengths[ i ] = ( x >> 8 ) % ( i % 5 == 0? 1000: 130 );
+        total += lengths[ i ];
+    }
+
+    std::vector<unsigned char> data( total );
+
+    for( std::size_t i = 0; i < total; ++i )
+    {
+        data[ i ] = static_cast<unsigned char>( i * 7 + 3 );
+    }
+
+    for( std::size_t k = 0; k <= M; ++k )
+    {
+        test<H, Hx>( k, data, lengths );
+    }
+
+    {
+        // lengths around the padding boundary
+
+        std::size_t const lengths2[] = { 0, 1, 54, 55, 56, 57, 63, 64, 65, 119, 120, 127, 128, 129 };
+        std::size_t const k = sizeof( lengths2 ) / sizeof( lengths2[ 0 ] );
+
+        test<H, Hx>( k, data, lengths2 );
+    }
+}
+
+int main()
+{
+    test<boost::hash2::md5_128, boost::hash2::md5_128_x8>();
+    test<boost::hash2::sha1_160, boost::hash2::sha1_160_x8>();
+    test<boost::hash2::sha2_256, boost::hash2::sha2_256_x8>();
+    test<boost::hash2::sha2_224, boost::hash2::sha2_224_x8>();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,198 @@
+// Copyright 2024 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/multiply_shift.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <cstdint>
+#include <cstddef>
+
+template<class H> typename H::result_type hash( H h, void const * p, std::size_t n )
+{
+    h.update( p, n );
+    return h.result();
+}
+
+// https://prng.di.unimi.it/splitmix64.c
+
+static std::uint64_t splitmix64( std::uint64_t & s )
+{
+    std::uint64_t z = ( s += 0x9e3779b97f4a7c15ull );
+    z = ( z ^ ( z >> 30 ) ) * 0xbf58476d1ce4e5b9ull;
+    z = ( z ^ ( z >> 27 ) ) * 0x94d049bb133111ebull;
+    return z ^ ( z >> 31 );
+}
+
+// the definitions, in 32 bit limbs: the high 64 bits of
+// a x + b mod 2^128, with a and b taken from splitmix64
+
+static std::uint64_t multiply_add_shift( std::uint64_t a0, std::uint64_t a1, std::uint64_t b0, std::uint64_t b1, std::uint64_t x )
+{
+    std::uint32_t const a[ 4 ] = { static_cast<std::uint32_t>( a0 ), static_cast<std::uint32_t>( a0 >> 32 ), static_cast<std::uint32_t>( a1 ), static_cast<std::uint32_t>( a1 >> 32 ) };
+    std::uint32_t const b[ 4 ] = { static_cast<std::uint32_t>( b0 ), static_cast<std::uint32_t>( b0 >> 32 ), static_cast<std::uint32_t>( b1 ), static_cast<std::uint32_t>( b1 >> 32 ) };
+    std::uint32_t const y[ 2 ] = { static_cast<std::uint32_t>( x ), static_cast<std::uint32_t>( x >> 32 ) };
+
+    std::uint32_t r[ 4 ] = { b[ 0 ], b[ 1 ], b[ 2 ], b[ 3 ] };
+
+    for( int j = 0; j < 2; ++j )
+    {
+        std::uint64_t c = 0;
+
+        for( int i = 0; i + j < 4; ++i )
+        {
+            c += static_cast<std::uint64_t>( a[ i ] ) * y[ j ] + r[ i + j ];
+            r[ i + j ] = static_cast<std::uint32_t>( c );
+            c >>= 32;
+        }
+    }
+
+    return ( static_cast<std::uint64_t>( r[ 3 ] ) << 32 ) | r[ 2 ];
+}
+
+static std::uint64_t multiply_shift_ref( std::uint64_t seed, std::uint64_t x )
+{
+    std::uint64_t a0 = splitmix64( seed ) | 1;
+    std::uint64_t a1 = splitmix64( seed );
+
+    return multiply_add_shift( a0, a1, 0, 0, x );
+}
+
+static std::uint64_t multiply_add_shift_ref( std::uint64_t seed, std::uint64_t x )
+{
+    std::uint64_t a0 = splitmix64( seed );
+    std::uint64_t a1 = splitmix64( seed );
+    std::uint64_t b0 = splitmix64( seed );
+    std::uint64_t b1 = splitmix64( seed );
+
+    return multiply_add_shift( a0, a1, b0, b1, x );
+}
+
+// update() and result() in terms of operator(), as described
+// in detail/integer_hash.hpp
+
+template<class H> std::uint64_t hash_words( H const & f, unsigned char const * p, std::size_t n )
+{
+    std::uint64_t h = 0;
+
+    for( std::size_t i = 0; i < n; i += 8 )
+    {
+        std::uint64_t w = 0;
+
+        for( std::size_t j = 0; j < 8 && i + j < n; ++j )
+        {
+            w |= static_cast<std::uint64_t>( p[ i + j ] ) << ( 8 * j );
+        }
+
+        h = f( h ^ w );
+    }
+
+    return f( h ^ ~static_cast<std::uint64_t>( n ) );
+}
+
+static const std::size_t N = 1000;
+static unsigned char buffer[ N ];
+
+template<class H> void test( std::uint64_t (*ref)( std::uint64_t, std::uint64_t ) )
+{
+    std::uint64_t const seeds[] = { 0, 1, 0x9e3779b97f4a7c15ull, 0xffffffffffffffffull };
+
+    for( std::size_t i = 0; i < sizeof( seeds ) / sizeof( seeds[0] ); ++i )
+    {
+        std::uint64_t const seed = seeds[ i ];
+
+        H const h( seed );
+
+        // operator() must match the definition
+
+        std::uint64_t x = 0;
+
+        for( int j = 0; j < 1000; ++j )
+        {
+            BOOST_TEST_EQ( h( x ), ref( seed, x ) );
+            BOOST_TEST_EQ( h( ~x ), ref( seed, ~x ) );
+
+            x = x * 0x9e3779b97f4a7c15ull + 1;
+        }
+
+        // update() and result() must match their description
+
+        for( std::size_t n = 0; n <= 200; ++n )
+        {
+            BOOST_TEST_EQ( hash( h, buffer, n ), hash_words( h, buffer, n ) );
+        }
+
+        BOOST_TEST_EQ( hash( h, buffer, N ), hash_words( h, buffer, N ) );
+
+        // a second result() hashes the first
+
+        {
+            H h2( h );
+
+            h2.update( buffer, 100 );
+
+            std::uint64_t r = h2.result();
+            BOOST_TEST_EQ( h2.result(), h( r ^ ~std::uint64_t( 100 ) ) );
+        }
+    }
+
+    // a byte seed of up to 8 bytes is read as a little-endian integer
+
+    {
+        unsigned char const seed[] = { 0x15, 0x7c, 0x4a, 0x7f, 0xb9, 0x79, 0x37, 0x9e };
+
+        BOOST_TEST_EQ( H( seed, 8 )( 12345 ), H( 0x9e3779b97f4a7c15ull )( 12345 ) );
+        BOOST_TEST_EQ( H( seed, 3 )( 12345 ), H( 0x4a7c15 )( 12345 ) );
+        BOOST_TEST_EQ( H( seed, 0 )( 12345 ), H()( 12345 ) );
+    }
+
+    // a longer one is folded a word at a time, starting from its length
+
+    {
+        unsigned char seed[ 20 ];
+
+        for( int i = 0; i < 20; ++i )
+        {
+            seed[ i ] = static_cast<unsigned char>( i + 1 );
+        }
+
+        std::uint64_t s = 20;
+        std::uint64_t t;
+
+        t = s ^ 0x0807060504030201ull; s = splitmix64( t );
+        t = s ^ 0x100f0e0d0c0b0a09ull; s = splitmix64( t );
+        t = s ^ 0x0000000014131211ull; s = splitmix64( t );
+
+        BOOST_TEST_EQ( H( seed, 20 )( 12345 ), H( s )( 12345 ) );
+    }
+}
+
+int main()
+{
+    using namespace boost::hash2;
+
+    for( std::size_t i = 0; i < N; ++i )
+    {
+        buffer[ i ] = static_cast<unsigned char>( i );
+    }
+
+    test<multiply_shift_64>( multiply_shift_ref );
+    test<multiply_add_shift_64>( multiply_add_shift_ref );
+
+    // the high word of a is the second output of splitmix64
+    // from a zero state, and b that of the fourth
+
+    BOOST_TEST_EQ( multiply_shift_64()( 1 ), 0x6e789e6aa1b965f4ull );
+    BOOST_TEST_EQ( multiply_add_shift_64()( 0 ), 0xf88bb8a8724c81ecull );
+
+    // input[ i ] = i; regression values, computed with this implementation
+
+    BOOST_TEST_EQ( hash( multiply_shift_64(), buffer, 0 ), 0x73a809ced96467baull );
+    BOOST_TEST_EQ( hash( multiply_shift_64(), buffer, 100 ), 0xf37425d5f53aebf2ull );
+    BOOST_TEST_EQ( hash( multiply_shift_64( 0x9e3779b97f4a7c15ull ), "abc", 3 ), 0x391aa9e3c49793b8ull );
+
+    BOOST_TEST_EQ( hash( multiply_add_shift_64(), buffer, 0 ), 0x6c33c2774bb0e9a6ull );
+    BOOST_TEST_EQ( hash( multiply_add_shift_64(), buffer, 100 ), 0x588061597e496480ull );
+    BOOST_TEST_EQ( hash( multiply_add_shift_64( 0x9e3779b97f4a7c15ull ), "abc", 3 ), 0x98a0e2c56f97ebdbull );
+
+    return boost::report_errors();
+}
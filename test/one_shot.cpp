@@ -0,0 +1,134 @@
+// Copyright 2024 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/fnv1a.hpp>
+#include <boost/hash2/siphash.hpp>
+#include <boost/hash2/xxhash.hpp>
+#include <boost/hash2/wyhash.hpp>
+#include <boost/hash2/polymur.hpp>
+#include <boost/hash2/xxh3.hpp>
+#include <boost/hash2/spooky2.hpp>
+#include <boost/hash2/murmur3.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <cstdint>
+#include <cstddef>
+
+// H::hash( p, n, seed ) must match update( p, n ) and result()
+
+unsigned char const* data()
+{
+    static unsigned char buffer[ 2201 ];
+
+    for( int i = 0; i < 2201; ++i )
+    {
+        buffer[ i ] = static_cast<unsigned char>( i * 7 + 3 );
+    }
+
+    // unaligned
+    return buffer + 1;
+}
+
+template<class H> void test( std::uint64_t seed )
+{
+    unsigned char const* p = data();
+
+    for( std::size_t n = 0; n <= 2200; ++n )
+    {
+        H h( seed );
+        h.update( p, n );
+
+        BOOST_TEST( H::hash( p, n, seed ) == h.result() );
+    }
+}
+
+template<class H> void test()
+{
+    test<H>( 0 );
+    test<H>( 7 );
+    test<H>( 0x0123456789ABCDEFull );
+
+    unsigned char const* p = data();
+
+    for( std::size_t n = 0; n <= 300; ++n )
+    {
+        H h;
+        h.update( p, n );
+
+        BOOST_TEST( H::hash( p, n ) == h.result() );
+    }
+
+    // an empty range
+    BOOST_TEST( H::hash( nullptr, 0 ) == H().result() );
+}
+
+template<class H> void test2( std::uint64_t seed1, std::uint64_t seed2 )
+{
+    unsigned char const* p = data();
+
+    for( std::size_t n = 0; n <= 2200; ++n )
+    {
+        H h( seed1, seed2 );
+        h.update( p, n );
+
+        BOOST_TEST( H::hash( p, n, seed1, seed2 ) == h.result() );
+    }
+}
+
+// polymur_64::hash is a const member function, using the key schedule
+// of the object, and must match on any object constructed with the seed
+
+void test_polymur( boost::hash2::polymur_64 const & h0 )
+{
+    unsigned char const* p = data();
+
+    boost::hash2::polymur_64 h1( h0 );
+
+    for( std::size_t n = 0; n <= 2200; ++n )
+    {
+        boost::hash2::polymur_64 h( h0 );
+        h.update( p, n );
+
+        BOOST_TEST_EQ( h0.hash( p, n ), h.result() );
+
+        // the state of the object doesn't matter
+        h1.update( p, n );
+        BOOST_TEST_EQ( h1.hash( p, n ), h.hash( p, n ) );
+    }
+
+    // an empty range
+    BOOST_TEST_EQ( h0.hash( nullptr, 0 ), boost::hash2::polymur_64( h0 ).result() );
+}
+
+int main()
+{
+    test<boost::hash2::fnv1a_32>();
+    test<boost::hash2::fnv1a_64>();
+    test<boost::hash2::murmur3_32>();
+    test<boost::hash2::murmur3_128>();
+    test<boost::hash2::xxhash_32>();
+    test<boost::hash2::xxhash_64>();
+    test<boost::hash2::wyhash_64>();
+    test<boost::hash2::xxh3_64>();
+    test<boost::hash2::xxh3_128>();
+    test<boost::hash2::spooky2_128>();
+    test<boost::hash2::siphash_32>();
+    test<boost::hash2::siphash13_32>();
+    test<boost::hash2::siphash_64>();
+    test<boost::hash2::siphash13_64>();
+
+    test2<boost::hash2::spooky2_128>( 1, 2 );
+    test2<boost::hash2::siphash_64>( 0x0706050403020100ull, 0x0F0E0D0C0B0A0908ull );
+    test2<boost::hash2::siphash13_64>( 0x0706050403020100ull, 0x0F0E0D0C0B0A0908ull );
+
+    {
+        test_polymur( boost::hash2::polymur_64() );
+        test_polymur( boost::hash2::polymur_64( 0x0123456789ABCDEFull ) );
+
+        // a byte seed longer than 16 bytes also sets the tweak
+        unsigned char const seed[ 24 ] = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24 };
+        test_polymur( boost::hash2::polymur_64( seed, sizeof( seed ) ) );
+    }
+
+    return boost::report_errors();
+}
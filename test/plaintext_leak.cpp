@@ -3,12 +3,29 @@
 // https://www.boost.org/LICENSE_1_0.txt
 
 #include <boost/hash2/fnv1a.hpp>
+#include <boost/hash2/crc.hpp>
+#include <boost/hash2/adler32.hpp>
+#include <boost/hash2/fletcher.hpp>
 #include <boost/hash2/siphash.hpp>
+#include <boost/hash2/highwayhash.hpp>
 #include <boost/hash2/xxhash.hpp>
+#include <boost/hash2/wyhash.hpp>
+#include <boost/hash2/polymur.hpp>
+#include <boost/hash2/tabulation.hpp>
+#include <boost/hash2/multiply_shift.hpp>
+#include <boost/hash2/xxh3.hpp>
+#include <boost/hash2/aeshash.hpp>
 #include <boost/hash2/spooky2.hpp>
 #include <boost/hash2/murmur3.hpp>
 #include <boost/hash2/md5.hpp>
 #include <boost/hash2/sha1.hpp>
+#include <boost/hash2/sha2.hpp>
+#include <boost/hash2/sha3.hpp>
+#include <boost/hash2/blake2.hpp>
+#include <boost/hash2/blake3.hpp>
+#include <boost/hash2/poly1305.hpp>
+#include <boost/hash2/polyval.hpp>
+#include <boost/hash2/buffered.hpp>
 #include <boost/core/lightweight_test.hpp>
 #include <algorithm>
 #include <cstddef>
@@ -51,17 +68,64 @@ int main()
 {
     test<boost::hash2::fnv1a_32>();
     test<boost::hash2::fnv1a_64>();
+    test<boost::hash2::crc32c>();
+    test<boost::hash2::crc32_ieee>();
+    test<boost::hash2::crc64_xz>();
+    test<boost::hash2::crc64_nvme>();
+    test<boost::hash2::adler32>();
+    test<boost::hash2::fletcher64>();
     test<boost::hash2::murmur3_32>();
     test<boost::hash2::murmur3_128>();
     test<boost::hash2::xxhash_32>();
     test<boost::hash2::xxhash_64>();
+    test<boost::hash2::wyhash_64>();
+    test<boost::hash2::polymur_64>();
+    test<boost::hash2::tabulation_64>();
+    test<boost::hash2::twisted_tabulation_64>();
+    test<boost::hash2::multiply_shift_64>();
+    test<boost::hash2::multiply_add_shift_64>();
+    test<boost::hash2::xxh3_64>();
+    test<boost::hash2::xxh3_128>();
+    test<boost::hash2::aeshash_64>();
+    test<boost::hash2::aeshash_128>();
     test<boost::hash2::spooky2_128>();
     test<boost::hash2::siphash_32>();
+    test<boost::hash2::siphash13_32>();
     test<boost::hash2::siphash_64>();
+    test<boost::hash2::siphash13_64>();
+    test<boost::hash2::highwayhash_64>();
+    test<boost::hash2::highwayhash_128>();
+    test<boost::hash2::highwayhash_256>();
     test<boost::hash2::md5_128>();
     test<boost::hash2::sha1_160>();
+    test<boost::hash2::sha2_256>();
+    test<boost::hash2::sha2_224>();
+    test<boost::hash2::sha2_512>();
+    test<boost::hash2::sha2_384>();
+    test<boost::hash2::sha2_512_256>();
+    test<boost::hash2::sha3_256>();
+    test<boost::hash2::sha3_512>();
+    test<boost::hash2::shake_128>();
+    test<boost::hash2::shake_256>();
+    test<boost::hash2::blake2b_512>();
+    test<boost::hash2::blake2b_256>();
+    test<boost::hash2::blake2s_256>();
+    test<boost::hash2::blake2s_128>();
+    test<boost::hash2::blake2bp_512>();
+    test<boost::hash2::blake2sp_256>();
+    test<boost::hash2::blake3>();
     test<boost::hash2::hmac_md5_128>();
     test<boost::hash2::hmac_sha1_160>();
+    test<boost::hash2::hmac_sha2_256>();
+    test<boost::hash2::hmac_sha2_224>();
+    test<boost::hash2::hmac_sha2_512>();
+    test<boost::hash2::hmac_sha2_384>();
+    test<boost::hash2::hmac_sha2_512_256>();
+    test<boost::hash2::poly1305>();
+    test<boost::hash2::polyval>();
+    test<boost::hash2::ghash>();
+    test< boost::hash2::buffered<boost::hash2::sha1_160> >();
+    test< boost::hash2::buffered<boost::hash2::xxhash_64, 7> >();
 
     return boost::report_errors();
 }
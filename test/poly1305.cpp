@@ -0,0 +1,157 @@
+// Copyright 2024 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#define _CRT_SECURE_NO_WARNINGS
+
+#include <boost/hash2/poly1305.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <string>
+#include <cstring>
+#include <cstddef>
+#include <cstdio>
+
+template<std::size_t N> std::string to_string( std::array<unsigned char, N> const & v )
+{
+    std::string r;
+
+    for( std::size_t i = 0; i < N; ++i )
+    {
+        char buffer[ 8 ];
+
+        std::snprintf( buffer, sizeof( buffer ), "%02x", static_cast<int>( v[ i ] ) );
+
+        r += buffer;
+    }
+
+    return r;
+}
+
+// r and s, each zero padded to 16 bytes
+
+static boost::hash2::poly1305 make( std::string const & r, std::string const & s )
+{
+    unsigned char key[ 32 ] = {};
+
+    std::memcpy( key, r.data(), r.size() );
+    std::memcpy( key + 16, s.data(), s.size() );
+
+    return boost::hash2::poly1305( key, 32 );
+}
+
+static std::string tag( boost::hash2::poly1305 h, void const * p, std::size_t n )
+{
+    h.update( p, n );
+    return to_string( h.result() );
+}
+
+static std::string tag( boost::hash2::poly1305 h, std::string const & m )
+{
+    return tag( h, m.data(), m.size() );
+}
+
+// Computed with OpenSSL, through the Python cryptography package, for
+// input[ i ] = i and the key of RFC 8439 section 2.5.2
+
+struct test_vector
+{
+    std::size_t n;
+    char const * r;
+};
+
+static const test_vector vectors[] =
+{
+    {     0, "0103808afb0db2fd4abff6af4149f51b" },
+    {     1, "0b8856490462076b4e3b3b025089ca22" },
+    {    15, "d1f28598bc850caae6c4579b04bb4fa0" },
+    {    16, "a18a0de2ba299128303a398e28bde4f0" },
+    {    17, "37477d65160c3ca0466aac5780785ef5" },
+    {    31, "0e25d93d39507235127a78c343311eca" },
+    {    32, "a0a50f18e27e3b64b55c78b710bc536b" },
+    {    33, "4b43c889c067c2fa13a0f416f5b91d74" },
+    {    63, "142957b2b03e4dca0400a6d54d2efc66" },
+    {    64, "2a7bebadae829f595bbde2cb6cca72a9" },
+    {    65, "f800520a429d0741ea4785e22d8b2af4" },
+    {   127, "5e168c4da19bf38e76d5d4a7e8f3b354" },
+    {   128, "810bdc8b490a58df33488ba2abb2acd9" },
+    {   129, "19374e4ad5c24113614520b7d680da2b" },
+    {   255, "1212245dc231ef863720469237c5f17b" },
+    {   256, "454deb20bff57759c2fdef9542c9ee85" },
+    {   257, "5b30f70640b4b943601f46f98a1873d4" },
+    {  1000, "19e03505a5a4cd520dec7bab3d587791" },
+    { 10000, "d6fb72acddc4122d323e6406ad639b3d" }
+};
+
+static const std::size_t N = 10000;
+static unsigned char buffer[ N ];
+
+int main()
+{
+    using namespace boost::hash2;
+
+    unsigned char const key[ 32 ] =
+    {
+        0x85, 0xd6, 0xbe, 0x78, 0x57, 0x55, 0x6d, 0x33, 0x7f, 0x44, 0x52, 0xfe, 0x42, 0xd5, 0x06, 0xa8,
+        0x01, 0x03, 0x80, 0x8a, 0xfb, 0x0d, 0xb2, 0xfd, 0x4a, 0xbf, 0xf6, 0xaf, 0x41, 0x49, 0xf5, 0x1b,
+    };
+
+    // Test vectors from https://www.rfc-editor.org/rfc/rfc8439, section 2.5.2
+
+    BOOST_TEST_EQ( tag( poly1305( key, 32 ), "Cryptographic Forum Research Group" ), std::string( "a8061dc1305136c6c22b8baf0c0127a9" ) );
+
+    // and appendix A.3
+
+    std::string const ietf(
+        "Any submission to the IETF intended by the Contributor for publication as all or part of an IETF "
+        "Internet-Draft or RFC and any statement made within the context of an IETF activity is considered "
+        "an \"IETF Contribution\". Such statements include oral statements in IETF sessions, as well as "
+        "written and electronic communications made at any time or place, which are addressed to" );
+
+    std::string const jabberwocky(
+        "'Twas brillig, and the slithy toves\nDid gyre and gimble in the wabe:\n"
+        "All mimsy were the borogoves,\nAnd the mome raths outgrabe." );
+
+    std::string const r3( "\x36\xe5\xf6\xb5\xc5\xe0\x60\x70\xf0\xef\xca\x96\x22\x7a\x86\x3e" );
+
+    std::string const r4( "\x1c\x92\x40\xa5\xeb\x55\xd3\x8a\xf3\x33\x88\x86\x04\xf6\xb5\xf0" );
+    std::string const s4( "\x47\x39\x17\xc1\x40\x2b\x80\x09\x9d\xca\x5c\xbc\x20\x70\x75\xc0" );
+
+    BOOST_TEST_EQ( tag( make( "", "" ), std::string( 64, '\0' ) ), std::string( "00000000000000000000000000000000" ) );
+    BOOST_TEST_EQ( tag( make( "", r3 ), ietf ), std::string( "36e5f6b5c5e06070f0efca96227a863e" ) );
+    BOOST_TEST_EQ( tag( make( r3, "" ), ietf ), std::string( "f3477e7cd95417af89a6b8794c310cf0" ) );
+    BOOST_TEST_EQ( tag( make( r4, s4 ), jabberwocky ), std::string( "4541669a7eaaee61e708dc7cbcc5eb62" ) );
+
+    BOOST_TEST_EQ( tag( make( "\x02", "" ), std::string( 16, '\xff' ) ), std::string( "03000000000000000000000000000000" ) );
+    BOOST_TEST_EQ( tag( make( "\x02", std::string( 16, '\xff' ) ), std::string( "\x02" ) + std::string( 15, '\0' ) ), std::string( "03000000000000000000000000000000" ) );
+    BOOST_TEST_EQ( tag( make( "\x01", "" ), std::string( 16, '\xff' ) + '\xf0' + std::string( 15, '\xff' ) + '\x11' + std::string( 15, '\0' ) ), std::string( "05000000000000000000000000000000" ) );
+    BOOST_TEST_EQ( tag( make( "\x01", "" ), std::string( 16, '\xff' ) + '\xfb' + std::string( 15, '\xfe' ) + std::string( 16, '\x01' ) ), std::string( "00000000000000000000000000000000" ) );
+    BOOST_TEST_EQ( tag( make( "\x02", "" ), '\xfd' + std::string( 15, '\xff' ) ), std::string( "faffffffffffffffffffffffffffffff" ) );
+
+    for( std::size_t i = 0; i < N; ++i )
+    {
+        buffer[ i ] = static_cast<unsigned char>( i );
+    }
+
+    for( std::size_t i = 0; i < sizeof( vectors ) / sizeof( vectors[0] ); ++i )
+    {
+        test_vector const & v = vectors[ i ];
+
+        BOOST_TEST_EQ( tag( poly1305( key, 32 ), buffer, v.n ), std::string( v.r ) );
+    }
+
+    // seeds other than a 32 byte key are expanded into one; regression
+    // values, computed with this implementation
+
+    BOOST_TEST_EQ( tag( poly1305(), "" ), std::string( "64a09fcf36aa95d28e1c17be99f7ac44" ) );
+    BOOST_TEST_EQ( tag( poly1305( 0x9e3779b97f4a7c15ull ), "abc" ), std::string( "96263cef0d7e7f8c70947eeb6a2bde0f" ) );
+
+    // the integral seed is the same as its 8 bytes, little endian
+
+    {
+        unsigned char const seed[] = { 0x15, 0x7c, 0x4a, 0x7f, 0xb9, 0x79, 0x37, 0x9e };
+
+        BOOST_TEST_EQ( tag( poly1305( seed, 8 ), buffer, 1000 ), tag( poly1305( 0x9e3779b97f4a7c15ull ), buffer, 1000 ) );
+    }
+
+    return boost::report_errors();
+}
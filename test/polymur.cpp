@@ -0,0 +1,162 @@
+// Copyright 2024 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/polymur.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <set>
+#include <cstring>
+#include <cstdint>
+#include <cstddef>
+
+template<class H> typename H::result_type hash( H h, void const * p, std::size_t n )
+{
+    h.update( p, n );
+    return h.result();
+}
+
+struct test_vector
+{
+    std::size_t n;
+    std::uint64_t r;
+};
+
+// input[ i ] = i; regression values, computed with this implementation.
+// polymur_64 isn't claimed to match PolymurHash, so there are no
+// upstream vectors to check against
+
+static const test_vector vectors[] =
+{
+    {     0, 0x3a2ed1d853c000c3ull },
+    {     1, 0xe1c3e0bb86bd362dull },
+    {     3, 0x00b07887e0607b06ull },
+    {     4, 0x32a97702b61ac010ull },
+    {     7, 0x3c9d68754ddf2489ull },
+    {     8, 0xba0a79b5b1d05e96ull },
+    {     9, 0xc6aa908a02781b1cull },
+    {    15, 0xa6bbe7086fd41dffull },
+    {    16, 0xd47174b5d679eb96ull },
+    {    21, 0x599b2cb683ba27f3ull },
+    {    22, 0x5c3916bfeb4a7f13ull },
+    {    48, 0xf01125ad67944898ull },
+    {    49, 0x51bacfc0beeb5141ull },
+    {    50, 0xc56eadf776228a06ull },
+    {    98, 0x3741b9670e2eefe7ull },
+    {    99, 0xf75c5fa93f475492ull },
+    {   100, 0x91b628b1d7d879aaull },
+    {   147, 0x42acd2f330026600ull },
+    {   148, 0x7658597af8c6606aull },
+    {   149, 0x1ecba7dd473d8f93ull },
+    {  1000, 0x2bbfa0dda970525eull },
+    { 10000, 0xf590cc30abb12d1bull },
+};
+
+static const std::size_t N = 10000;
+static unsigned char buffer[ N ];
+
+int main()
+{
+    using boost::hash2::polymur_64;
+
+    for( std::size_t i = 0; i < N; ++i )
+    {
+        buffer[ i ] = static_cast<unsigned char>( i );
+    }
+
+    for( std::size_t i = 0; i < sizeof( vectors ) / sizeof( vectors[0] ); ++i )
+    {
+        test_vector const & v = vectors[ i ];
+
+        BOOST_TEST_EQ( hash( polymur_64(), buffer, v.n ), v.r );
+    }
+
+    // regression values, computed with this implementation
+
+    BOOST_TEST_EQ( hash( polymur_64( 0x9e3779b97f4a7c15ull ), "abc", 3 ), 0x7cf422fb847f1633ull );
+    BOOST_TEST_EQ( hash( polymur_64( 0x9e3779b97f4a7c15ull ), buffer, 100 ), 0xc1b173d8403b49d7ull );
+
+    // a byte seed of up to 8 bytes is read as a little-endian integer
+
+    {
+        unsigned char const seed[] = { 0x15, 0x7c, 0x4a, 0x7f, 0xb9, 0x79, 0x37, 0x9e };
+
+        BOOST_TEST_EQ( hash( polymur_64( seed, 8 ), buffer, 100 ), hash( polymur_64( 0x9e3779b97f4a7c15ull ), buffer, 100 ) );
+        BOOST_TEST_EQ( hash( polymur_64( seed, 3 ), buffer, 100 ), hash( polymur_64( 0x4a7c15 ), buffer, 100 ) );
+        BOOST_TEST_EQ( hash( polymur_64( seed, 0 ), buffer, 100 ), hash( polymur_64(), buffer, 100 ) );
+    }
+
+    // of a longer byte seed, the first 16 bytes, zero padded, are the two
+    // seeds of the key schedule, and the rest are hashed into the tweak
+
+    {
+        unsigned char seed[ 20 ];
+
+        for( int i = 0; i < 20; ++i )
+        {
+            seed[ i ] = static_cast<unsigned char>( i + 1 );
+        }
+
+        unsigned char seed2[ 16 ] = {};
+        std::memcpy( seed2, seed, 12 );
+
+        BOOST_TEST_EQ( hash( polymur_64( seed, 12 ), buffer, 100 ), hash( polymur_64( seed2, 16 ), buffer, 100 ) );
+
+        // regression values, computed with this implementation
+
+        BOOST_TEST_EQ( hash( polymur_64( seed, 16 ), buffer, 100 ), 0xa65e563c06eff182ull );
+        BOOST_TEST_EQ( hash( polymur_64( seed, 20 ), buffer, 100 ), 0xced3c72380849f33ull );
+    }
+
+    // result() restarts with the previous result as the tweak;
+    // regression values, computed with this implementation
+
+    {
+        polymur_64 h;
+        h.update( "abc", 3 );
+
+        BOOST_TEST_EQ( h.result(), 0xf1210b08e7d98044ull );
+        BOOST_TEST_EQ( h.result(), 0x1176b3ba1d13c7faull );
+    }
+
+    // hash( p, n ) must match update( p, n ) and result(), for every
+    // length of the tail
+
+    {
+        polymur_64 const h1;
+        polymur_64 const h2( 0x9e3779b97f4a7c15ull );
+
+        for( std::size_t n = 0; n <= 1100; ++n )
+        {
+            BOOST_TEST_EQ( h1.hash( buffer, n ), hash( h1, buffer, n ) );
+            BOOST_TEST_EQ( h2.hash( buffer, n ), hash( h2, buffer, n ) );
+        }
+    }
+
+    // a copy of a seeded prototype shares its key schedule
+
+    {
+        polymur_64 const h0( 0x9e3779b97f4a7c15ull );
+
+        for( std::size_t n = 0; n <= 200; ++n )
+        {
+            BOOST_TEST_EQ( hash( h0, buffer, n ), hash( polymur_64( 0x9e3779b97f4a7c15ull ), buffer, n ) );
+        }
+    }
+
+    // the length is part of the hash, so runs of zeros don't collide
+
+    {
+        std::memset( buffer, 0, 200 );
+
+        std::set<std::uint64_t> s;
+
+        for( std::size_t n = 0; n <= 200; ++n )
+        {
+            s.insert( hash( polymur_64(), buffer, n ) );
+        }
+
+        BOOST_TEST_EQ( s.size(), 201u );
+    }
+
+    return boost::report_errors();
+}
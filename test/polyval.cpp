@@ -0,0 +1,164 @@
+// Copyright 2024 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#define _CRT_SECURE_NO_WARNINGS
+
+#include <boost/hash2/polyval.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <string>
+#include <cstddef>
+#include <cstdio>
+
+template<std::size_t N> std::string to_string( std::array<unsigned char, N> const & v )
+{
+    std::string r;
+
+    for( std::size_t i = 0; i < N; ++i )
+    {
+        char buffer[ 8 ];
+
+        std::snprintf( buffer, sizeof( buffer ), "%02x", static_cast<int>( v[ i ] ) );
+
+        r += buffer;
+    }
+
+    return r;
+}
+
+static std::string from_hex( char const * s )
+{
+    std::string r;
+
+    for( ; s[ 0 ] && s[ 1 ]; s += 2 )
+    {
+        unsigned x = 0;
+        std::sscanf( s, "%2x", &x );
+
+        r += static_cast<char>( x );
+    }
+
+    return r;
+}
+
+template<class H> std::string hash( H h, void const * p, std::size_t n )
+{
+    h.update( p, n );
+    return to_string( h.result() );
+}
+
+template<class H> std::string hash( std::string const & key, std::string const & m )
+{
+    return hash( H( reinterpret_cast<unsigned char const*>( key.data() ), key.size() ), m.data(), m.size() );
+}
+
+// input[ i ] = i, with the key of RFC 8452 appendix C.1 for polyval,
+// and that of GCM test case 2 for ghash. The polyval values were
+// computed with a separate implementation of RFC 8452, checked against
+// the appendix; the ghash values with OpenSSL's AES-GCM, through the
+// Python cryptography package, as the tag xor E(K, Y0)
+
+struct test_vector
+{
+    std::size_t n;
+    char const * polyval;
+    char const * ghash;
+};
+
+static const test_vector vectors[] =
+{
+    {     0, "00000000000000000000000000000000", "00000000000000000000000000000000" },
+    {     1, "28de36c6d4d39e2b203d308a8c96768a", "d326e5c0a72a570d9692017ee375c24b" },
+    {    15, "2bfd02257e9d44a36f61226cdefcaac1", "8d04783b0fd26e4e6e1783a80ee5b1a2" },
+    {    16, "47869470d42dfe2d707c307132988144", "0de85b5a65bd02fddb131b2d26f7282d" },
+    {    17, "bf4916490423196c18646680691c9e58", "de3a11affcce7942192b2c3410f73e62" },
+    {    31, "7ee9fba7e0fd7cb2c3c3b709f07cf9fc", "d5851ae670ed972005134b13251f551e" },
+    {    32, "78c8c6f6c11df99998dea3e248873abd", "7a8867856a4180e687d004edee9d2efb" },
+    {    33, "e92a294bdad81e157656131966818a3e", "d364a1ec05ad3f76aaf112c1bdec704f" },
+    {    63, "03f7387da44402b30fe4e99feddeb8a6", "82156c538ccab2fd2ef18dc4e46bb03a" },
+    {    64, "d06253259305f9d2ddf9f198fc1baaac", "72daad3477e053d1c3bd6ccde8c80f0b" },
+    {    65, "363af2843b85ab24ec12a1e1b64e91ff", "15794882800d791602502385e269b685" },
+    {   127, "c15b95e2b2077d09240edeaaa2c46cf5", "f8d6fcd66df2dbc952e18f75b76695f8" },
+    {   128, "b8a753a8a9047bfce412de75e07cdc68", "b79c45b855d5d73160b233933586a361" },
+    {   129, "a3f645875d077f52df0963a1186ffa90", "e6f9bdc5e9fb86b9cb0c6fbbae739ae3" },
+    {  1000, "8f071f75a380cf6a98664c143cff772d", "b576ccb370c1858d989fc0d8bae3cd52" },
+    { 10000, "ce1ed981fdcb2d6f9b5922cb824ea78c", "0f071d6d55417e2b264c03a1e287b1b6" }
+};
+
+static const std::size_t N = 10000;
+static unsigned char buffer[ N ];
+
+int main()
+{
+    using namespace boost::hash2;
+
+    // Test vectors from https://www.rfc-editor.org/rfc/rfc8452, appendix C.1;
+    // the message, followed by the length block, is the POLYVAL input
+
+    std::string const k1 = from_hex( "d9b360279694941ac5dbc6987ada7377" );
+
+    BOOST_TEST_EQ( hash<polyval>( k1, "" ), std::string( "00000000000000000000000000000000" ) );
+    BOOST_TEST_EQ( hash<polyval>( k1, from_hex( "0100000000000000" ) ), std::string( "eb93b7740962c5e49d2a90a7dc5cec74" ) );
+    BOOST_TEST_EQ( hash<polyval>( k1, from_hex( "010000000000000000000000" ) ), std::string( "48eb6c6c5a2dbe4a1dde508fee06361b" ) );
+    BOOST_TEST_EQ( hash<polyval>( k1, from_hex( "01000000000000000000000000000000" ) ), std::string( "20806c26e3c1de019e111255708031d6" ) );
+    BOOST_TEST_EQ( hash<polyval>( k1, from_hex( "0100000000000000000000000000000002000000000000000000000000000000" ) ), std::string( "ce6edc9a50b36d9a98986bbf6a261c3b" ) );
+
+    // Test vectors from the GCM specification, test cases 2 and 3,
+    // https://csrc.nist.rip/groups/ST/toolkit/BCM/documents/proposedmodes/gcm/gcm-spec.pdf;
+    // with E(K, Y0) as the mask, the result is the GCM tag
+
+    {
+        std::string const h = from_hex( "66e94bd4ef8a2c3b884cfa59ca342b2e" );
+        std::string const c = from_hex( "0388dace60b6a392f328c2b971b2fe78" );
+
+        BOOST_TEST_EQ( hash<ghash>( h, c ), std::string( "f38cbb1ad69223dcc3457ae5b6b0f885" ) );
+        BOOST_TEST_EQ( hash<ghash>( h + from_hex( "58e2fccefa7e3061367f1d57a4e7455a" ), c ), std::string( "ab6e47d42cec13bdf53a67b21257bddf" ) );
+    }
+
+    {
+        std::string const h = from_hex( "b83b533708bf535d0aa6e52980d53b78" );
+        std::string const c = from_hex(
+            "42831ec2217774244b7221b784d0d49ce3aa212f2c02a4e035c17e2329aca12e"
+            "21d514b25466931c7d8f6a5aac84aa051ba30b396a0aac973d58e091473f5985" );
+
+        BOOST_TEST_EQ( hash<ghash>( h, c ), std::string( "7f1b32b81b820d02614f8895ac1d4eac" ) );
+        BOOST_TEST_EQ( hash<ghash>( h + from_hex( "3247184b3c4f69a44dbcd22887bbb418" ), c ), std::string( "4d5c2af327cd64a62cf35abd2ba6fab4" ) );
+    }
+
+    for( std::size_t i = 0; i < N; ++i )
+    {
+        buffer[ i ] = static_cast<unsigned char>( i );
+    }
+
+    {
+        std::string const k2 = from_hex( "66e94bd4ef8a2c3b884cfa59ca342b2e" );
+
+        for( std::size_t i = 0; i < sizeof( vectors ) / sizeof( vectors[0] ); ++i )
+        {
+            test_vector const & v = vectors[ i ];
+
+            BOOST_TEST_EQ( hash( polyval( reinterpret_cast<unsigned char const*>( k1.data() ), 16 ), buffer, v.n ), std::string( v.polyval ) );
+            BOOST_TEST_EQ( hash( ghash( reinterpret_cast<unsigned char const*>( k2.data() ), 16 ), buffer, v.n ), std::string( v.ghash ) );
+        }
+    }
+
+    // seeds other than a 16 or 32 byte key are expanded into one;
+    // regression values, computed with this implementation
+
+    BOOST_TEST_EQ( hash( polyval(), "", 0 ), std::string( "69229b133ba6be0beacb16d9fc12fe03" ) );
+    BOOST_TEST_EQ( hash( polyval( 0x9e3779b97f4a7c15ull ), "abc", 3 ), std::string( "9399f7140c217906eb82ded74f3a5ea5" ) );
+
+    BOOST_TEST_EQ( hash( ghash(), "", 0 ), std::string( "12aa24d4f73f865349d15e15c4236960" ) );
+    BOOST_TEST_EQ( hash( ghash( 0x9e3779b97f4a7c15ull ), "abc", 3 ), std::string( "7da5966998a52a14381f27f951b5b253" ) );
+
+    // the integral seed is the same as its 8 bytes, little endian
+
+    {
+        unsigned char const seed[] = { 0x15, 0x7c, 0x4a, 0x7f, 0xb9, 0x79, 0x37, 0x9e };
+
+        BOOST_TEST_EQ( hash( polyval( seed, 8 ), buffer, 1000 ), hash( polyval( 0x9e3779b97f4a7c15ull ), buffer, 1000 ) );
+        BOOST_TEST_EQ( hash( ghash( seed, 8 ), buffer, 1000 ), hash( ghash( 0x9e3779b97f4a7c15ull ), buffer, 1000 ) );
+    }
+
+    return boost::report_errors();
+}
@@ -0,0 +1,57 @@
+// Copyright 2024 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#define _CRT_SECURE_NO_WARNINGS
+
+#include <boost/hash2/sha2.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <cstdint>
+#include <string>
+#include <cstddef>
+#include <cstdio>
+
+template<std::size_t N> std::string to_string( std::array<unsigned char, N> const & v )
+{
+    std::string r;
+
+    for( std::size_t i = 0; i < N; ++i )
+    {
+        char buffer[ 8 ];
+
+        std::snprintf( buffer, sizeof( buffer ), "%02x", static_cast<int>( v[ i ] ) );
+
+        r += buffer;
+    }
+
+    return r;
+}
+
+template<class H> std::string digest( std::string const & s )
+{
+    H h;
+
+    h.update( s.data(), s.size() );
+
+    return to_string( h.result() );
+}
+
+using boost::hash2::sha2_224;
+
+int main()
+{
+    // Test vectors from https://csrc.nist.gov/projects/cryptographic-standards-and-guidelines/example-values
+
+    BOOST_TEST_EQ( digest<sha2_224>( "" ), std::string( "d14a028c2a3a2bc9476102bb288234c415a2b01f828ea62ac5b3e42f" ) );
+    BOOST_TEST_EQ( digest<sha2_224>( "abc" ), std::string( "23097d223405d8228642a477bda255b32aadbce4bda0b3f7e36c9da7" ) );
+    BOOST_TEST_EQ( digest<sha2_224>( "abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq" ), std::string( "75388b16512776cc5dba5da1fd890150b0c6455cb4f58b1952522525" ) );
+    BOOST_TEST_EQ( digest<sha2_224>( "abcdefghbcdefghicdefghijdefghijkefghijklfghijklmghijklmnhijklmnoijklmnopjklmnopqklmnopqrlmnopqrsmnopqrstnopqrstu" ), std::string( "c97ca9a559850ce97a04a96def6d99a9e0e0e2ab14e6b8df265fc0b3" ) );
+    BOOST_TEST_EQ( digest<sha2_224>( std::string( 1000000, 'a' ) ), std::string( "20794655980c91d8bbb4c1ea97618a4bf03f42581948b2ee4ee7ad67" ) );
+
+    // Test vectors from https://en.wikipedia.org/wiki/SHA-2
+
+    BOOST_TEST_EQ( digest<sha2_224>( "The quick brown fox jumps over the lazy dog" ), std::string( "730e109bd7a8a32b1cb9d9a09aa2325d2430587ddbc0c38bad911525" ) );
+    BOOST_TEST_EQ( digest<sha2_224>( "The quick brown fox jumps over the lazy dog." ), std::string( "619cba8e8e05826e9b8c519c0a5c68f4fb653e8a3d8aa04bb2c8cd4c" ) );
+
+    return boost::report_errors();
+}
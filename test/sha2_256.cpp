@@ -0,0 +1,57 @@
+// Copyright 2024 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#define _CRT_SECURE_NO_WARNINGS
+
+#include <boost/hash2/sha2.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <cstdint>
+#include <string>
+#include <cstddef>
+#include <cstdio>
+
+template<std::size_t N> std::string to_string( std::array<unsigned char, N> const & v )
+{
+    std::string r;
+
+    for( std::size_t i = 0; i < N; ++i )
+    {
+        char buffer[ 8 ];
+
+        std::snprintf( buffer, sizeof( buffer ), "%02x", static_cast<int>( v[ i ] ) );
+
+        r += buffer;
+    }
+
+    return r;
+}
+
+template<class H> std::string digest( std::string const & s )
+{
+    H h;
+
+    h.update( s.data(), s.size() );
+
+    return to_string( h.result() );
+}
+
+using boost::hash2::sha2_256;
+
+int main()
+{
+    // Test vectors from https://csrc.nist.gov/projects/cryptographic-standards-and-guidelines/example-values
+
+    BOOST_TEST_EQ( digest<sha2_256>( "" ), std::string( "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855" ) );
+    BOOST_TEST_EQ( digest<sha2_256>( "abc" ), std::string( "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad" ) );
+    BOOST_TEST_EQ( digest<sha2_256>( "abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq" ), std::string( "248d6a61d20638b8e5c026930c3e6039a33ce45964ff2167f6ecedd419db06c1" ) );
+    BOOST_TEST_EQ( digest<sha2_256>( "abcdefghbcdefghicdefghijdefghijkefghijklfghijklmghijklmnhijklmnoijklmnopjklmnopqklmnopqrlmnopqrsmnopqrstnopqrstu" ), std::string( "cf5b16a778af8380036ce59e7b0492370b249b11e8f07a51afac45037afee9d1" ) );
+    BOOST_TEST_EQ( digest<sha2_256>( std::string( 1000000, 'a' ) ), std::string( "cdc76e5c9914fb9281a1c7e284d73e67f1809a48a497200e046d39ccc7112cd0" ) );
+
+    // Test vectors from https://en.wikipedia.org/wiki/SHA-2
+
+    BOOST_TEST_EQ( digest<sha2_256>( "The quick brown fox jumps over the lazy dog" ), std::string( "d7a8fbb307d7809469ca9abcb0082e4f8d5651e46d3cdb762d02d0bf37c9e592" ) );
+    BOOST_TEST_EQ( digest<sha2_256>( "The quick brown fox jumps over the lazy dog." ), std::string( "ef537f25c895bfa782526529a9b63d97aa631564d5d789c2b765448c8635fb6c" ) );
+
+    return boost::report_errors();
+}
@@ -0,0 +1,57 @@
+// Copyright 2024 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#define _CRT_SECURE_NO_WARNINGS
+
+#include <boost/hash2/sha2.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <cstdint>
+#include <string>
+#include <cstddef>
+#include <cstdio>
+
+template<std::size_t N> std::string to_string( std::array<unsigned char, N> const & v )
+{
+    std::string r;
+
+    for( std::size_t i = 0; i < N; ++i )
+    {
+        char buffer[ 8 ];
+
+        std::snprintf( buffer, sizeof( buffer ), "%02x", static_cast<int>( v[ i ] ) );
+
+        r += buffer;
+    }
+
+    return r;
+}
+
+template<class H> std::string digest( std::string const & s )
+{
+    H h;
+
+    h.update( s.data(), s.size() );
+
+    return to_string( h.result() );
+}
+
+using boost::hash2::sha2_512_256;
+
+int main()
+{
+    // Test vectors from https://csrc.nist.gov/projects/cryptographic-standards-and-guidelines/example-values
+
+    BOOST_TEST_EQ( digest<sha2_512_256>( "" ), std::string( "c672b8d1ef56ed28ab87c3622c5114069bdd3ad7b8f9737498d0c01ecef0967a" ) );
+    BOOST_TEST_EQ( digest<sha2_512_256>( "abc" ), std::string( "53048e2681941ef99b2e29b76b4c7dabe4c2d0c634fc6d46e0e2f13107e7af23" ) );
+    BOOST_TEST_EQ( digest<sha2_512_256>( "abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq" ), std::string( "bde8e1f9f19bb9fd3406c90ec6bc47bd36d8ada9f11880dbc8a22a7078b6a461" ) );
+    BOOST_TEST_EQ( digest<sha2_512_256>( "abcdefghbcdefghicdefghijdefghijkefghijklfghijklmghijklmnhijklmnoijklmnopjklmnopqklmnopqrlmnopqrsmnopqrstnopqrstu" ), std::string( "3928e184fb8690f840da3988121d31be65cb9d3ef83ee6146feac861e19b563a" ) );
+    BOOST_TEST_EQ( digest<sha2_512_256>( std::string( 1000000, 'a' ) ), std::string( "9a59a052930187a97038cae692f30708aa6491923ef5194394dc68d56c74fb21" ) );
+
+    // Test vectors from https://en.wikipedia.org/wiki/SHA-2
+
+    BOOST_TEST_EQ( digest<sha2_512_256>( "The quick brown fox jumps over the lazy dog" ), std::string( "dd9d67b371519c339ed8dbd25af90e976a1eeefd4ad3d889005e532fc5bef04d" ) );
+    BOOST_TEST_EQ( digest<sha2_512_256>( "The quick brown fox jumps over the lazy dog." ), std::string( "1546741840f8a492b959d9b8b2344b9b0eb51b004bba35c0aebaac86d45264c3" ) );
+
+    return boost::report_errors();
+}
@@ -0,0 +1,184 @@
+// Copyright 2024 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#define _CRT_SECURE_NO_WARNINGS
+
+#include <boost/hash2/sha3.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <vector>
+#include <string>
+#include <cstddef>
+#include <cstdio>
+
+template<std::size_t N> std::string to_string( std::array<unsigned char, N> const & v )
+{
+    std::string r;
+
+    for( std::size_t i = 0; i < N; ++i )
+    {
+        char buffer[ 8 ];
+
+        std::snprintf( buffer, sizeof( buffer ), "%02x", static_cast<int>( v[ i ] ) );
+
+        r += buffer;
+    }
+
+    return r;
+}
+
+template<class H> std::string digest( std::string const & s )
+{
+    H h;
+
+    h.update( s.data(), s.size() );
+
+    return to_string( h.result() );
+}
+
+// consecutive result() calls return consecutive parts of the output
+
+template<class H> std::string squeeze( std::string const & s, int k )
+{
+    H h;
+
+    h.update( s.data(), s.size() );
+
+    std::string r;
+
+    for( int i = 0; i < k; ++i )
+    {
+        r += to_string( h.result() );
+    }
+
+    return r;
+}
+
+template<class H> std::string digest( H h, std::string const & s )
+{
+    h.update( s.data(), s.size() );
+
+    return to_string( h.result() );
+}
+
+template<class H> void test_seed( char const * expected )
+{
+    unsigned char const seed[ 8 ] = { 0x15, 0x7c, 0x4a, 0x7f, 0xb9, 0x79, 0x37, 0x9e };
+
+    BOOST_TEST_EQ( digest( H( 0x9e3779b97f4a7c15ull ), "abc" ), std::string( expected ) );
+    BOOST_TEST_EQ( digest( H( seed, 8 ), "abc" ), std::string( expected ) );
+}
+
+static unsigned char buffer[ 6000 ];
+
+template<class H, class Hx> void test_x4()
+{
+    std::size_t const lengths[] = { 0, 1, 71, 72, 73, 135, 136, 137, 1000, 5, 271, 272, 273, 3000, 0, 143, 144, 145 };
+    std::size_t const M = sizeof( lengths ) / sizeof( lengths[ 0 ] );
+
+    for( std::size_t k = 0; k <= M; ++k )
+    {
+        std::vector<void const*> p( k + 1 );
+        std::vector<std::size_t> n( k + 1 );
+        std::vector<typename Hx::result_type> r( k + 1 );
+
+        std::size_t offset = 0;
+
+        for( std::size_t i = 0; i < k; ++i )
+        {
+            p[ i ] = buffer + offset;
+            n[ i ] = lengths[ i ];
+
+            offset += lengths[ i ];
+        }
+
+        Hx::hash( k, p.data(), n.data(), r.data() );
+
+        for( std::size_t i = 0; i < k; ++i )
+        {
+            H h;
+
+            h.update( p[ i ], n[ i ] );
+
+            BOOST_TEST( h.result() == r[ i ] );
+        }
+    }
+}
+
+int main()
+{
+    using namespace boost::hash2;
+
+    // Test vectors from https://www.di-mgt.com.au/sha_testvectors.html
+
+    std::string const m448( "abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq" );
+    std::string const m896( "abcdefghbcdefghicdefghijdefghijkefghijklfghijklmghijklmnhijklmnoijklmnopjklmnopqklmnopqrlmnopqrsmnopqrstnopqrstu" );
+    std::string const m1m( 1000000, 'a' );
+
+    BOOST_TEST_EQ( digest<sha3_256>( "" ), std::string( "a7ffc6f8bf1ed76651c14756a061d662f580ff4de43b49fa82d80a4b80f8434a" ) );
+    BOOST_TEST_EQ( digest<sha3_256>( "abc" ), std::string( "3a985da74fe225b2045c172d6bd390bd855f086e3e9d525b46bfe24511431532" ) );
+    BOOST_TEST_EQ( digest<sha3_256>( m448 ), std::string( "41c0dba2a9d6240849100376a8235e2c82e1b9998a999e21db32dd97496d3376" ) );
+    BOOST_TEST_EQ( digest<sha3_256>( m896 ), std::string( "916f6061fe879741ca6469b43971dfdb28b1a32dc36cb3254e812be27aad1d18" ) );
+    BOOST_TEST_EQ( digest<sha3_256>( m1m ), std::string( "5c8875ae474a3634ba4fd55ec85bffd661f32aca75c6d699d0cdcb6c115891c1" ) );
+
+    BOOST_TEST_EQ( digest<sha3_512>( "" ), std::string( "a69f73cca23a9ac5c8b567dc185a756e97c982164fe25859e0d1dcc1475c80a615b2123af1f5f94c11e3e9402c3ac558f500199d95b6d3e301758586281dcd26" ) );
+    BOOST_TEST_EQ( digest<sha3_512>( "abc" ), std::string( "b751850b1a57168a5693cd924b6b096e08f621827444f70d884f5d0240d2712e10e116e9192af3c91a7ec57647e3934057340b4cf408d5a56592f8274eec53f0" ) );
+    BOOST_TEST_EQ( digest<sha3_512>( m448 ), std::string( "04a371e84ecfb5b8b77cb48610fca8182dd457ce6f326a0fd3d7ec2f1e91636dee691fbe0c985302ba1b0d8dc78c086346b533b49c030d99a27daf1139d6e75e" ) );
+    BOOST_TEST_EQ( digest<sha3_512>( m896 ), std::string( "afebb2ef542e6579c50cad06d2e578f9f8dd6881d7dc824d26360feebf18a4fa73e3261122948efcfd492e74e82e2189ed0fb440d187f382270cb455f21dd185" ) );
+    BOOST_TEST_EQ( digest<sha3_512>( m1m ), std::string( "3c3a876da14034ab60627c077bb98f7e120a2a5370212dffb3385a18d4f38859ed311d0a9d5141ce9cc5c66ee689b266a8aa18ace8282a0e0db596c90b0a7b87" ) );
+
+    // Test vectors from https://en.wikipedia.org/wiki/SHA-3#Examples_of_SHA-3_variants
+
+    BOOST_TEST_EQ( digest<shake_128>( "" ), std::string( "7f9c2ba4e88f827d616045507605853ed73b8093f6efbc88eb1a6eacfa66ef26" ) );
+    BOOST_TEST_EQ( digest<shake_128>( "The quick brown fox jumps over the lazy dog" ), std::string( "f4202e3c5852f9182a0430fd8144f0a74b95e7417ecae17db0f8cfeed0e3e66e" ) );
+    BOOST_TEST_EQ( digest<shake_128>( "The quick brown fox jumps over the lazy dof" ), std::string( "853f4538be0db9621a6cea659a06c1107b1f83f02b13d18297bd39d7411cf10c" ) );
+
+    BOOST_TEST_EQ( digest<shake_256>( "" ), std::string( "46b9dd2b0ba88d13233b3feb743eeb243fcd52ea62b81b82b50c27646ed5762fd75dc4ddd8c0f200cb05019d67b592f6fc821c49479ab48640292eacb3b7c4be" ) );
+
+    // Test vectors from https://csrc.nist.gov/projects/cryptographic-standards-and-guidelines/example-values,
+    // the 1600 bit message of 0xA3 bytes, with 4096 bits of SHAKE output
+
+    std::string const a3( 200, '\xA3' );
+
+    BOOST_TEST_EQ( digest<sha3_256>( a3 ), std::string( "79f38adec5c20307a98ef76e8324afbfd46cfd81b22e3973c65fa1bd9de31787" ) );
+    BOOST_TEST_EQ( digest<sha3_512>( a3 ), std::string( "e76dfad22084a8b1467fcf2ffa58361bec7628edf5f3fdc0e4805dc48caeeca81b7c13c30adf52a3659584739a2df46be589c51ca1a4a8416df6545a1ce8ba00" ) );
+
+    BOOST_TEST_EQ( squeeze<shake_128>( a3, 16 ), std::string(
+        "131ab8d2b594946b9c81333f9bb6e0ce75c3b93104fa3469d3917457385da037cf232ef7164a6d1eb448c8908186ad852d3f85a5cf28da1ab6fe343817197846"
+        "7f1c05d58c7ef38c284c41f6c2221a76f12ab1c04082660250802294fb87180213fdef5b0ecb7df50ca1f8555be14d32e10f6edcde892c09424b29f597afc270"
+        "c904556bfcb47a7d40778d390923642b3cbd0579e60908d5a000c1d08b98ef933f806445bf87f8b009ba9e94f7266122ed7ac24e5e266c42a82fa1bbefb7b8db"
+        "0066e16a85e0493f07df4809aec084a593748ac3dde5a6d7aae1e8b6e5352b2d71efbb47d4caeed5e6d633805d2d323e6fd81b4684b93a2677d45e7421c2c6ae"
+        "a259b855a698fd7d13477a1fe53e5a4a6197dbec5ce95f505b520bcd9570c4a8265a7e01f89c0c002c59bfec6cd4a5c109258953ee5ee70cd577ee217af21fa7"
+        "0178f0946c9bf6ca8751793479f6b537737e40b6ed28511d8a2d7e73eb75f8daac912ff906e0ab955b083bac45a8e5e9b744c8506f37e9b4e749a184b30f43eb"
+        "188d855f1b70d71ff3e50c537ac1b0f8974f0fe1a6ad295ba42f6aec74d123a7abedde6e2c0711cab36be5acb1a5a11a4b1db08ba6982efccd716929a7741cfc"
+        "63aa4435e0b69a9063e880795c3dc5ef3272e11c497a91acf699fefee206227a44c9fb359fd56ac0a9a75a743cff6862f17d7259ab075216c0699511643b6439" ) );
+
+    BOOST_TEST_EQ( squeeze<shake_256>( a3, 8 ), std::string(
+        "cd8a920ed141aa0407a22d59288652e9d9f1a7ee0c1e7c1ca699424da84a904d2d700caae7396ece96604440577da4f3aa22aeb8857f961c4cd8e06f0ae6610b"
+        "1048a7f64e1074cd629e85ad7566048efc4fb500b486a3309a8f26724c0ed628001a1099422468de726f1061d99eb9e93604d5aa7467d4b1bd6484582a384317"
+        "d7f47d750b8f5499512bb85a226c4243556e696f6bd072c5aa2d9b69730244b56853d16970ad817e213e470618178001c9fb56c54fefa5fee67d2da524bb3b0b"
+        "61ef0e9114a92cdbb6cccb98615cfe76e3510dd88d1cc28ff99287512f24bfafa1a76877b6f37198e3a641c68a7c42d45fa7acc10dae5f3cefb7b735f12d4e58"
+        "9f7a456e78c0f5e4c4471fffa5e4fa0514ae974d8c2648513b5db494cea847156d277ad0e141c24c7839064cd08851bc2e7ca109fd4e251c35bb0a04fb05b364"
+        "ff8c4d8b59bc303e25328c09a882e952518e1a8ae0ff265d61c465896973d7490499dc639fb8502b39456791b1b6ec5bcc5d9ac36a6df622a070d43fed781f5f"
+        "149f7b62675e7d1a4d6dec48c1c7164586eae06a51208c0b791244d307726505c3ad4b26b6822377257aa152037560a739714a3ca79bd605547c9b78dd1f596f"
+        "2d4f1791bc689a0e9b799a37339c04275733740143ef5d2b58b96a363d4e08076a1a9d7846436e4dca5728b6f760eef0ca92bf0be5615e96959d767197a0beeb" ) );
+
+    // seeds; regression values, computed with this implementation
+
+    test_seed<sha3_256>( "4b1dc1372d78d152b1ec3ca7c7732a327bf3f266f62331ed9eae2602abd0b99d" );
+    test_seed<sha3_512>( "54b839f2beea4b24b48aaebfcb94e914bddabaea214219cbe9c012a6fd92dce041fb757e82591788284b1accacd08b515c917186a6d0e56143e7d0dc2802fd87" );
+    test_seed<shake_128>( "083907434b9d19e5158d185219204227b42eee1eb36f31aab97fc343db32ed6a" );
+    test_seed<shake_256>( "068c63258a96d409dbb7801ea8cf34759e33adc35d3af54897e6fa616e9e7a512d92a267f44932320f04087c03f217edcac7fdbe68c7c2dd61bd908949efc706" );
+
+    // the four-way variants must match
+
+    for( std::size_t i = 0; i < sizeof( buffer ); ++i )
+    {
+        buffer[ i ] = static_cast<unsigned char>( i );
+    }
+
+    test_x4<sha3_256, sha3_256_x4>();
+    test_x4<sha3_512, sha3_512_x4>();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,210 @@
+// Copyright 2024 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/siphash.hpp>
+#include <boost/hash2/hash_append.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <cstdint>
+#include <cstddef>
+
+// key = 00 01 02 ..., input = 00 01 02 ... of length i
+
+static const std::uint64_t vectors_sip13_64[64] =
+{
+    0xabac0158050fc4dc,
+    0xc9f49bf37d57ca93,
+    0x82cb9b024dc7d44d,
+    0x8bf80ab8e7ddf7fb,
+    0xcf75576088d38328,
+    0xdef9d52f49533b67,
+    0xc50d2b50c59f22a7,
+    0xd3927d989bb11140,
+    0x369095118d299a8e,
+    0x25a48eb36c063de4,
+    0x79de85ee92ff097f,
+    0x70c118c1f94dc352,
+    0x78a384b157b4d9a2,
+    0x306f760c1229ffa7,
+    0x605aa111c0f95d34,
+    0xd320d86d2a519956,
+    0xcc4fdd1a7d908b66,
+    0x9cf2689063dbd80c,
+    0x8ffc389cb473e63e,
+    0xf21f9de58d297d1c,
+    0xc0dc2f46a6cce040,
+    0xb992abfe2b45f844,
+    0x7ffe7b9ba320872e,
+    0x525a0e7fdae6c123,
+    0xf464aeb267349c8c,
+    0x45cd5928705b0979,
+    0x3a3e35e3ca9913a5,
+    0xa91dc74e4ade3b35,
+    0xfb0bed02ef6cd00d,
+    0x88d93cb44ab1e1f4,
+    0x540f11d643c5e663,
+    0x2370dd1f8c21d1bc,
+    0x81157b6c16a7b60d,
+    0x4d54b9e57a8ff9bf,
+    0x759f12781f2a753e,
+    0xcea1a3bebf186b91,
+    0x2cf508d3ada26206,
+    0xb6101c2da3c33057,
+    0xb3f47496ae3a36a1,
+    0x626b57547b108392,
+    0xc1d2363299e41531,
+    0x667cc1923f1ad944,
+    0x65704ffec8138825,
+    0x24f280d1c28949a6,
+    0xc2ca1cedfaf8876b,
+    0xc2164bfc9f042196,
+    0xa16e9c9368b1d623,
+    0x49fb169c8b5114fd,
+    0x9f3143f8df074c46,
+    0xc6fdaf2412cc86b3,
+    0x7eaf49d10a52098f,
+    0x1cf313559d292f9a,
+    0xc44a30dda2f41f12,
+    0x36fae98943a71ed0,
+    0x318fb34c73f0bce6,
+    0xa27abf3670a7e980,
+    0xb4bcc0db243c6d75,
+    0x23f8d852fdb71513,
+    0x8f035f4da67d8a08,
+    0xd89cd0e5b7e8f148,
+    0xf6f4e6bcf7a644ee,
+    0xaec59ad80f1837f2,
+    0xc3b2f6154b6694e0,
+    0x9d199062b7bbb3a8,
+};
+
+static const std::uint32_t vectors_sip13_32[64] =
+{
+    0x5814c896,
+    0xe7e864ca,
+    0xbc4b0e30,
+    0x01539939,
+    0x7e059ea6,
+    0x88e3d89b,
+    0xa0080b65,
+    0x9d38d9d6,
+    0x577999b1,
+    0xc839caed,
+    0xe4fa32cf,
+    0x959246ee,
+    0x6b28096c,
+    0x66dd9cd6,
+    0x16658a7c,
+    0xd0257b04,
+    0x8b31d501,
+    0x2b1cd04b,
+    0x06712339,
+    0x522aca67,
+    0x911bb605,
+    0x90a65f0e,
+    0xf826ef7b,
+    0x62512deb,
+    0x57150ad7,
+    0x5d473507,
+    0x1ec47442,
+    0xab64afd3,
+    0x0a4100d0,
+    0x6d2ce652,
+    0x2331b6a3,
+    0x08d8791a,
+    0xbc6dda8d,
+    0xe0f6c934,
+    0xb0652033,
+    0x9b9851cc,
+    0x7c46fb7f,
+    0x732ba8cb,
+    0xf142997a,
+    0xfcc9aa1b,
+    0x05327eb2,
+    0xe110131c,
+    0xf9e5e7c0,
+    0xa7d708a6,
+    0x11795ab1,
+    0x65671619,
+    0x9f5fff91,
+    0xd89c5267,
+    0x007783eb,
+    0x95766243,
+    0xab639262,
+    0x9c7e1390,
+    0xc368dda6,
+    0x38ddc455,
+    0xfa13d379,
+    0x979ea4e8,
+    0x53ecd77e,
+    0x2ee80657,
+    0x33dbb66a,
+    0xae3f0577,
+    0x88b4c4cc,
+    0x3e7f480b,
+    0x74c1ebf8,
+    0x87178304,
+};
+
+template<class H, class R, std::size_t N> void test( std::size_t k, R const (&vectors)[ N ] )
+{
+    unsigned char key[ 16 ];
+
+    for( std::size_t i = 0; i < 16; ++i )
+    {
+        key[ i ] = static_cast<unsigned char>( i );
+    }
+
+    unsigned char in[ N ];
+
+    for( std::size_t i = 0; i < N; ++i )
+    {
+        in[ i ] = static_cast<unsigned char>( i );
+    }
+
+    for( std::size_t i = 0; i < N; ++i )
+    {
+        {
+            H h( key, k );
+
+            h.update( in, i );
+
+            BOOST_TEST_EQ( h.result(), vectors[ i ] );
+        }
+
+        {
+            H h( key, k );
+
+            hash_append_range( h, in, in + i );
+
+            BOOST_TEST_EQ( h.result(), vectors[ i ] );
+        }
+
+        {
+            H h( key, k );
+
+            for( std::size_t j = 0; j < i; ++j )
+            {
+                h.update( in + j, 1 );
+            }
+
+            BOOST_TEST_EQ( h.result(), vectors[ i ] );
+        }
+    }
+}
+
+int main()
+{
+    test<boost::hash2::siphash13_64>( 16, vectors_sip13_64 );
+    test<boost::hash2::siphash13_32>( 8, vectors_sip13_32 );
+
+    {
+        // the integral key constructors
+
+        BOOST_TEST_EQ( boost::hash2::siphash13_64( 0x0706050403020100ull, 0x0F0E0D0C0B0A0908ull ).result(), vectors_sip13_64[ 0 ] );
+        BOOST_TEST_EQ( boost::hash2::siphash13_32( 0x03020100u, 0x07060504u ).result(), vectors_sip13_32[ 0 ] );
+        BOOST_TEST_EQ( boost::hash2::siphash13_32( 0x0706050403020100ull ).result(), vectors_sip13_32[ 0 ] );
+    }
+
+    return boost::report_errors();
+}
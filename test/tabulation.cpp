@@ -0,0 +1,211 @@
+// Copyright 2024 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/tabulation.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <cstdint>
+#include <cstddef>
+
+template<class H> typename H::result_type hash( H h, void const * p, std::size_t n )
+{
+    h.update( p, n );
+    return h.result();
+}
+
+// https://prng.di.unimi.it/splitmix64.c
+
+static std::uint64_t splitmix64( std::uint64_t & s )
+{
+    std::uint64_t z = ( s += 0x9e3779b97f4a7c15ull );
+    z = ( z ^ ( z >> 30 ) ) * 0xbf58476d1ce4e5b9ull;
+    z = ( z ^ ( z >> 27 ) ) * 0x94d049bb133111ebull;
+    return z ^ ( z >> 31 );
+}
+
+// the definitions, with the tables filled from splitmix64
+
+struct tabulation_ref
+{
+    std::uint64_t t[ 8 ][ 256 ];
+    unsigned char u[ 7 ][ 256 ];
+
+    explicit tabulation_ref( std::uint64_t seed )
+    {
+        for( int i = 0; i < 8; ++i )
+        {
+            for( int j = 0; j < 256; ++j )
+            {
+                t[ i ][ j ] = splitmix64( seed );
+            }
+        }
+
+        for( int i = 0; i < 7; ++i )
+        {
+            for( int j = 0; j < 256; ++j )
+            {
+                u[ i ][ j ] = static_cast<unsigned char>( splitmix64( seed ) >> 56 );
+            }
+        }
+    }
+
+    std::uint64_t simple( std::uint64_t x ) const
+    {
+        std::uint64_t h = 0;
+
+        for( int i = 0; i < 8; ++i )
+        {
+            h ^= t[ i ][ ( x >> ( 8 * i ) ) & 0xFF ];
+        }
+
+        return h;
+    }
+
+    // the twister of the first seven bytes selects, with the
+    // last byte, the entry of the last table
+
+    std::uint64_t twisted( std::uint64_t x ) const
+    {
+        std::uint64_t h = 0;
+        unsigned v = 0;
+
+        for( int i = 0; i < 7; ++i )
+        {
+            h ^= t[ i ][ ( x >> ( 8 * i ) ) & 0xFF ];
+            v ^= u[ i ][ ( x >> ( 8 * i ) ) & 0xFF ];
+        }
+
+        return h ^ t[ 7 ][ ( x >> 56 ) ^ v ];
+    }
+};
+
+// update() and result() in terms of operator(), as described
+// in detail/integer_hash.hpp
+
+template<class H> std::uint64_t hash_words( H const & f, unsigned char const * p, std::size_t n )
+{
+    std::uint64_t h = 0;
+
+    for( std::size_t i = 0; i < n; i += 8 )
+    {
+        std::uint64_t w = 0;
+
+        for( std::size_t j = 0; j < 8 && i + j < n; ++j )
+        {
+            w |= static_cast<std::uint64_t>( p[ i + j ] ) << ( 8 * j );
+        }
+
+        h = f( h ^ w );
+    }
+
+    return f( h ^ ~static_cast<std::uint64_t>( n ) );
+}
+
+static const std::size_t N = 1000;
+static unsigned char buffer[ N ];
+
+template<class H> void test( bool twisted )
+{
+    std::uint64_t const seeds[] = { 0, 1, 0x9e3779b97f4a7c15ull, 0xffffffffffffffffull };
+
+    for( std::size_t i = 0; i < sizeof( seeds ) / sizeof( seeds[0] ); ++i )
+    {
+        std::uint64_t const seed = seeds[ i ];
+
+        H const h( seed );
+        tabulation_ref const ref( seed );
+
+        // operator() must match the definition
+
+        std::uint64_t x = 0;
+
+        for( int j = 0; j < 1000; ++j )
+        {
+            BOOST_TEST_EQ( h( x ), twisted? ref.twisted( x ): ref.simple( x ) );
+            BOOST_TEST_EQ( h( ~x ), twisted? ref.twisted( ~x ): ref.simple( ~x ) );
+
+            x = x * 0x9e3779b97f4a7c15ull + 1;
+        }
+
+        // update() and result() must match their description
+
+        for( std::size_t n = 0; n <= 200; ++n )
+        {
+            BOOST_TEST_EQ( hash( h, buffer, n ), hash_words( h, buffer, n ) );
+        }
+
+        BOOST_TEST_EQ( hash( h, buffer, N ), hash_words( h, buffer, N ) );
+
+        // a second result() hashes the first
+
+        {
+            H h2( h );
+
+            h2.update( buffer, 100 );
+
+            std::uint64_t r = h2.result();
+            BOOST_TEST_EQ( h2.result(), h( r ^ ~std::uint64_t( 100 ) ) );
+        }
+    }
+
+    // a byte seed of up to 8 bytes is read as a little-endian integer
+
+    {
+        unsigned char const seed[] = { 0x15, 0x7c, 0x4a, 0x7f, 0xb9, 0x79, 0x37, 0x9e };
+
+        BOOST_TEST_EQ( H( seed, 8 )( 12345 ), H( 0x9e3779b97f4a7c15ull )( 12345 ) );
+        BOOST_TEST_EQ( H( seed, 3 )( 12345 ), H( 0x4a7c15 )( 12345 ) );
+        BOOST_TEST_EQ( H( seed, 0 )( 12345 ), H()( 12345 ) );
+    }
+
+    // a longer one is folded a word at a time, starting from its length
+
+    {
+        unsigned char seed[ 20 ];
+
+        for( int i = 0; i < 20; ++i )
+        {
+            seed[ i ] = static_cast<unsigned char>( i + 1 );
+        }
+
+        std::uint64_t s = 20;
+        std::uint64_t t;
+
+        t = s ^ 0x0807060504030201ull; s = splitmix64( t );
+        t = s ^ 0x100f0e0d0c0b0a09ull; s = splitmix64( t );
+        t = s ^ 0x0000000014131211ull; s = splitmix64( t );
+
+        BOOST_TEST_EQ( H( seed, 20 )( 12345 ), H( s )( 12345 ) );
+    }
+}
+
+int main()
+{
+    using namespace boost::hash2;
+
+    for( std::size_t i = 0; i < N; ++i )
+    {
+        buffer[ i ] = static_cast<unsigned char>( i );
+    }
+
+    test<tabulation_64>( false );
+    test<twisted_tabulation_64>( true );
+
+    // the entries of the first table are the first outputs
+    // of splitmix64 from a zero state
+
+    BOOST_TEST_EQ( tabulation_ref( 0 ).t[ 0 ][ 0 ], 0xe220a8397b1dcdafull );
+    BOOST_TEST_EQ( tabulation_ref( 0 ).t[ 0 ][ 1 ], 0x6e789e6aa1b965f4ull );
+
+    // input[ i ] = i; regression values, computed with this implementation
+
+    BOOST_TEST_EQ( hash( tabulation_64(), buffer, 0 ), 0xe2f0dfc9287f9026ull );
+    BOOST_TEST_EQ( hash( tabulation_64(), buffer, 100 ), 0xf50cb0633d1d46b3ull );
+    BOOST_TEST_EQ( hash( tabulation_64( 0x9e3779b97f4a7c15ull ), "abc", 3 ), 0x6e97fb8336de4b70ull );
+
+    BOOST_TEST_EQ( hash( twisted_tabulation_64(), buffer, 0 ), 0x2b53a035bf4efc86ull );
+    BOOST_TEST_EQ( hash( twisted_tabulation_64(), buffer, 100 ), 0xb01360ff638293f8ull );
+    BOOST_TEST_EQ( hash( twisted_tabulation_64( 0x9e3779b97f4a7c15ull ), "abc", 3 ), 0x3aaba9a203c040ddull );
+
+    return boost::report_errors();
+}
@@ -0,0 +1,129 @@
+// Copyright 2024 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/hash_append.hpp>
+#include <boost/hash2/fnv1a.hpp>
+#include <boost/hash2/siphash.hpp>
+#include <boost/hash2/xxhash.hpp>
+#include <boost/hash2/murmur3.hpp>
+#include <boost/hash2/buffered.hpp>
+#include <boost/hash2/sha1.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <boost/core/lightweight_test_trait.hpp>
+#include <string>
+#include <vector>
+#include <tuple>
+#include <cstdint>
+#include <cstddef>
+
+// hash_append through update_fixed<N> must match update( p, N )
+
+template<class H> class no_update_fixed
+{
+private:
+
+    H h_;
+
+public:
+
+    typedef typename H::result_type result_type;
+    typedef typename H::size_type size_type;
+
+    explicit no_update_fixed( std::uint64_t seed ): h_( seed )
+    {
+    }
+
+    void update( void const * p, std::size_t n )
+    {
+        h_.update( p, n );
+    }
+
+    result_type result()
+    {
+        return h_.result();
+    }
+};
+
+struct X
+{
+    char a;
+    short b;
+    int c;
+};
+
+template<class H> void hash_append( H & h, X const & x )
+{
+    using boost::hash2::hash_append;
+
+    hash_append( h, x.a );
+    hash_append( h, x.b );
+    hash_append( h, x.c );
+}
+
+template<class H> void feed( H & h, int i )
+{
+    using boost::hash2::hash_append;
+
+    // shifts the buffered part by i bytes
+
+    for( int j = 0; j < i; ++j )
+    {
+        hash_append( h, static_cast<unsigned char>( j ) );
+    }
+
+    hash_append( h, static_cast<std::uint8_t>( i ) );
+    hash_append( h, static_cast<std::uint16_t>( i * 0x0101 ) );
+    hash_append( h, static_cast<std::uint32_t>( i * 0x01010101 ) );
+    hash_append( h, static_cast<std::uint64_t>( i ) * 0x0101010101010101ull );
+    hash_append( h, 1.0f / ( i + 1 ) );
+    hash_append( h, 1.0 / ( i + 1 ) );
+    hash_append( h, -0.0 );
+
+    std::vector<int> v( i, i );
+    hash_append( h, v );
+
+    X x = { 'x', -1, i };
+    hash_append( h, std::make_tuple( x, std::string( i, 'y' ), 5u ) );
+}
+
+template<class H> void test()
+{
+    BOOST_TEST_TRAIT_TRUE(( boost::hash2::detail::has_update_fixed<H, 4> ));
+    BOOST_TEST_TRAIT_TRUE(( boost::hash2::detail::has_update_fixed<H, 8> ));
+    BOOST_TEST_TRAIT_FALSE(( boost::hash2::detail::has_update_fixed<no_update_fixed<H>, 4> ));
+
+    for( int i = 0; i < 67; ++i )
+    {
+        H h1( 0x0123456789ABCDEFull );
+        no_update_fixed<H> h2( 0x0123456789ABCDEFull );
+
+        for( int j = 0; j < 3; ++j )
+        {
+            feed( h1, i + j );
+            feed( h2, i + j );
+
+            BOOST_TEST( h1.result() == h2.result() );
+        }
+    }
+}
+
+int main()
+{
+    test<boost::hash2::fnv1a_32>();
+    test<boost::hash2::fnv1a_64>();
+    test<boost::hash2::murmur3_32>();
+    test<boost::hash2::murmur3_128>();
+    test<boost::hash2::xxhash_32>();
+    test<boost::hash2::xxhash_64>();
+    test<boost::hash2::siphash_32>();
+    test<boost::hash2::siphash13_32>();
+    test<boost::hash2::siphash_64>();
+    test<boost::hash2::siphash13_64>();
+    test< boost::hash2::buffered<boost::hash2::sha1_160> >();
+    test< boost::hash2::buffered<boost::hash2::xxhash_64, 7> >();
+
+    BOOST_TEST_TRAIT_FALSE(( boost::hash2::detail::has_update_fixed<boost::hash2::sha1_160, 4> ));
+
+    return boost::report_errors();
+}
@@ -0,0 +1,73 @@
+// Copyright 2024 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/wyhash.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <string>
+#include <cstdint>
+#include <cstddef>
+
+template<class H> typename H::result_type hash( std::string const & s, std::uint64_t seed )
+{
+    H h( seed );
+
+    h.update( s.data(), s.size() );
+
+    return h.result();
+}
+
+int main()
+{
+    using boost::hash2::wyhash_64;
+
+    // Test vectors from https://github.com/wangyi-fudan/wyhash/blob/master/test_vector.cpp,
+    // with the default secret; the seed is the index of the message
+
+    BOOST_TEST_EQ( hash<wyhash_64>( "", 0 ), 0x0409638ee2bde459ull );
+    BOOST_TEST_EQ( hash<wyhash_64>( "a", 1 ), 0xa8412d091b5fe0a9ull );
+    BOOST_TEST_EQ( hash<wyhash_64>( "abc", 2 ), 0x32dd92e4b2915153ull );
+    BOOST_TEST_EQ( hash<wyhash_64>( "message digest", 3 ), 0x8619124089a3a16bull );
+    BOOST_TEST_EQ( hash<wyhash_64>( "abcdefghijklmnopqrstuvwxyz", 4 ), 0x7a43afb61d7f5f40ull );
+    BOOST_TEST_EQ( hash<wyhash_64>( "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789", 5 ), 0xff42329b90e50d58ull );
+    BOOST_TEST_EQ( hash<wyhash_64>( "12345678901234567890123456789012345678901234567890123456789012345678901234567890", 6 ), 0xc39cab13b115aad3ull );
+
+    // a byte seed of up to 8 bytes is read as a little-endian integer
+
+    {
+        unsigned char const seed[] = { 0x15, 0x7c, 0x4a, 0x7f, 0xb9, 0x79, 0x37, 0x9e };
+
+        wyhash_64 h1( seed, 8 );
+        wyhash_64 h2( 0x9e3779b97f4a7c15ull );
+
+        h1.update( "message digest", 14 );
+        h2.update( "message digest", 14 );
+
+        BOOST_TEST_EQ( h1.result(), h2.result() );
+    }
+
+    {
+        unsigned char const seed[] = { 0x15, 0x7c, 0x4a };
+
+        wyhash_64 h1( seed, 3 );
+        wyhash_64 h2( 0x4a7c15 );
+
+        h1.update( "message digest", 14 );
+        h2.update( "message digest", 14 );
+
+        BOOST_TEST_EQ( h1.result(), h2.result() );
+    }
+
+    // a second result() is that of an empty message, seeded with the first
+
+    {
+        wyhash_64 h( 3 );
+
+        h.update( "message digest", 14 );
+
+        BOOST_TEST_EQ( h.result(), 0x8619124089a3a16bull );
+        BOOST_TEST_EQ( h.result(), hash<wyhash_64>( "", 0x8619124089a3a16bull ) );
+    }
+
+    return boost::report_errors();
+}
@@ -0,0 +1,115 @@
+// Copyright 2024 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#define _CRT_SECURE_NO_WARNINGS
+
+#include <boost/hash2/xxh3.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <cstdint>
+#include <string>
+#include <cstddef>
+#include <cstdio>
+
+template<std::size_t N> std::string to_string( std::array<unsigned char, N> const & v )
+{
+    std::string r;
+
+    for( std::size_t i = 0; i < N; ++i )
+    {
+        char buffer[ 8 ];
+
+        std::snprintf( buffer, sizeof( buffer ), "%02x", static_cast<int>( v[ i ] ) );
+
+        r += buffer;
+    }
+
+    return r;
+}
+
+template<class H> typename H::result_type hash( unsigned char const * p, std::size_t n, std::uint64_t seed )
+{
+    H h( seed );
+
+    h.update( p, n );
+
+    return h.result();
+}
+
+// Test vectors from https://github.com/Cyan4973/xxHash/blob/dev/cli/xsum_sanity_check.c
+
+static std::uint64_t const PRIME32 = 2654435761u;
+static std::uint64_t const PRIME64 = 11400714785074694797ull;
+
+static const std::size_t SANITY_BUFFER_SIZE = 2367;
+static unsigned char sanity_buffer[ SANITY_BUFFER_SIZE ];
+
+static void fill_sanity_buffer()
+{
+    std::uint64_t byte_gen = PRIME32;
+
+    for( std::size_t i = 0; i < SANITY_BUFFER_SIZE; ++i )
+    {
+        sanity_buffer[ i ] = static_cast<unsigned char>( byte_gen >> 56 );
+        byte_gen *= PRIME64;
+    }
+}
+
+struct sanity_vector
+{
+    std::size_t len;
+    std::uint64_t seed;
+    std::uint64_t xxh3_64;
+    char const * xxh3_128;
+};
+
+static const sanity_vector sanity_vectors[] =
+{
+    {    0,       0, 0x2d06800538d394c2ull, "99aa06d3014798d86001c324468d497f" },
+    {    0, PRIME64, 0xa8a6b918b2f0364aull, "00feaa732a3ce25ea986dfc5d7605bfe" },
+    {    1,       0, 0xc44bdff4074eecdbull, "a6cd5e9392000f6ac44bdff4074eecdb" },
+    {    1, PRIME64, 0x032be332dd766ef8ull, "20e49abcc53b3842032be332dd766ef8" },
+    {    6,       0, 0x27b56a84cd2d7325ull, "082afe0b8162d12a3e7039bdda43cfc6" },
+    {    6, PRIME64, 0x84589c116ab59ab9ull, "014bd95a51ca5ddbc5b54d56038e4e40" },
+    {   12,       0, 0xa713daf0dfbb77e7ull, "6e3efd8fc7802b18061a192713f69ad9" },
+    {   12, PRIME64, 0xe7303e1b2336de0eull, "ff0d60acd02ed4015d92b5d7190b12d1" },
+    {   24,       0, 0xa3fe70bf9d3510ebull, "0ce966e4678d37611e7044d28b1b901d" },
+    {   24, PRIME64, 0x850e80fc35bdd690ull, "d7895ded1f62559dc6cbf92a70680b19" },
+    {   48,       0, 0x397da259ecba1f11ull, "a002ac4e5478227ef942219aed80f67b" },
+    {   48, PRIME64, 0xadc2cbaa44acc616ull, "bc689f4c0152fb443a94d91333ed395a" },
+    {   80,       0, 0xbcdefbbb2c47c90aull, "fdf2cefde9eaac8a454ae6bf7a8a532d" },
+    {   80, PRIME64, 0xc6dd0cb699532e73ull, "19bf02d69bc56833a5eac764d1ff1166" },
+    {  195,       0, 0xcd94217ee362ec3aull, "7729543a26b207ee3fb593c086a66075" },
+    {  195, PRIME64, 0xba68003d370cb3d9ull, "0326104c4d4849e7cf9d9ec2c8c9913f" },
+    {  403,       0, 0xcdeb804d65c6dea4ull, "1b6de21e332dd73dcdeb804d65c6dea4" },
+    {  403, PRIME64, 0x6259f6ecfd6443fdull, "bed311971e0be8f26259f6ecfd6443fd" },
+    {  512,       0, 0x617e49599013cb6bull, "18d2d110dcc9bca1617e49599013cb6b" },
+    {  512, PRIME64, 0x3ce457de14c27708ull, "925d06b8ec5b80403ce457de14c27708" },
+    { 2048,       0, 0xdd59e2c3a5f038e0ull, "f736557fd47073a5dd59e2c3a5f038e0" },
+    { 2048, PRIME64, 0x66f81670669ababcull, "23cc3a2e75ebaaea66f81670669ababc" },
+    { 2240,       0, 0x6e73a90539cf2948ull, "ccb134fbfa7ce49d6e73a90539cf2948" },
+    { 2240, PRIME64, 0x757ba8487d1b5247ull, "e40842f585875ba9757ba8487d1b5247" },
+    { 2367,       0, 0xcb37aeb9e5d361edull, "e89c0f6ff369b427cb37aeb9e5d361ed" },
+    { 2367, PRIME64, 0xd2db3415b942b42aull, "ccb7a94cca1a6496d2db3415b942b42a" },
+};
+
+int main()
+{
+    using boost::hash2::xxh3_64;
+    using boost::hash2::xxh3_128;
+
+    fill_sanity_buffer();
+
+    for( std::size_t i = 0; i < sizeof( sanity_vectors ) / sizeof( sanity_vectors[0] ); ++i )
+    {
+        sanity_vector const & v = sanity_vectors[ i ];
+
+        BOOST_TEST_EQ( hash<xxh3_64>( sanity_buffer, v.len, v.seed ), v.xxh3_64 );
+        BOOST_TEST_EQ( to_string( hash<xxh3_128>( sanity_buffer, v.len, v.seed ) ), std::string( v.xxh3_128 ) );
+
+        BOOST_TEST_EQ( xxh3_64::hash( sanity_buffer, v.len, v.seed ), v.xxh3_64 );
+        BOOST_TEST_EQ( to_string( xxh3_128::hash( sanity_buffer, v.len, v.seed ) ), std::string( v.xxh3_128 ) );
+    }
+
+    return boost::report_errors();
+}
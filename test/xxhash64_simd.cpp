@@ -0,0 +1,186 @@
+// Copyright 2024 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+// Tests the opt-in AVX-512 kernel of xxhash_64 against a scalar
+// reference, across lengths and ways of splitting the input
+
+#define BOOST_HASH2_XXHASH64_SIMD
+
+#include <boost/hash2/xxhash.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <cstdint>
+#include <cstddef>
+
+static std::uint64_t const P1 = 11400714785074694791ULL;
+static std::uint64_t const P2 = 14029467366897019727ULL;
+static std::uint64_t const P3 =  1609587929392839161ULL;
+static std::uint64_t const P4 =  9650029242287828579ULL;
+static std::uint64_t const P5 =  2870177450012600261ULL;
+
+static std::uint64_t rotl( std::uint64_t x, int k )
+{
+    return ( x << k ) | ( x >> ( 64 - k ) );
+}
+
+static std::uint64_t read_le( unsigned char const * p, int n )
+{
+    std::uint64_t r = 0;
+
+    for( int i = n - 1; i >= 0; --i )
+    {
+        r = ( r << 8 ) | p[ i ];
+    }
+
+    return r;
+}
+
+static std::uint64_t round64( std::uint64_t acc, std::uint64_t input )
+{
+    acc += input * P2;
+    acc = rotl( acc, 31 );
+    acc *= P1;
+    return acc;
+}
+
+static std::uint64_t merge_round( std::uint64_t acc, std::uint64_t val )
+{
+    acc ^= round64( 0, val );
+    return acc * P1 + P4;
+}
+
+// XXH64, following the specification, one lane at a time
+
+static std::uint64_t reference( unsigned char const * p, std::size_t n, std::uint64_t seed )
+{
+    unsigned char const * const last = p + n;
+
+    std::uint64_t h;
+
+    if( n >= 32 )
+    {
+        std::uint64_t v1 = seed + P1 + P2;
+        std::uint64_t v2 = seed + P2;
+        std::uint64_t v3 = seed;
+        std::uint64_t v4 = seed - P1;
+
+        for( ; last - p >= 32; p += 32 )
+        {
+            v1 = round64( v1, read_le( p +  0, 8 ) );
+            v2 = round64( v2, read_le( p +  8, 8 ) );
+            v3 = round64( v3, read_le( p + 16, 8 ) );
+            v4 = round64( v4, read_le( p + 24, 8 ) );
+        }
+
+        h = rotl( v1, 1 ) + rotl( v2, 7 ) + rotl( v3, 12 ) + rotl( v4, 18 );
+
+        h = merge_round( h, v1 );
+        h = merge_round( h, v2 );
+        h = merge_round( h, v3 );
+        h = merge_round( h, v4 );
+    }
+    else
+    {
+        h = seed + P5;
+    }
+
+    h += n;
+
+    for( ; last - p >= 8; p += 8 )
+    {
+        h ^= round64( 0, read_le( p, 8 ) );
+        h = rotl( h, 27 ) * P1 + P4;
+    }
+
+    if( last - p >= 4 )
+    {
+        h ^= read_le( p, 4 ) * P1;
+        h = rotl( h, 23 ) * P2 + P3;
+        p += 4;
+    }
+
+    for( ; p < last; ++p )
+    {
+        h ^= *p * P5;
+        h = rotl( h, 11 ) * P1;
+    }
+
+    h ^= h >> 33;
+    h *= P2;
+    h ^= h >> 29;
+    h *= P3;
+    h ^= h >> 32;
+
+    return h;
+}
+
+static const std::size_t N = 1025;
+static unsigned char buffer[ N ];
+
+int main()
+{
+    using boost::hash2::xxhash_64;
+
+    for( std::size_t i = 0; i < N; ++i )
+    {
+        buffer[ i ] = static_cast<unsigned char>( i * 13 + 7 );
+    }
+
+    // the reference itself, on the vectors of xxhash.cpp
+
+    BOOST_TEST_EQ( reference( reinterpret_cast<unsigned char const*>( "" ), 0, 0 ), 0xef46db3751d8e999ull );
+    BOOST_TEST_EQ( reference( reinterpret_cast<unsigned char const*>( "The quick brown fox jumps over the lazy dog" ), 43, 43 ), 0x9a11f5e9468d7425ull );
+    BOOST_TEST_EQ( reference( reinterpret_cast<unsigned char const*>( "test" ), 4, 0 ), 5754696928334414137ull );
+    BOOST_TEST_EQ( reference( reinterpret_cast<unsigned char const*>( "test" ), 4, 123 ), 3134990500624303823ull );
+
+    std::uint64_t const seeds[] = { 0, 1, 0x0123456789ABCDEFull, ~0ull };
+
+    for( std::size_t i = 0; i < sizeof( seeds ) / sizeof( seeds[0] ); ++i )
+    {
+        std::uint64_t const seed = seeds[ i ];
+
+        // unaligned
+        unsigned char const * p = buffer + 1;
+
+        for( std::size_t n = 0; n < N; ++n )
+        {
+            std::uint64_t const r = reference( p, n, seed );
+
+            {
+                xxhash_64 h( seed );
+                h.update( p, n );
+
+                BOOST_TEST_EQ( h.result(), r );
+            }
+
+            BOOST_TEST_EQ( xxhash_64::hash( p, n, seed ), r );
+
+            // in two parts, the first not a multiple of the block size
+
+            for( std::size_t m = 0; m <= n; m += ( n < 96? 1: 13 ) )
+            {
+                xxhash_64 h( seed );
+
+                h.update( p, m );
+                h.update( p + m, n - m );
+
+                BOOST_TEST_EQ( h.result(), r );
+            }
+
+            // in chunks of 7
+
+            {
+                xxhash_64 h( seed );
+
+                for( std::size_t m = 0; m < n; m += 7 )
+                {
+                    h.update( p + m, n - m < 7? n - m: 7 );
+                }
+
+                BOOST_TEST_EQ( h.result(), r );
+            }
+        }
+    }
+
+    return boost::report_errors();
+}